@@ -0,0 +1,101 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/SchemaBatch.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  template <typename Fn>
+  double ns_per_op(std::size_t iterations, Fn &&fn)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           static_cast<double>(iterations);
+  }
+
+  struct Trade
+  {
+    std::int32_t account{0};
+    std::int32_t quantity{0};
+    std::int64_t timestamp{0};
+    double price{0};
+    double fee{0};
+    float ratio{0};
+    std::int32_t venue{0};
+    std::int32_t flags{0};
+  };
+} // namespace
+
+int main()
+{
+  constexpr std::size_t rows = 100'000;
+  constexpr std::size_t iterations = 20;
+
+  const auto s = schema<Trade>()
+                     .field("account", &Trade::account, field<std::int32_t>().min(1))
+                     .field("quantity", &Trade::quantity, field<std::int32_t>().between(1, 1'000'000))
+                     .field("timestamp", &Trade::timestamp, field<std::int64_t>().min(1'600'000'000))
+                     .field("price", &Trade::price, field<double>().between(0.0, 1e9))
+                     .field("fee", &Trade::fee, field<double>().min(0.0).max(1e4))
+                     .field("ratio", &Trade::ratio, field<float>().between(0.0f, 1.0f))
+                     .field("venue", &Trade::venue, field<std::int32_t>().between(0, 64))
+                     .field("flags", &Trade::flags, field<std::int32_t>().between(0, 255));
+
+  std::vector<Trade> trades(rows);
+  for (std::size_t i = 0; i < rows; ++i)
+  {
+    Trade &t = trades[i];
+    t.account = static_cast<std::int32_t>(1 + i % 5000);
+    t.quantity = static_cast<std::int32_t>(1 + i % 900);
+    t.timestamp = 1'700'000'000 + static_cast<std::int64_t>(i);
+    t.price = 10.0 + static_cast<double>(i % 1000);
+    t.fee = 0.5;
+    t.ratio = 0.25f;
+    t.venue = static_cast<std::int32_t>(i % 64);
+    t.flags = static_cast<std::int32_t>(i % 200);
+    if (i % 997 == 0)
+      t.quantity = 0; // ~0.1% failing records
+  }
+
+  std::size_t sink = 0;
+
+  const double per_record = ns_per_op(iterations, [&](std::size_t)
+                                      {
+                                        for (const Trade &t : trades)
+                                        {
+                                          ValidationErrors errors;
+                                          s.validate_into(t, errors);
+                                          sink += errors.size();
+                                        } });
+
+  const double rowwise = ns_per_op(iterations, [&](std::size_t)
+                                   { sink += validate_batch(s, trades, {.threads = 1, .columnar = false}).error_count(); });
+
+  const double columnar = ns_per_op(iterations, [&](std::size_t)
+                                    { sink += validate_batch(s, trades, {.threads = 1}).error_count(); });
+
+  const double parallel = ns_per_op(iterations, [&](std::size_t)
+                                    { sink += validate_batch(s, trades).error_count(); });
+
+  const auto per = [&](double ns)
+  { return ns / static_cast<double>(rows); };
+
+  std::cout << "validate_into per record      : " << per(per_record) << " ns/record\n";
+  std::cout << "validate_batch (row-wise, 1t) : " << per(rowwise) << " ns/record\n";
+  std::cout << "validate_batch (columnar, 1t) : " << per(columnar) << " ns/record\n";
+  std::cout << "validate_batch (columnar, Nt) : " << per(parallel) << " ns/record\n";
+  std::cout << "columnar speedup (1 thread)   : " << (per_record / columnar) << "x\n";
+  std::cout << "(checksum " << sink << ")\n";
+  return 0;
+}
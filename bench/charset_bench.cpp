@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <vix/validation/CharSet.hpp>
+#include <vix/validation/TextKernels.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  template <typename Fn>
+  double ns_per_op(std::size_t iterations, Fn &&fn)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           static_cast<double>(iterations);
+  }
+
+  // What the hand-written Rule<std::string> lambdas did.
+  bool is_hex_loop(std::string_view s)
+  {
+    return std::all_of(s.begin(), s.end(), [](char c)
+                       { return std::isxdigit(static_cast<unsigned char>(c)) != 0; });
+  }
+
+  void run(const char *label, const std::string &text, std::size_t iterations)
+  {
+    std::size_t sink = 0;
+    const double loop = ns_per_op(iterations, [&](std::size_t)
+                                  { sink += is_hex_loop(text) ? 1u : 0u; });
+    const double table = ns_per_op(iterations, [&](std::size_t)
+                                   { sink += kernels::charset_find(text, charsets::hex, SimdLevel::Scalar) == std::string_view::npos; });
+    const double simd = ns_per_op(iterations, [&](std::size_t)
+                                  { sink += kernels::charset_find(text, charsets::hex) == std::string_view::npos; });
+
+    std::cout << label << " (" << text.size() << " bytes)\n";
+    std::cout << "  isxdigit loop : " << loop << " ns\n";
+    std::cout << "  table         : " << table << " ns (" << (loop / table) << "x)\n";
+    std::cout << "  simd          : " << simd << " ns (" << (loop / simd) << "x)\n";
+    std::cout << "  (checksum " << sink << ")\n";
+  }
+} // namespace
+
+int main()
+{
+  run("sha256 token", "9f86d081884c7d659a2feaa0c55ad015a3bf4f1b2b0b822cd15d6c15b0f00a08", 5'000'000);
+  run("request id", "3f2a9c1e7b4d", 5'000'000);
+
+  std::string blob;
+  while (blob.size() < 4096)
+  {
+    blob += "0123456789abcdefABCDEF";
+  }
+  run("4 KiB hex blob", blob, 200'000);
+  return 0;
+}
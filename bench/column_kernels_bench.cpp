@@ -0,0 +1,78 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <vix/validation/Column.hpp>
+#include <vix/validation/Rules.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  template <typename Fn>
+  double ns_per_op(std::size_t iterations, Fn &&fn)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           static_cast<double>(iterations);
+  }
+} // namespace
+
+int main()
+{
+  constexpr std::size_t rows = 1 << 16;
+  constexpr std::size_t iterations = 2000;
+
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<std::int32_t> dist(0, 140);
+  std::vector<std::int32_t> ages(rows);
+  for (auto &a : ages)
+  {
+    a = dist(rng);
+  }
+  const std::span<const std::int32_t> col(ages);
+
+  std::size_t sink = 0;
+
+  // One scalar rule call per row, recording failing rows.
+  const auto rule = rules::between<std::int32_t>(18, 120);
+  const double per_row = ns_per_op(iterations, [&](std::size_t)
+                                   {
+                                     RowBitmap failed(rows);
+                                     for (std::size_t i = 0; i < rows; ++i)
+                                     {
+                                       if (!rule.test(col[i]))
+                                         failed.set(i);
+                                     }
+                                     sink += failed.count(); });
+
+  const double scalar = ns_per_op(iterations, [&](std::size_t)
+                                  { sink += column::between(col, 18, 120, SimdLevel::Scalar).count(); });
+
+  const double sse2 = ns_per_op(iterations, [&](std::size_t)
+                                { sink += column::between(col, 18, 120, SimdLevel::SSE2).count(); });
+
+  const double best = ns_per_op(iterations, [&](std::size_t)
+                                { sink += column::between(col, 18, 120).count(); });
+
+  const auto per = [&](double ns)
+  { return ns / static_cast<double>(rows); };
+
+  std::cout << "rules::between per row     : " << per(per_row) << " ns/row\n";
+  std::cout << "column::between (scalar)   : " << per(scalar) << " ns/row\n";
+  std::cout << "column::between (SSE2)     : " << per(sse2) << " ns/row\n";
+  std::cout << "column::between (detected) : " << per(best) << " ns/row (level "
+            << static_cast<int>(detected_simd_level()) << ")\n";
+  std::cout << "speedup vs per-row rule    : " << (per_row / best) << "x\n";
+  std::cout << "(checksum " << sink << ")\n";
+  return 0;
+}
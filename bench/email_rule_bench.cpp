@@ -0,0 +1,77 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <vix/validation/Rules.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  template <typename Fn>
+  double ns_per_op(std::size_t iterations, Fn &&fn)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           static_cast<double>(iterations);
+  }
+
+  // The previous implementation: up to five scans of the input.
+  const char *multi_scan_reason(std::string_view value)
+  {
+    if (value.empty())
+      return "empty";
+    if (value.find(' ') != std::string_view::npos)
+      return "space";
+    const auto at = value.find('@');
+    if (at == std::string_view::npos || at == 0)
+      return "missing_at";
+    if (value.find('@', at + 1) != std::string_view::npos)
+      return "multiple_at";
+    const auto dot = value.find('.', at + 1);
+    if (dot == std::string_view::npos || dot == at + 1 || dot == value.size() - 1)
+      return "missing_dot";
+    return nullptr;
+  }
+
+  void run(const char *label, const std::vector<std::string> &inputs, std::size_t iterations)
+  {
+    std::size_t sink = 0;
+    const double before = ns_per_op(iterations, [&](std::size_t i)
+                                    { sink += multi_scan_reason(inputs[i % inputs.size()]) ? 1u : 0u; });
+    const double single = ns_per_op(iterations, [&](std::size_t i)
+                                    { sink += rules::detail::email_reason(inputs[i % inputs.size()]) ? 1u : 0u; });
+    const double strict = ns_per_op(iterations, [&](std::size_t i)
+                                    { sink += rules::detail::email_strict_reason(inputs[i % inputs.size()]) ? 1u : 0u; });
+
+    std::cout << label << "\n";
+    std::cout << "  multi-scan   : " << before << " ns\n";
+    std::cout << "  single pass  : " << single << " ns (" << (before / single) << "x)\n";
+    std::cout << "  strict mode  : " << strict << " ns\n";
+    std::cout << "  (checksum " << sink << ")\n";
+  }
+} // namespace
+
+int main()
+{
+  std::vector<std::string> typical;
+  for (int i = 0; i < 64; ++i)
+  {
+    typical.push_back("firstname.lastname" + std::to_string(i) + "@mail.example.com");
+  }
+  run("typical addresses", typical, 2'000'000);
+
+  // Adversarial: a long local part, the '@' near the end.
+  std::vector<std::string> adversarial{std::string(64 * 1024, 'a') + "@example.com"};
+  run("64 KiB local part", adversarial, 20'000);
+
+  return 0;
+}
@@ -0,0 +1,135 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/Form.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+using Input = std::vector<std::pair<std::string_view, std::string_view>>;
+
+namespace
+{
+  template <typename Fn>
+  double ns_per_op(std::size_t iterations, Fn &&fn)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           static_cast<double>(iterations);
+  }
+
+  // A 60-field onboarding form.
+#define ONBOARDING_FIELDS(X) \
+  X(f00) X(f01) X(f02) X(f03) X(f04) X(f05) X(f06) X(f07) X(f08) X(f09) \
+  X(f10) X(f11) X(f12) X(f13) X(f14) X(f15) X(f16) X(f17) X(f18) X(f19) \
+  X(f20) X(f21) X(f22) X(f23) X(f24) X(f25) X(f26) X(f27) X(f28) X(f29) \
+  X(f30) X(f31) X(f32) X(f33) X(f34) X(f35) X(f36) X(f37) X(f38) X(f39) \
+  X(f40) X(f41) X(f42) X(f43) X(f44) X(f45) X(f46) X(f47) X(f48) X(f49) \
+  X(f50) X(f51) X(f52) X(f53) X(f54) X(f55) X(f56) X(f57) X(f58) X(f59)
+
+#define DECLARE(name) std::string name;
+
+  // set(): a chain of key comparisons per pair.
+  struct ChainForm
+  {
+    ONBOARDING_FIELDS(DECLARE)
+
+    static bool set(ChainForm &out, std::string_view key, std::string_view value)
+    {
+#define COMPARE(name)            \
+  if (key == #name)              \
+  {                              \
+    out.name.assign(value);      \
+    return true;                 \
+  }
+      ONBOARDING_FIELDS(COMPARE)
+#undef COMPARE
+      return false;
+    }
+
+    static Schema<ChainForm> schema() { return vix::validation::schema<ChainForm>(); }
+  };
+
+  // bind(): one scan of the input per field, as in form_kv_basic.cpp.
+  struct ScanForm
+  {
+    ONBOARDING_FIELDS(DECLARE)
+
+    static bool bind(ScanForm &out, const Input &in, ValidationErrors &)
+    {
+      auto get = [&](std::string_view key) -> std::string_view
+      {
+        for (const auto &kv : in)
+        {
+          if (kv.first == key)
+            return kv.second;
+        }
+        return {};
+      };
+#define SCAN(name) out.name.assign(get(#name));
+      ONBOARDING_FIELDS(SCAN)
+#undef SCAN
+      return true;
+    }
+
+    static Schema<ScanForm> schema() { return vix::validation::schema<ScanForm>(); }
+  };
+
+  // fields(): declarative table, one hash lookup per pair.
+  struct TableForm
+  {
+    ONBOARDING_FIELDS(DECLARE)
+
+    static FormFields<TableForm> fields()
+    {
+#define ENTRY(name) {#name, &TableForm::name},
+      return {ONBOARDING_FIELDS(ENTRY)};
+#undef ENTRY
+    }
+
+    static Schema<TableForm> schema() { return vix::validation::schema<TableForm>(); }
+  };
+
+#undef DECLARE
+} // namespace
+
+int main()
+{
+  std::vector<std::string> keys;
+#define KEY(name) keys.push_back(#name);
+  ONBOARDING_FIELDS(KEY)
+#undef KEY
+
+  // Pairs arrive in a different order than declared.
+  Input in;
+  for (std::size_t i = keys.size(); i-- > 0;)
+  {
+    in.emplace_back(keys[i], "value");
+  }
+
+  constexpr std::size_t iterations = 200'000;
+  std::size_t sink = 0;
+  const double chain = ns_per_op(iterations, [&](std::size_t)
+                                 { sink += Form<ChainForm>::validate(in) ? 1u : 0u; });
+  const double scan = ns_per_op(iterations, [&](std::size_t)
+                                { sink += Form<ScanForm>::validate(in) ? 1u : 0u; });
+  const double table = ns_per_op(iterations, [&](std::size_t)
+                                 { sink += Form<TableForm>::validate(in) ? 1u : 0u; });
+
+  std::cout << "Form::validate, 60 fields, 60 pairs\n";
+  std::cout << "  set() if-chain : " << chain << " ns\n";
+  std::cout << "  bind() scans   : " << scan << " ns\n";
+  std::cout << "  fields() table : " << table << " ns (" << (chain / table) << "x vs chain, "
+            << (scan / table) << "x vs scans)\n";
+  std::cout << "  (checksum " << sink << ")\n";
+  return 0;
+}
@@ -0,0 +1,171 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <vix/validation/Form.hpp>
+#include <vix/validation/Multipart.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  template <typename Fn>
+  double ns_per_op(std::size_t iterations, Fn &&fn)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           static_cast<double>(iterations);
+  }
+
+  struct UploadForm
+  {
+    std::string title;
+    std::string description;
+    std::size_t bytes = 0;
+
+    static FormFields<UploadForm> fields()
+    {
+      return {{"title", &UploadForm::title}, {"description", &UploadForm::description}};
+    }
+
+    static bool file(UploadForm &out, const MultipartPart &, std::string_view data)
+    {
+      out.bytes += data.size();
+      return true;
+    }
+
+    static Schema<UploadForm> schema()
+    {
+      return vix::validation::schema<UploadForm>()
+          .field("title", &UploadForm::title, field<std::string>().required().length_max(100));
+    }
+  };
+
+  std::string build(std::string_view boundary, std::size_t file_size)
+  {
+    std::string out;
+    out += "--" + std::string(boundary) + "\r\nContent-Disposition: form-data; name=\"title\"\r\n\r\nHoliday\r\n";
+    out += "--" + std::string(boundary) + "\r\nContent-Disposition: form-data; name=\"description\"\r\n\r\n";
+    out += "Photos from the trip, sorted by day.\r\n";
+    out += "--" + std::string(boundary) + "\r\nContent-Disposition: form-data; name=\"photo\"; filename=\"day1.jpg\"\r\n";
+    out += "Content-Type: image/jpeg\r\n\r\n";
+    for (std::size_t i = 0; i < file_size; ++i)
+    {
+      out += static_cast<char>((i * 131) ^ (i >> 7));
+    }
+    out += "\r\n--" + std::string(boundary) + "--\r\n";
+    return out;
+  }
+
+  // What the separate pipeline did: buffer the whole body, then split it
+  // into owned parts with std::string::find, then validate.
+  bool buffer_then_validate(const std::vector<std::string_view> &chunks, std::string_view boundary)
+  {
+    std::string body;
+    for (std::string_view c : chunks)
+    {
+      body.append(c);
+    }
+
+    const std::string delimiter = "--" + std::string(boundary);
+    std::map<std::string, std::string> parts;
+    std::size_t at = body.find(delimiter);
+    while (at != std::string::npos && body.compare(at + delimiter.size(), 2, "--") != 0)
+    {
+      const std::size_t head = at + delimiter.size() + 2;
+      const std::size_t blank = body.find("\r\n\r\n", head);
+      const std::size_t name = body.find("name=\"", head) + 6;
+      const std::size_t next = body.find("\r\n" + delimiter, blank);
+      if (blank == std::string::npos || next == std::string::npos)
+      {
+        return false;
+      }
+      parts[body.substr(name, body.find('"', name) - name)] = body.substr(blank + 4, next - blank - 4);
+      at = next + 2;
+    }
+
+    std::vector<std::pair<std::string_view, std::string_view>> kv;
+    for (const auto &p : parts)
+    {
+      if (p.first != "photo")
+      {
+        kv.emplace_back(p.first, p.second);
+      }
+    }
+    return static_cast<bool>(Form<UploadForm>::validate(kv));
+  }
+
+  bool stream_validate(const std::vector<std::string_view> &chunks, std::string_view boundary,
+                       const MultipartLimits &limits, std::size_t *read = nullptr)
+  {
+    Form<UploadForm>::MultipartBinder binder(boundary, limits);
+    std::size_t n = 0;
+    for (std::string_view c : chunks)
+    {
+      n += c.size();
+      if (!binder.feed(c))
+      {
+        break;
+      }
+    }
+    if (read)
+    {
+      *read = n;
+    }
+    return static_cast<bool>(binder.finish());
+  }
+
+  std::vector<std::string_view> cut(std::string_view body, std::size_t size)
+  {
+    std::vector<std::string_view> chunks;
+    for (std::size_t at = 0; at < body.size(); at += size)
+    {
+      chunks.push_back(body.substr(at, size));
+    }
+    return chunks;
+  }
+} // namespace
+
+int main()
+{
+  const std::string boundary = "----vixBoundary7MA4YWxkTrZu0gW";
+  MultipartLimits limits;
+  limits.part("photo", {.max_size = 1u << 20, .content_types = {"image/jpeg", "image/png"}});
+
+  const std::string small = build(boundary, 200'000);
+  const auto small_chunks = cut(small, 16 * 1024);
+
+  constexpr std::size_t iterations = 300;
+  std::size_t sink = 0;
+  const double buffered = ns_per_op(iterations, [&](std::size_t)
+                                    { sink += buffer_then_validate(small_chunks, boundary) ? 1u : 0u; });
+  const double streamed = ns_per_op(iterations, [&](std::size_t)
+                                    { sink += stream_validate(small_chunks, boundary, limits) ? 1u : 0u; });
+
+  const std::string large = build(boundary, 10u << 20);
+  const auto large_chunks = cut(large, 64 * 1024);
+  std::size_t read = 0;
+  const double buffered_large = ns_per_op(3, [&](std::size_t)
+                                          { sink += buffer_then_validate(large_chunks, boundary) ? 1u : 0u; });
+  const double rejected = ns_per_op(3, [&](std::size_t)
+                                    { sink += stream_validate(large_chunks, boundary, limits, &read) ? 1u : 0u; });
+
+  std::cout << "3 parts, 200 KB file, 16 KB chunks (" << small.size() << " bytes)\n";
+  std::cout << "  buffer + split + validate : " << buffered / 1e3 << " us\n";
+  std::cout << "  MultipartBinder           : " << streamed / 1e3 << " us (" << (buffered / streamed) << "x, "
+            << (static_cast<double>(small.size()) / streamed) << " GB/s)\n";
+  std::cout << "10 MB file over a 1 MB limit, 64 KB chunks\n";
+  std::cout << "  buffer + split + validate : " << buffered_large / 1e3 << " us (all " << large.size() << " bytes)\n";
+  std::cout << "  MultipartBinder           : " << rejected / 1e3 << " us (rejected after " << read << " bytes)\n";
+  std::cout << "  (checksum " << sink << ")\n";
+  return 0;
+}
@@ -0,0 +1,104 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/Form.hpp>
+
+#include "alloc_counter.hpp"
+
+using namespace vix::validation;
+
+namespace
+{
+  template <typename Fn>
+  double ns_per_op(std::size_t iterations, Fn &&fn)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           static_cast<double>(iterations);
+  }
+
+  struct ProfileForm
+  {
+    std::string email;
+    std::string name;
+    std::string company;
+    std::string title;
+    std::string phone;
+    std::string city;
+    std::string country;
+    std::string bio;
+
+    static FormFields<ProfileForm> fields()
+    {
+      return {{"email", &ProfileForm::email}, {"name", &ProfileForm::name},
+              {"company", &ProfileForm::company}, {"title", &ProfileForm::title},
+              {"phone", &ProfileForm::phone}, {"city", &ProfileForm::city},
+              {"country", &ProfileForm::country}, {"bio", &ProfileForm::bio}};
+    }
+
+    static Schema<ProfileForm> schema()
+    {
+      return vix::validation::schema<ProfileForm>()
+          .field("email", &ProfileForm::email, field<std::string>().required().email())
+          .field("name", &ProfileForm::name, field<std::string>().required().length_max(100))
+          .field("bio", &ProfileForm::bio, field<std::string>().length_max(500));
+    }
+  };
+
+  using PF = Form<ProfileForm>;
+
+  template <typename Fn>
+  void report(const char *label, std::size_t iterations, Fn &&fn)
+  {
+    const std::size_t before = g_allocations;
+    const double ns = ns_per_op(iterations, fn);
+    const double allocs = static_cast<double>(g_allocations - before) / static_cast<double>(iterations);
+    std::cout << "  " << label << ns << " ns, " << allocs << " allocations\n";
+  }
+} // namespace
+
+int main()
+{
+  const std::vector<std::pair<std::string_view, std::string_view>> kv{
+      {"email", "ada.lovelace@analytical-engines.example.com"},
+      {"name", "Augusta Ada King, Countess of Lovelace"},
+      {"company", "Analytical Engines Ltd"},
+      {"title", "Programmer"},
+      {"phone", "+44 20 7946 0958"},
+      {"city", "London"},
+      {"country", "United Kingdom"},
+      {"bio", "Wrote the first published algorithm intended to be carried out by such a machine."}};
+  const std::string body =
+      "email=ada.lovelace%40analytical-engines.example.com&name=Augusta+Ada+King%2C+Countess+of+Lovelace"
+      "&company=Analytical+Engines+Ltd&title=Programmer&phone=%2B44+20+7946+0958&city=London"
+      "&country=United+Kingdom&bio=Wrote+the+first+published+algorithm+intended+to+be+carried+out+by+such+a+machine.";
+
+  constexpr std::size_t iterations = 300'000;
+  std::size_t sink = 0;
+  PF::Workspace ws;
+
+  std::cout << "8-field form, key/value input\n";
+  report("validate()                  : ", iterations, [&](std::size_t)
+         { sink += PF::validate(kv) ? 1u : 0u; });
+  report("validate_into(workspace)    : ", iterations, [&](std::size_t)
+         { sink += PF::validate_into(ws, kv) ? 1u : 0u; });
+
+  std::cout << "8-field form, urlencoded body (" << body.size() << " bytes)\n";
+  report("validate_urlencoded()       : ", iterations, [&](std::size_t)
+         { sink += PF::validate_urlencoded(body) ? 1u : 0u; });
+  report("validate_urlencoded_into()  : ", iterations, [&](std::size_t)
+         { sink += PF::validate_urlencoded_into(PF::workspace(), body) ? 1u : 0u; });
+
+  std::cout << "  (checksum " << sink << ")\n";
+  return 0;
+}
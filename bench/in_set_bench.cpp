@@ -0,0 +1,123 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include <vix/validation/StaticStringSet.hpp>
+#include <vix/validation/StringSet.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  template <typename Fn>
+  double ns_per_op(std::size_t iterations, Fn &&fn)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           static_cast<double>(iterations);
+  }
+
+  const char *layout_name(StringSet::Layout layout)
+  {
+    switch (layout)
+    {
+    case StringSet::Layout::Linear:
+      return "linear";
+    case StringSet::Layout::Sorted:
+      return "sorted";
+    case StringSet::Layout::PerfectHash:
+      return "perfect hash";
+    }
+    return "?";
+  }
+
+  void run(std::size_t count, std::size_t iterations)
+  {
+    std::vector<std::string> keys;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      keys.push_back("value_" + std::to_string(i * 37));
+    }
+
+    // Half hits, half misses, all seen as string_view (e.g. a parsed body).
+    std::vector<std::string> storage;
+    for (std::size_t i = 0; i < 256; ++i)
+    {
+      storage.push_back(i % 2 ? keys[(i * 13) % count] : "value_x" + std::to_string(i));
+    }
+    std::vector<std::string_view> probes(storage.begin(), storage.end());
+
+    // The previous InSet: unordered_set<string>, value copied to a std::string.
+    const std::unordered_set<std::string> before(keys.begin(), keys.end());
+    const StringSet after(keys);
+
+    std::size_t sink = 0;
+    const double t_before = ns_per_op(iterations, [&](std::size_t i)
+                                      { sink += before.count(std::string(probes[i % probes.size()])); });
+    const double t_after = ns_per_op(iterations, [&](std::size_t i)
+                                     { sink += after.contains(probes[i % probes.size()]); });
+
+    std::cout << count << " keys (" << layout_name(after.layout()) << ")\n";
+    std::cout << "  unordered_set<string> : " << t_before << " ns\n";
+    std::cout << "  StringSet             : " << t_after << " ns (" << (t_before / t_after) << "x)\n";
+    std::cout << "  (checksum " << sink << ")\n";
+  }
+} // namespace
+
+int main()
+{
+  run(4, 5'000'000);
+  run(32, 5'000'000);
+  run(1000, 5'000'000);
+
+  // Values fixed at compile time: runtime StringSet vs StaticStringSet.
+  {
+    using Static = StaticStringSet<"pending", "paid", "shipped", "delivered", "cancelled", "refunded",
+                                   "on_hold", "failed", "returned", "disputed", "archived", "draft">;
+    const StringSet runtime{"pending", "paid", "shipped", "delivered", "cancelled", "refunded",
+                            "on_hold", "failed", "returned", "disputed", "archived", "draft"};
+
+    const std::vector<std::string> storage{"paid", "draft", "unknown", "returned", "lost", "on_hold", "x", "archived"};
+    const std::vector<std::string_view> probes(storage.begin(), storage.end());
+
+    std::size_t sink = 0;
+    const double t_runtime = ns_per_op(5'000'000, [&](std::size_t i)
+                                       { sink += runtime.contains(probes[i % probes.size()]); });
+    const double t_static = ns_per_op(5'000'000, [&](std::size_t i)
+                                      { sink += Static::contains(probes[i % probes.size()]); });
+
+    std::cout << "12 keys, compile time\n";
+    std::cout << "  StringSet             : " << t_runtime << " ns\n";
+    std::cout << "  StaticStringSet       : " << t_static << " ns (" << (t_runtime / t_static) << "x)\n";
+    std::cout << "  (checksum " << sink << ")\n";
+  }
+
+  // A 1 MiB rejected value: copied and hashed before, length-checked now.
+  {
+    const std::string huge(1 << 20, 'v');
+    const std::unordered_set<std::string> before{"admin", "user", "guest"};
+    const StringSet after{"admin", "user", "guest"};
+
+    std::size_t sink = 0;
+    const double t_before = ns_per_op(2'000, [&](std::size_t)
+                                      { sink += before.count(std::string(std::string_view(huge))); });
+    const double t_after = ns_per_op(2'000, [&](std::size_t)
+                                     { sink += after.contains(huge); });
+
+    std::cout << "1 MiB rejected value\n";
+    std::cout << "  unordered_set<string> : " << t_before << " ns\n";
+    std::cout << "  StringSet             : " << t_after << " ns\n";
+    std::cout << "  (checksum " << sink << ")\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,159 @@
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <vix/validation/Json.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/SchemaJson.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  template <typename Fn>
+  double ns_per_op(std::size_t iterations, Fn &&fn)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           static_cast<double>(iterations);
+  }
+
+  struct Profile
+  {
+    std::string email;
+    std::string name;
+    std::string company;
+    std::string title;
+    std::string city;
+    std::string bio;
+    int age = 0;
+    bool newsletter = false;
+  };
+
+  Schema<Profile> profile_schema()
+  {
+    return schema<Profile>()
+        .field("email", &Profile::email, field<std::string>().required().email())
+        .field("name", &Profile::name, field<std::string>().required().length_max(100))
+        .field("company", &Profile::company, field<std::string>().length_max(100))
+        .field("title", &Profile::title, field<std::string>().length_max(100))
+        .field("city", &Profile::city, field<std::string>().length_max(100))
+        .field("bio", &Profile::bio, field<std::string>().length_max(500))
+        .field("age", &Profile::age, field<int>().between(13, 150))
+        .field("newsletter", &Profile::newsletter, [](std::string_view, const bool &) { return ValidationResult{}; });
+  }
+
+  // What the HTTP layer did: a DOM of owned strings (built with the same
+  // tokenizer, so only the allocations and copies differ), copied into the
+  // struct, then validated.
+  struct Node
+  {
+    JsonValue::Kind kind;
+    std::string text;
+  };
+
+  ValidationResult dom_then_validate(const Schema<Profile> &s, std::string_view body)
+  {
+    std::unordered_map<std::string, Node> dom;
+    JsonReader in(body);
+    std::string_view key;
+    JsonValue value;
+    if (in.begin_object())
+    {
+      while (in.next_key(key))
+      {
+        std::string name(key);
+        if (!in.read_value(value))
+        {
+          break;
+        }
+        dom[std::move(name)] = Node{value.kind, std::string(value.text)};
+      }
+      (void)in.finish();
+    }
+    if (in.failed())
+    {
+      ValidationErrors out;
+      out.add("__json__", ValidationErrorCode::Format, "invalid JSON");
+      return ValidationResult{std::move(out)};
+    }
+
+    Profile p;
+    const auto text = [&](const char *name, std::string &dst)
+    {
+      if (auto it = dom.find(name); it != dom.end())
+      {
+        dst = it->second.text;
+      }
+    };
+    text("email", p.email);
+    text("name", p.name);
+    text("company", p.company);
+    text("title", p.title);
+    text("city", p.city);
+    text("bio", p.bio);
+    if (auto it = dom.find("age"); it != dom.end())
+    {
+      std::from_chars(it->second.text.data(), it->second.text.data() + it->second.text.size(), p.age);
+    }
+    if (auto it = dom.find("newsletter"); it != dom.end())
+    {
+      p.newsletter = it->second.kind == JsonValue::Kind::True;
+    }
+    return s.validate(p);
+  }
+} // namespace
+
+int main()
+{
+  const Schema<Profile> s = profile_schema();
+  const std::string body =
+      R"({"email":"ada.lovelace@example.com","name":"Ada Lovelace","company":"Analytical Engines Ltd",)"
+      R"("title":"Programmer","city":"London","age":36,"newsletter":true,)"
+      R"("bio":"Wrote the first published algorithm intended for a machine.","meta":{"source":"web","tags":["a","b"]}})";
+
+  constexpr std::size_t iterations = 300'000;
+  std::size_t sink = 0;
+  const double dom = ns_per_op(iterations, [&](std::size_t)
+                               { sink += dom_then_validate(s, body).ok() ? 1u : 0u; });
+  const double sax = ns_per_op(iterations, [&](std::size_t)
+                               {
+                                 Profile p;
+                                 sink += validate_json(s, body, p).ok() ? 1u : 0u; });
+
+  // Hostile body: invalid first member, then 10 MB of payload.
+  std::string hostile = R"({"email":"nope","bio":")";
+  hostile.append(10u << 20, 'x');
+  hostile += R"("})";
+
+  constexpr std::size_t rounds = 20;
+  const double dom_hostile = ns_per_op(rounds, [&](std::size_t)
+                                       { sink += dom_then_validate(s, hostile).ok() ? 1u : 0u; });
+  const double all_hostile = ns_per_op(rounds, [&](std::size_t)
+                                       {
+                                         Profile p;
+                                         sink += validate_json(s, hostile, p).ok() ? 1u : 0u; });
+  const double fast_hostile = ns_per_op(rounds, [&](std::size_t)
+                                        {
+                                          Profile p;
+                                          sink += validate_json(s, hostile, p, ValidationPolicy::FailFast).ok() ? 1u : 0u; });
+
+  std::cout << "8-field JSON body (" << body.size() << " bytes)\n";
+  std::cout << "  DOM + copy + validate   : " << dom << " ns\n";
+  std::cout << "  validate_json           : " << sax << " ns (" << (dom / sax) << "x)\n";
+  std::cout << "10 MB body, first member invalid\n";
+  std::cout << "  DOM + copy + validate   : " << dom_hostile / 1e3 << " us\n";
+  std::cout << "  validate_json           : " << all_hostile / 1e3 << " us\n";
+  std::cout << "  validate_json, FailFast : " << fast_hostile / 1e3 << " us\n";
+  std::cout << "  (checksum " << sink << ")\n";
+  return 0;
+}
@@ -0,0 +1,58 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <vix/validation/Pattern.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  template <typename Fn>
+  double ns_per_op(std::size_t iterations, Fn &&fn)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           static_cast<double>(iterations);
+  }
+
+  void run(const char *label, const char *source, const std::vector<std::string> &inputs, std::size_t iterations)
+  {
+    const std::regex re(source, std::regex::optimize);
+    const Pattern dfa(source);
+
+    std::size_t sink = 0;
+    const double regex = ns_per_op(iterations, [&](std::size_t i)
+                                   { sink += std::regex_search(inputs[i % inputs.size()], re) ? 1u : 0u; });
+    const double table = ns_per_op(iterations, [&](std::size_t i)
+                                   { sink += dfa.matches(inputs[i % inputs.size()]) ? 1u : 0u; });
+
+    std::cout << label << "  " << source << "  (" << dfa.state_count() << " states)\n";
+    std::cout << "  std::regex : " << regex << " ns\n";
+    std::cout << "  Pattern    : " << table << " ns (" << (regex / table) << "x)\n";
+    std::cout << "  (checksum " << sink << ")\n";
+  }
+} // namespace
+
+int main()
+{
+  run("zip code", "^\\d{5}(-\\d{4})?$", {"75001", "94105-1234", "9410", "ABCDE"}, 1'000'000);
+  run("sku", "^[A-Z]{3}-\\d{4}$", {"ABC-1234", "ABC-12345", "abc-1234"}, 1'000'000);
+  run("hex color", "^#([0-9a-fA-F]{3}|[0-9a-fA-F]{6})$", {"#00ff7F", "#abc", "#00ff7", "red"}, 1'000'000);
+  run("username", "^[a-z][a-z0-9_]{2,31}$", {"gaspard_k", "x", "john_doe_the_third_2025", "Bad Name"}, 1'000'000);
+  run("email-ish", "^[^@\\s]+@[^@\\s]+\\.[a-z]{2,}$", {"john@example.com", "john@@example.com", "no-at-sign.org"},
+      1'000'000);
+  run("semver", "^\\d+\\.\\d+\\.\\d+(-[0-9A-Za-z.-]+)?$", {"1.2.3", "10.20.30-rc.1", "1.2"}, 1'000'000);
+
+  // Backtracking blow-up: std::regex is exponential in the run length.
+  run("adversarial", "^(a+)+$", {std::string(22, 'a') + "!"}, 20);
+  return 0;
+}
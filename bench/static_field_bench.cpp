@@ -0,0 +1,70 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/StaticField.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  struct Order
+  {
+    int quantity{0};
+    double price{0.0};
+    std::string sku;
+  };
+
+  template <typename Fn>
+  double ns_per_op(std::size_t iterations, Fn &&fn)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           static_cast<double>(iterations);
+  }
+} // namespace
+
+int main()
+{
+  constexpr std::size_t iterations = 2'000'000;
+
+  const auto dynamic_schema =
+      schema<Order>()
+          .field("quantity", &Order::quantity, field<int>().min(1).max(1000))
+          .field("price", &Order::price, field<double>().between(0.01, 100000.0))
+          .field("sku", &Order::sku, field<std::string>().required().length_max(32));
+
+  const auto static_schema =
+      schema<Order>()
+          .field("quantity", &Order::quantity, static_field<int>(rules::min(1), rules::max(1000)))
+          .field("price", &Order::price, static_field<double>(rules::between(0.01, 100000.0)))
+          .field("sku", &Order::sku, static_field<std::string>(rules::required(), rules::length_max(32)));
+
+  std::vector<Order> orders(64);
+  for (std::size_t i = 0; i < orders.size(); ++i)
+  {
+    orders[i] = Order{static_cast<int>(i % 900) + 1, 10.0 + static_cast<double>(i), "SKU-" + std::to_string(i)};
+  }
+
+  std::size_t sink = 0;
+
+  const double dyn = ns_per_op(iterations, [&](std::size_t i)
+                               { sink += dynamic_schema.validate(orders[i % orders.size()]).size(); });
+
+  const double st = ns_per_op(iterations, [&](std::size_t i)
+                              { sink += static_schema.validate(orders[i % orders.size()]).size(); });
+
+  std::cout << "FieldSpec (std::function rules) : " << dyn << " ns/validate\n";
+  std::cout << "static_field (inlined rules)    : " << st << " ns/validate\n";
+  std::cout << "speedup                         : " << (dyn / st) << "x\n";
+  std::cout << "(checksum " << sink << ")\n";
+  return 0;
+}
@@ -0,0 +1,67 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <vix/validation/TextKernels.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  template <typename Fn>
+  double ns_per_op(std::size_t iterations, Fn &&fn)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           static_cast<double>(iterations);
+  }
+
+  std::string repeat(std::string_view piece, std::size_t bytes)
+  {
+    std::string s;
+    while (s.size() + piece.size() <= bytes)
+    {
+      s += piece;
+    }
+    return s;
+  }
+
+  void run(const char *label, const std::string &text, std::size_t iterations)
+  {
+    std::size_t sink = 0;
+    double t[3];
+    const SimdLevel levels[] = {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2};
+    for (int k = 0; k < 3; ++k)
+    {
+      t[k] = ns_per_op(iterations, [&](std::size_t)
+                       { sink += kernels::utf8_scan(text, levels[k]).length; });
+    }
+
+    const double bytes = static_cast<double>(text.size());
+    std::cout << label << " (" << text.size() << " bytes)\n";
+    std::cout << "  scalar : " << t[0] << " ns (" << bytes / t[0] << " B/ns)\n";
+    std::cout << "  sse2   : " << t[1] << " ns (" << (t[0] / t[1]) << "x)\n";
+    std::cout << "  avx2   : " << t[2] << " ns (" << (t[0] / t[2]) << "x)\n";
+    std::cout << "  (checksum " << sink << ")\n";
+  }
+} // namespace
+
+int main()
+{
+  run("short name", "Zo\xC3\xAB Kirira-Nakamura", 5'000'000);
+  run("ASCII", repeat("The quick brown fox jumps over the lazy dog. ", 4096), 200'000);
+  run("Latin-1 text", repeat("D\xC3\xA9j\xC3\xA0 vu, na\xC3\xAFve fa\xC3\xA7"
+                                     "ade, cr\xC3\xA8me br\xC3\xBBl\xC3\xA9"
+                                     "e. ",
+                                     4096), 100'000);
+  run("CJK + emoji", repeat("\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE3\x83\x86\xE3\x82\xAD\xE3\x82\xB9\xE3\x83\x88 \xF0\x9F\x98\x80 ", 4096), 100'000);
+  return 0;
+}
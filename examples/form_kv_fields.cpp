@@ -0,0 +1,57 @@
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/Form.hpp>
+#include <vix/validation/Validate.hpp>
+
+struct RegisterForm
+{
+  std::string email;
+  std::string password;
+  std::optional<std::string> referrer;
+
+  // One lookup per input pair, whatever the number of fields.
+  static vix::validation::FormFields<RegisterForm> fields()
+  {
+    return {{"email", &RegisterForm::email},
+            {"password", &RegisterForm::password},
+            {"referrer", &RegisterForm::referrer}};
+  }
+
+  static vix::validation::Schema<RegisterForm> schema()
+  {
+    using namespace vix::validation;
+    return vix::validation::schema<RegisterForm>()
+        .field("email", &RegisterForm::email, field<std::string>().required().email())
+        .field("password", &RegisterForm::password, field<std::string>().length_min(8));
+  }
+};
+
+int main()
+{
+  using Input = std::vector<std::pair<std::string_view, std::string_view>>;
+
+  Input in = {
+      {"password", "correct horse"},
+      {"email", "ada@example.com"},
+  };
+
+  auto r = vix::validation::Form<RegisterForm>::validate(in);
+
+  std::cout << "ok=" << static_cast<bool>(r) << "\n";
+  if (!r)
+  {
+    for (const auto &e : r.errors().all())
+    {
+      std::cout << " - field=" << e.field << " message=" << e.message << "\n";
+    }
+    return 1;
+  }
+
+  std::cout << "email=" << r.value().email << " referrer=" << r.value().referrer.value_or("-") << "\n";
+  return 0;
+}
@@ -0,0 +1,62 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <vix/validation/Form.hpp>
+#include <vix/validation/Schema.hpp>
+
+struct UserClean
+{
+  std::string email;
+  int age{0};
+};
+
+struct RegisterForm
+{
+  using cleaned_type = UserClean;
+
+  std::string email;
+  std::string age; // raw input
+
+  static bool set(RegisterForm &out, std::string_view key, std::string_view value)
+  {
+    if (key == "email")
+      out.email.assign(value);
+    else if (key == "age")
+      out.age.assign(value);
+    else
+      return false;
+    return true;
+  }
+
+  // Each entry writes its checked value into UserClean: "age" is parsed
+  // once, during validation, and never again.
+  static vix::validation::Schema<RegisterForm> schema()
+  {
+    return vix::validation::schema<RegisterForm>()
+        .field("email", &RegisterForm::email,
+               vix::validation::field<std::string>().required().email(),
+               &UserClean::email)
+        .parsed<int>("age", &RegisterForm::age,
+                     vix::validation::parsed<int>().between(18, 120).parse_message("age must be a number"),
+                     &UserClean::age);
+  }
+};
+
+int main()
+{
+  auto r = vix::validation::Form<RegisterForm>::validate_kv({
+      {"email", "john@doe.com"},
+      {"age", "42"},
+  });
+
+  if (!r)
+  {
+    for (const auto &e : r.errors().all())
+      std::cout << " - field=" << e.field << " message=" << e.message << "\n";
+    return 1;
+  }
+
+  std::cout << "email=" << r.value().email << " age=" << r.value().age << "\n";
+  return 0;
+}
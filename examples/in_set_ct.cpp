@@ -0,0 +1,48 @@
+#include <iostream>
+#include <string>
+
+#include <vix/validation/BaseModel.hpp>
+
+using namespace vix::validation;
+
+// Allowed values known at compile time: the lookup table is built by the
+// compiler, so building the cached schema does no work for it.
+struct PaymentInput : BaseModel<PaymentInput>
+{
+  std::string currency;
+
+  static Schema<PaymentInput> schema()
+  {
+    return vix::validation::schema<PaymentInput>()
+        .field("currency", &PaymentInput::currency,
+               field<std::string>()
+                   .required()
+                   .in_set_ct<"USD", "EUR", "UGX">("currency must be USD/EUR/UGX"));
+  }
+};
+
+int main()
+{
+  std::string role = "admin";
+
+  auto res = validate("role", role)
+                 .required()
+                 .in_set_ct<"admin", "user", "guest">()
+                 .result();
+
+  std::cout << "role ok=" << res.ok() << "\n";
+
+  PaymentInput p;
+  p.currency = "BTC";
+
+  auto r = PaymentInput::validate(p);
+  std::cout << "payment ok=" << r.ok() << "\n";
+
+  for (const auto &e : r.errors.all())
+  {
+    std::cout << " - field=" << e.field
+              << " message=" << e.message << "\n";
+  }
+
+  return res.ok() && !r.ok() ? 0 : 1;
+}
@@ -18,6 +18,7 @@
 #include <type_traits>
 
 #include <vix/validation/Schema.hpp>
+#include <vix/validation/ValidationPolicy.hpp>
 #include <vix/validation/ValidationResult.hpp>
 
 namespace vix::validation
@@ -73,32 +74,39 @@ namespace vix::validation
     /**
      * @brief Validate this instance using the cached schema.
      *
+     * @param policy How many errors to collect (see ValidationPolicy).
      * @return ValidationResult containing accumulated errors.
      */
-    [[nodiscard]] ValidationResult validate() const
+    [[nodiscard]] ValidationResult validate(ValidationPolicy policy = ValidationPolicy::AllErrors) const
     {
-      return schema_ref().validate(self());
+      return schema_ref().validate(self(), policy);
     }
 
     /**
      * @brief Convenience validity check for this instance.
      *
-     * @return true if validation produced no errors, false otherwise.
+     * Uses the schema's predicate path (`Schema::is_valid`), so no
+     * ValidationError is built and the check stops at the first failure.
+     *
+     * @return true if the instance satisfies the schema, false otherwise.
      */
     [[nodiscard]] bool is_valid() const
     {
-      return validate().ok();
+      return schema_ref().is_valid(self());
     }
 
     /**
      * @brief Validate an arbitrary instance of Derived.
      *
      * @param obj Object to validate.
+     * @param policy How many errors to collect (see ValidationPolicy).
      * @return ValidationResult containing accumulated errors.
      */
-    [[nodiscard]] static ValidationResult validate(const Derived &obj)
+    [[nodiscard]] static ValidationResult validate(
+        const Derived &obj,
+        ValidationPolicy policy = ValidationPolicy::AllErrors)
     {
-      return schema_ref().validate(obj);
+      return schema_ref().validate(obj, policy);
     }
 
     /**
@@ -116,7 +124,8 @@ namespace vix::validation
      * @brief Internal schema cache accessor.
      *
      * Enforces at compile time that Derived::schema() returns Schema<Derived>.
-     * The returned schema is constructed once and reused.
+     * The returned schema is constructed once (thread-safe static
+     * initialization) and then shared, read-only, by every thread.
      */
     [[nodiscard]] static const Schema<Derived> &schema_ref()
     {
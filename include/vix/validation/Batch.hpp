@@ -0,0 +1,324 @@
+/**
+ *
+ *  @file Batch.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_BATCH_HPP
+#define VIX_VALIDATION_BATCH_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/ValidationError.hpp>
+#include <vix/validation/ValidationErrors.hpp>
+#include <vix/validation/ValidationPolicy.hpp>
+
+namespace vix::validation
+{
+
+  /**
+   * @brief Options for batch validation (see validate_batch in SchemaBatch.hpp).
+   */
+  struct BatchOptions
+  {
+    /// Worker threads, including the calling thread. 0 = hardware concurrency.
+    std::size_t threads{0};
+
+    /// Records per work item. Workers claim and steal whole chunks.
+    std::size_t grain{1024};
+
+    /// Policy applied to each record.
+    ValidationPolicy policy{ValidationPolicy::AllErrors};
+
+    /// Evaluate each field over a block of records before the next field
+    /// (see validate_batch). false = record by record.
+    bool columnar{true};
+  };
+
+  /**
+   * @class BatchResult
+   * @brief Compact per-record outcome of a batch validation.
+   *
+   * - a bitmap with one bit per record (set = record failed)
+   * - the sorted indices of failing records
+   * - every error, grouped by record in index order (CSR layout: record k
+   *   of failed_indices() owns errors [offset(k), offset(k + 1)))
+   *
+   * The content is deterministic: it does not depend on the number of
+   * threads nor on scheduling.
+   */
+  class BatchResult
+  {
+  public:
+    BatchResult() = default;
+
+    /// @brief Number of validated records.
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    /// @brief True if every record passed.
+    [[nodiscard]] bool ok() const noexcept { return failed_.empty(); }
+
+    [[nodiscard]] std::size_t failed_count() const noexcept { return failed_.size(); }
+    [[nodiscard]] std::size_t error_count() const noexcept { return errors_.size(); }
+
+    /// @brief True if record `index` produced at least one error.
+    [[nodiscard]] bool failed(std::size_t index) const noexcept
+    {
+      return index < size_ && ((bits_[index / 64] >> (index % 64)) & 1u);
+    }
+
+    /// @brief One bit per record, 64 records per word.
+    [[nodiscard]] const std::vector<std::uint64_t> &failure_bitmap() const noexcept { return bits_; }
+
+    /// @brief Indices of failing records, ascending.
+    [[nodiscard]] const std::vector<std::size_t> &failed_indices() const noexcept { return failed_; }
+
+    /// @brief All errors, grouped by record in index order.
+    [[nodiscard]] const std::vector<ValidationError> &errors() const noexcept { return errors_; }
+
+    /// @brief Errors of record `index` (empty if it passed).
+    [[nodiscard]] std::span<const ValidationError> errors_of(std::size_t index) const noexcept
+    {
+      if (!failed(index))
+      {
+        return {};
+      }
+
+      const auto it = std::lower_bound(failed_.begin(), failed_.end(), index);
+      const auto k = static_cast<std::size_t>(it - failed_.begin());
+      return std::span<const ValidationError>(errors_.data() + offsets_[k], offsets_[k + 1] - offsets_[k]);
+    }
+
+  private:
+    template <typename Fn>
+    friend BatchResult run_batch_ranges(std::size_t, const BatchOptions &, Fn &&);
+
+    std::size_t size_{0};
+    std::vector<std::uint64_t> bits_;
+    std::vector<std::size_t> failed_;
+    std::vector<std::size_t> offsets_;
+    std::vector<ValidationError> errors_;
+  };
+
+  namespace detail
+  {
+    /// @brief Output of one chunk, merged in chunk order after the run.
+    struct BatchChunk
+    {
+      std::vector<std::size_t> failed;
+      std::vector<std::size_t> counts;
+      ValidationErrors errors;
+
+      /// @brief Record `index` is done; its errors start at `before`.
+      void close_record(std::size_t index, std::size_t before)
+      {
+        if (errors.size() != before)
+        {
+          failed.push_back(index);
+          counts.push_back(errors.size() - before);
+        }
+      }
+    };
+
+    /// @brief A worker's own chunk range; any worker may claim from it.
+    struct alignas(64) BatchRange
+    {
+      std::atomic<std::size_t> next{0};
+      std::size_t end{0};
+    };
+
+    [[nodiscard]] inline std::size_t batch_threads(std::size_t requested, std::size_t chunks) noexcept
+    {
+      std::size_t t = requested;
+      if (t == 0)
+      {
+        t = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+      }
+      return std::max<std::size_t>(1, std::min(t, chunks));
+    }
+  } // namespace detail
+
+  /**
+   * @brief Validate records [0, n) with `validate_range(first, last, chunk)`.
+   *
+   * Records are cut into chunks of `options.grain`. Each worker starts on
+   * its own contiguous range of chunks and, once done, steals remaining
+   * chunks from the other workers' ranges. `validate_range` appends the
+   * errors of records [first, last) to `chunk.errors`, calling
+   * `chunk.close_record(i, before)` after each record. Chunks are merged in
+   * chunk order, which keeps the result deterministic.
+   *
+   * `validate_range` is called concurrently from several threads. If it
+   * throws, the first exception is rethrown after all workers stopped. If a
+   * worker thread cannot be started, the ones already running are stopped
+   * and joined before the std::system_error propagates.
+   */
+  template <typename Fn>
+  [[nodiscard]] BatchResult run_batch_ranges(std::size_t n, const BatchOptions &options, Fn &&validate_range)
+  {
+    BatchResult result;
+    result.size_ = n;
+    result.bits_.assign((n + 63) / 64, 0);
+    result.offsets_.push_back(0);
+
+    if (n == 0)
+    {
+      return result;
+    }
+
+    const std::size_t grain = std::max<std::size_t>(1, options.grain);
+    const std::size_t chunks = (n + grain - 1) / grain;
+    const std::size_t threads = detail::batch_threads(options.threads, chunks);
+
+    std::vector<detail::BatchChunk> out(chunks);
+    std::unique_ptr<detail::BatchRange[]> ranges(new detail::BatchRange[threads]);
+    for (std::size_t w = 0; w < threads; ++w)
+    {
+      ranges[w].next.store(w * chunks / threads, std::memory_order_relaxed);
+      ranges[w].end = (w + 1) * chunks / threads;
+    }
+
+    std::atomic<bool> stop{false};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto run_chunk = [&](std::size_t c)
+    {
+      const std::size_t first = c * grain;
+      validate_range(first, std::min(n, first + grain), out[c]);
+    };
+
+    auto worker = [&](std::size_t self)
+    {
+      try
+      {
+        for (std::size_t k = 0; k < threads && !stop.load(std::memory_order_relaxed); ++k)
+        {
+          detail::BatchRange &range = ranges[(self + k) % threads];
+          for (;;)
+          {
+            const std::size_t c = range.next.fetch_add(1, std::memory_order_relaxed);
+            if (c >= range.end || stop.load(std::memory_order_relaxed))
+            {
+              break;
+            }
+            run_chunk(c);
+          }
+        }
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error)
+        {
+          error = std::current_exception();
+        }
+        stop.store(true, std::memory_order_relaxed);
+      }
+    };
+
+    {
+      std::vector<std::thread> pool;
+      pool.reserve(threads - 1);
+      try
+      {
+        for (std::size_t w = 1; w < threads; ++w)
+        {
+          pool.emplace_back(worker, w);
+        }
+      }
+      catch (...)
+      {
+        // Destroying a joinable std::thread terminates the program.
+        stop.store(true, std::memory_order_relaxed);
+        for (auto &t : pool)
+        {
+          t.join();
+        }
+        throw;
+      }
+      worker(0);
+      for (auto &t : pool)
+      {
+        t.join();
+      }
+    }
+
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+
+    std::size_t failed_total = 0;
+    std::size_t errors_total = 0;
+    for (const auto &chunk : out)
+    {
+      failed_total += chunk.failed.size();
+      errors_total += chunk.errors.size();
+    }
+
+    result.failed_.reserve(failed_total);
+    result.offsets_.reserve(failed_total + 1);
+    result.errors_.reserve(errors_total);
+
+    for (auto &chunk : out)
+    {
+      for (std::size_t k = 0; k < chunk.failed.size(); ++k)
+      {
+        const std::size_t i = chunk.failed[k];
+        result.bits_[i / 64] |= (std::uint64_t{1} << (i % 64));
+        result.failed_.push_back(i);
+        result.offsets_.push_back(result.offsets_.back() + chunk.counts[k]);
+      }
+
+      auto &errs = chunk.errors.all_mut();
+      std::move(errs.begin(), errs.end(), std::back_inserter(result.errors_));
+      chunk = detail::BatchChunk{};
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Validate records [0, n) one at a time with
+   * `validate_one(index, errors)`; see run_batch_ranges().
+   */
+  template <typename Fn>
+  [[nodiscard]] BatchResult run_batch(std::size_t n, const BatchOptions &options, Fn &&validate_one)
+  {
+    return run_batch_ranges(
+        n,
+        options,
+        [&validate_one](std::size_t first, std::size_t last, detail::BatchChunk &chunk)
+        {
+          for (std::size_t i = first; i < last; ++i)
+          {
+            const std::size_t before = chunk.errors.size();
+            validate_one(i, chunk.errors);
+            chunk.close_record(i, before);
+          }
+        });
+  }
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_BATCH_HPP
@@ -0,0 +1,189 @@
+/**
+ *
+ *  @file CharSet.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_CHAR_SET_HPP
+#define VIX_VALIDATION_CHAR_SET_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace vix::validation
+{
+
+  /**
+   * @class CharSet
+   * @brief Set of byte values, built at compile time for the charset rules.
+   *
+   * Besides a 256-entry table, a CharSet carries two 16-entry nibble
+   * tables such that byte `b` is a member iff
+   * `low[b & 15] & high[b >> 4]` is non-zero: the form a byte shuffle
+   * (pshufb) evaluates for 32 bytes at once. This needs at most 8 distinct
+   * rows of low nibbles across the high nibbles, which always holds for
+   * ASCII-only sets; other sets report vectorizable() == false and stay on
+   * the table.
+   *
+   * @code
+   * constexpr CharSet token = CharSet::range('a', 'z') | CharSet("0123456789_");
+   * @endcode
+   */
+  class CharSet
+  {
+  public:
+    constexpr CharSet() noexcept = default;
+
+    /// @brief The bytes of `chars`.
+    constexpr explicit CharSet(std::string_view chars) noexcept
+    {
+      for (char c : chars)
+      {
+        table_[static_cast<unsigned char>(c)] = 1;
+      }
+      refresh();
+    }
+
+    /// @brief Bytes in [first, last].
+    [[nodiscard]] static constexpr CharSet range(unsigned char first, unsigned char last) noexcept
+    {
+      CharSet s;
+      for (unsigned c = first; c <= last; ++c)
+      {
+        s.table_[c] = 1;
+      }
+      s.refresh();
+      return s;
+    }
+
+    [[nodiscard]] constexpr CharSet operator|(const CharSet &other) const noexcept
+    {
+      CharSet s;
+      for (std::size_t c = 0; c < 256; ++c)
+      {
+        s.table_[c] = table_[c] | other.table_[c];
+      }
+      s.refresh();
+      return s;
+    }
+
+    [[nodiscard]] constexpr CharSet operator~() const noexcept
+    {
+      CharSet s;
+      for (std::size_t c = 0; c < 256; ++c)
+      {
+        s.table_[c] = table_[c] ^ 1;
+      }
+      s.refresh();
+      return s;
+    }
+
+    [[nodiscard]] constexpr bool contains(unsigned char c) const noexcept
+    {
+      return table_[c] != 0;
+    }
+
+    [[nodiscard]] constexpr bool vectorizable() const noexcept
+    {
+      return vectorizable_;
+    }
+
+    /// @brief Membership per byte value (0 or 1).
+    [[nodiscard]] constexpr const std::array<std::uint8_t, 256> &table() const noexcept
+    {
+      return table_;
+    }
+
+    [[nodiscard]] constexpr const std::array<std::uint8_t, 16> &low_nibbles() const noexcept
+    {
+      return low_;
+    }
+
+    [[nodiscard]] constexpr const std::array<std::uint8_t, 16> &high_nibbles() const noexcept
+    {
+      return high_;
+    }
+
+  private:
+    /// @brief Rebuild the nibble tables: one bit per distinct row.
+    constexpr void refresh() noexcept
+    {
+      std::array<std::uint16_t, 8> rows{};
+      std::size_t distinct = 0;
+      low_ = {};
+      high_ = {};
+      vectorizable_ = true;
+
+      for (std::size_t hi = 0; hi < 16; ++hi)
+      {
+        std::uint16_t row = 0;
+        for (std::size_t lo = 0; lo < 16; ++lo)
+        {
+          row = static_cast<std::uint16_t>(row | (table_[hi * 16 + lo] << lo));
+        }
+        if (row == 0)
+        {
+          continue;
+        }
+
+        std::size_t bit = 0;
+        while (bit < distinct && rows[bit] != row)
+        {
+          ++bit;
+        }
+        if (bit == distinct)
+        {
+          if (distinct == rows.size())
+          {
+            vectorizable_ = false;
+            return;
+          }
+          rows[distinct++] = row;
+        }
+
+        high_[hi] = static_cast<std::uint8_t>(1u << bit);
+        for (std::size_t lo = 0; lo < 16; ++lo)
+        {
+          if ((row >> lo) & 1u)
+          {
+            low_[lo] = static_cast<std::uint8_t>(low_[lo] | (1u << bit));
+          }
+        }
+      }
+    }
+
+    std::array<std::uint8_t, 256> table_{};
+    std::array<std::uint8_t, 16> low_{};
+    std::array<std::uint8_t, 16> high_{};
+    bool vectorizable_{true};
+  };
+
+  /**
+   * @brief Character sets used by the built-in charset rules.
+   */
+  namespace charsets
+  {
+    inline constexpr CharSet ascii = CharSet::range(0x00, 0x7F);
+    inline constexpr CharSet printable = CharSet::range(0x20, 0x7E);
+    inline constexpr CharSet digit = CharSet::range('0', '9');
+    inline constexpr CharSet alpha = CharSet::range('a', 'z') | CharSet::range('A', 'Z');
+    inline constexpr CharSet alnum = alpha | digit;
+    inline constexpr CharSet hex = digit | CharSet::range('a', 'f') | CharSet::range('A', 'F');
+    inline constexpr CharSet base64 = alnum | CharSet("+/");
+    inline constexpr CharSet base64url = alnum | CharSet("-_");
+    inline constexpr CharSet slug = CharSet::range('a', 'z') | digit | CharSet("-");
+  } // namespace charsets
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_CHAR_SET_HPP
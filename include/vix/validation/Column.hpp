@@ -0,0 +1,311 @@
+/**
+ *
+ *  @file Column.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_COLUMN_HPP
+#define VIX_VALIDATION_COLUMN_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/Rules.hpp>
+#include <vix/validation/Kernels.hpp>
+#include <vix/validation/Simd.hpp>
+#include <vix/validation/ValidationErrors.hpp>
+
+namespace vix::validation
+{
+
+  /**
+   * @class RowBitmap
+   * @brief One bit per row, 64 rows per word. A set bit marks a failing row.
+   */
+  class RowBitmap
+  {
+  public:
+    RowBitmap() = default;
+
+    explicit RowBitmap(std::size_t rows)
+        : rows_(rows), words_((rows + 63) / 64, 0)
+    {
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return rows_; }
+
+    [[nodiscard]] bool test(std::size_t row) const noexcept
+    {
+      return row < rows_ && ((words_[row / 64] >> (row % 64)) & 1u);
+    }
+
+    void set(std::size_t row) noexcept
+    {
+      words_[row / 64] |= (std::uint64_t{1} << (row % 64));
+    }
+
+    /// @brief Number of failing rows.
+    [[nodiscard]] std::size_t count() const noexcept
+    {
+      std::size_t n = 0;
+      for (std::uint64_t w : words_)
+      {
+        n += static_cast<std::size_t>(std::popcount(w));
+      }
+      return n;
+    }
+
+    [[nodiscard]] bool any() const noexcept
+    {
+      for (std::uint64_t w : words_)
+      {
+        if (w != 0)
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /// @brief Call `fn(row)` for each failing row, in ascending order.
+    template <typename Fn>
+    void for_each(Fn &&fn) const
+    {
+      for (std::size_t w = 0; w < words_.size(); ++w)
+      {
+        std::uint64_t bits = words_[w];
+        while (bits != 0)
+        {
+          fn(w * 64 + static_cast<std::size_t>(std::countr_zero(bits)));
+          bits &= bits - 1;
+        }
+      }
+    }
+
+    /// @brief Mark every row failing in `other` (same size) as failing here.
+    RowBitmap &operator|=(const RowBitmap &other) noexcept
+    {
+      for (std::size_t w = 0; w < words_.size() && w < other.words_.size(); ++w)
+      {
+        words_[w] |= other.words_[w];
+      }
+      return *this;
+    }
+
+    [[nodiscard]] const std::vector<std::uint64_t> &words() const noexcept { return words_; }
+    [[nodiscard]] std::uint64_t *data() noexcept { return words_.data(); }
+
+    friend bool operator==(const RowBitmap &, const RowBitmap &) = default;
+
+  private:
+    std::size_t rows_{0};
+    std::vector<std::uint64_t> words_;
+  };
+
+  /**
+   * @brief Column-oriented (SoA) rule kernels.
+   *
+   * Each kernel checks a whole `std::span<const T>` against one rule and
+   * returns a RowBitmap of the failing rows. The `*_into` variants then
+   * build a ValidationError only for those rows (field = column name,
+   * meta "row" = row index, plus the same meta as the scalar rule).
+   *
+   * Verdicts match rules::min / rules::max / rules::between exactly,
+   * including NaN, which never compares below or above a bound.
+   *
+   * int32_t, float and double run with SSE2 or AVX2 and int64_t with AVX2,
+   * chosen at runtime (see detected_simd_level()); other arithmetic types
+   * use the scalar loop. Pass a SimdLevel to force a path.
+   */
+  namespace column
+  {
+    namespace detail
+    {
+      /// @brief One error per failing row; `meta(row)` builds its ErrorMeta.
+      template <typename MetaFn>
+      inline void report(
+          const ErrorText &field,
+          const RowBitmap &failed,
+          ValidationErrorCode code,
+          const ErrorText &message,
+          ValidationErrors &out,
+          MetaFn &&meta)
+      {
+        out.reserve(out.size() + failed.count());
+        failed.for_each([&](std::size_t row)
+                        {
+                          if (!out.full())
+                          {
+                            out.add(field, code, message, meta(row));
+                          } });
+      }
+    } // namespace detail
+
+    /**
+     * @brief Rows where value < min_value or value > max_value.
+     */
+    template <typename T>
+    [[nodiscard]] inline RowBitmap between(
+        std::span<const T> values, T min_value, T max_value, SimdLevel level = detected_simd_level())
+    {
+      static_assert(std::is_arithmetic_v<T>, "column::between<T>: T must be arithmetic");
+      RowBitmap failed(values.size());
+      kernels::range_bits(values.data(), values.size(), min_value, max_value, failed.data(), level);
+      return failed;
+    }
+
+    /**
+     * @brief Rows where value < min_value.
+     */
+    template <typename T>
+    [[nodiscard]] inline RowBitmap min(std::span<const T> values, T min_value, SimdLevel level = detected_simd_level())
+    {
+      return column::between(values, min_value, kernels::highest<T>(), level);
+    }
+
+    /**
+     * @brief Rows where value > max_value.
+     */
+    template <typename T>
+    [[nodiscard]] inline RowBitmap max(std::span<const T> values, T max_value, SimdLevel level = detected_simd_level())
+    {
+      return column::between(values, kernels::lowest<T>(), max_value, level);
+    }
+
+    /**
+     * @brief Rows holding NaN or an infinity.
+     */
+    template <typename T>
+    [[nodiscard]] inline RowBitmap finite(std::span<const T> values, SimdLevel level = detected_simd_level())
+    {
+      static_assert(std::is_floating_point_v<T>, "column::finite<T>: T must be floating point");
+      RowBitmap failed(values.size());
+      kernels::non_finite_bits(values.data(), values.size(), failed.data(), level);
+      return failed;
+    }
+
+    /**
+     * @brief Rows holding NaN.
+     */
+    template <typename T>
+    [[nodiscard]] inline RowBitmap not_nan(std::span<const T> values, SimdLevel level = detected_simd_level())
+    {
+      static_assert(std::is_floating_point_v<T>, "column::not_nan<T>: T must be floating point");
+      RowBitmap failed(values.size());
+      kernels::nan_bits(values.data(), values.size(), failed.data(), level);
+      return failed;
+    }
+
+    /**
+     * @brief Validate a column against [min_value, max_value]; one Between
+     * error per failing row.
+     *
+     * @return The failing rows.
+     */
+    template <typename T>
+    inline RowBitmap between_into(
+        ErrorText field,
+        std::span<const T> values,
+        T min_value,
+        T max_value,
+        ValidationErrors &out,
+        ErrorText message = ErrorText::literal("value is out of range"))
+    {
+      RowBitmap failed = column::between(values, min_value, max_value);
+      detail::report(field, failed, ValidationErrorCode::Between, message, out, [&](std::size_t row)
+                     { return rules::detail::meta_kv({{"row", row},
+                                                      {"min", rules::detail::meta_value(min_value)},
+                                                      {"max", rules::detail::meta_value(max_value)},
+                                                      {"got", rules::detail::meta_value(values[row])}}); });
+      return failed;
+    }
+
+    /**
+     * @brief Validate a column against a lower bound; one Min error per failing row.
+     */
+    template <typename T>
+    inline RowBitmap min_into(
+        ErrorText field,
+        std::span<const T> values,
+        T min_value,
+        ValidationErrors &out,
+        ErrorText message = ErrorText::literal("value is below minimum"))
+    {
+      RowBitmap failed = column::min(values, min_value);
+      detail::report(field, failed, ValidationErrorCode::Min, message, out, [&](std::size_t row)
+                     { return rules::detail::meta_kv({{"row", row},
+                                                      {"min", rules::detail::meta_value(min_value)},
+                                                      {"got", rules::detail::meta_value(values[row])}}); });
+      return failed;
+    }
+
+    /**
+     * @brief Validate a column against an upper bound; one Max error per failing row.
+     */
+    template <typename T>
+    inline RowBitmap max_into(
+        ErrorText field,
+        std::span<const T> values,
+        T max_value,
+        ValidationErrors &out,
+        ErrorText message = ErrorText::literal("value is above maximum"))
+    {
+      RowBitmap failed = column::max(values, max_value);
+      detail::report(field, failed, ValidationErrorCode::Max, message, out, [&](std::size_t row)
+                     { return rules::detail::meta_kv({{"row", row},
+                                                      {"max", rules::detail::meta_value(max_value)},
+                                                      {"got", rules::detail::meta_value(values[row])}}); });
+      return failed;
+    }
+
+    /**
+     * @brief Reject NaN and infinities; one Format error per failing row.
+     */
+    template <typename T>
+    inline RowBitmap finite_into(
+        ErrorText field,
+        std::span<const T> values,
+        ValidationErrors &out,
+        ErrorText message = ErrorText::literal("value is not finite"))
+    {
+      RowBitmap failed = column::finite(values);
+      detail::report(field, failed, ValidationErrorCode::Format, message, out, [&](std::size_t row)
+                     { return rules::detail::meta_kv({{"row", row},
+                                                      {"got", rules::detail::meta_value(values[row])}}); });
+      return failed;
+    }
+
+    /**
+     * @brief Reject NaN; one Format error per failing row.
+     */
+    template <typename T>
+    inline RowBitmap not_nan_into(
+        ErrorText field,
+        std::span<const T> values,
+        ValidationErrors &out,
+        ErrorText message = ErrorText::literal("value is NaN"))
+    {
+      RowBitmap failed = column::not_nan(values);
+      detail::report(field, failed, ValidationErrorCode::Format, message, out, [&](std::size_t row)
+                     { return rules::detail::meta_kv({{"row", row},
+                                                      {"got", rules::detail::meta_value(values[row])}}); });
+      return failed;
+    }
+  } // namespace column
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_COLUMN_HPP
@@ -0,0 +1,305 @@
+/**
+ *
+ *  @file ErrorMeta.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_ERROR_META_HPP
+#define VIX_VALIDATION_ERROR_META_HPP
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/ErrorText.hpp>
+#include <vix/validation/MetaValue.hpp>
+
+namespace vix::validation
+{
+
+  /**
+   * @class ErrorMeta
+   * @brief Small key/value metadata attached to a ValidationError.
+   *
+   * Built-in rules attach two or three entries ("min", "got", ...), so the
+   * first `inline_capacity` entries live inside the error itself; more
+   * entries spill to a heap vector. Keys are ErrorText (literal keys cost
+   * nothing) and values are typed MetaValue, formatted only when read.
+   *
+   * The API mirrors the subset of std::unordered_map that callers use
+   * (`count`, `contains`, `at`, `find`, `emplace`, `operator[]`,
+   * iteration). Use `to_map()` when an owning map is really needed.
+   */
+  class ErrorMeta
+  {
+  public:
+    using key_type = ErrorText;
+    using mapped_type = MetaValue;
+
+    struct Entry
+    {
+      ErrorText first;
+      MetaValue second;
+    };
+
+    using value_type = Entry;
+
+    static constexpr std::size_t inline_capacity = 3;
+
+    template <bool Const>
+    class basic_iterator
+    {
+    public:
+      using owner_type = std::conditional_t<Const, const ErrorMeta, ErrorMeta>;
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = Entry;
+      using difference_type = std::ptrdiff_t;
+      using pointer = std::conditional_t<Const, const Entry *, Entry *>;
+      using reference = std::conditional_t<Const, const Entry &, Entry &>;
+
+      basic_iterator() noexcept = default;
+      basic_iterator(owner_type *owner, std::size_t i) noexcept : owner_(owner), i_(i) {}
+
+      reference operator*() const noexcept { return owner_->entry(i_); }
+      pointer operator->() const noexcept { return &owner_->entry(i_); }
+
+      basic_iterator &operator++() noexcept
+      {
+        ++i_;
+        return *this;
+      }
+
+      basic_iterator operator++(int) noexcept
+      {
+        basic_iterator tmp = *this;
+        ++i_;
+        return tmp;
+      }
+
+      friend bool operator==(const basic_iterator &a, const basic_iterator &b) noexcept
+      {
+        return a.i_ == b.i_;
+      }
+
+    private:
+      owner_type *owner_{nullptr};
+      std::size_t i_{0};
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    ErrorMeta() noexcept = default;
+
+    ErrorMeta(const ErrorMeta &other)
+        : inline_(other.inline_),
+          size_(other.size_),
+          spill_(other.spill_ ? std::make_unique<std::vector<Entry>>(*other.spill_) : nullptr)
+    {
+    }
+
+    ErrorMeta(ErrorMeta &&) noexcept = default;
+
+    ErrorMeta &operator=(const ErrorMeta &other)
+    {
+      if (this != &other)
+      {
+        ErrorMeta tmp(other);
+        *this = std::move(tmp);
+      }
+      return *this;
+    }
+
+    ErrorMeta &operator=(ErrorMeta &&) noexcept = default;
+
+    // Observers
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] const MetaValue *find_value(std::string_view key) const noexcept
+    {
+      for (std::size_t i = 0; i < size_; ++i)
+      {
+        const Entry &e = entry(i);
+        if (e.first == key)
+        {
+          return &e.second;
+        }
+      }
+      return nullptr;
+    }
+
+    [[nodiscard]] const_iterator find(std::string_view key) const noexcept
+    {
+      for (std::size_t i = 0; i < size_; ++i)
+      {
+        if (entry(i).first == key)
+        {
+          return const_iterator(this, i);
+        }
+      }
+      return end();
+    }
+
+    [[nodiscard]] bool contains(std::string_view key) const noexcept
+    {
+      return find_value(key) != nullptr;
+    }
+
+    [[nodiscard]] std::size_t count(std::string_view key) const noexcept
+    {
+      return contains(key) ? 1u : 0u;
+    }
+
+    /// @brief Value for `key`; throws std::out_of_range if absent (like map::at).
+    [[nodiscard]] const MetaValue &at(std::string_view key) const
+    {
+      const MetaValue *v = find_value(key);
+      if (!v)
+      {
+        throw std::out_of_range("vix::validation::ErrorMeta::at: missing key");
+      }
+      return *v;
+    }
+
+    // Modifiers
+
+    /**
+     * @brief Insert or replace `key`.
+     *
+     * Pass keys as `ErrorText::literal("...")` to avoid copying them.
+     */
+    void set(ErrorText key, MetaValue value)
+    {
+      for (std::size_t i = 0; i < size_; ++i)
+      {
+        Entry &e = entry(i);
+        if (e.first == key.view())
+        {
+          e.second = std::move(value);
+          return;
+        }
+      }
+
+      append(std::move(key), std::move(value));
+    }
+
+    /**
+     * @brief Insert `key` if absent (like map::emplace).
+     * @return the entry for `key` and whether it was inserted
+     */
+    std::pair<iterator, bool> emplace(ErrorText key, MetaValue value)
+    {
+      for (std::size_t i = 0; i < size_; ++i)
+      {
+        if (entry(i).first == key.view())
+        {
+          return {iterator(this, i), false};
+        }
+      }
+
+      append(std::move(key), std::move(value));
+      return {iterator(this, size_ - 1), true};
+    }
+
+    /// @brief Value for `key`, inserted empty if absent (like map::operator[]).
+    MetaValue &operator[](ErrorText key)
+    {
+      return emplace(std::move(key), MetaValue{}).first->second;
+    }
+
+    void clear() noexcept
+    {
+      for (std::size_t i = 0; i < size_ && i < inline_capacity; ++i)
+      {
+        inline_[i] = Entry{};
+      }
+      spill_.reset();
+      size_ = 0;
+    }
+
+    /// @brief Owning copy as a standard map (allocates; for serialization/legacy code).
+    [[nodiscard]] std::unordered_map<std::string, std::string> to_map() const
+    {
+      std::unordered_map<std::string, std::string> out;
+      out.reserve(size_);
+      for (const Entry &e : *this)
+      {
+        out.emplace(e.first.str(), e.second.str());
+      }
+      return out;
+    }
+
+    /// @brief Build from a standard map (copies every key and value).
+    [[nodiscard]] static ErrorMeta from_map(const std::unordered_map<std::string, std::string> &m)
+    {
+      ErrorMeta out;
+      for (const auto &[k, v] : m)
+      {
+        out.set(ErrorText(k), MetaValue(v));
+      }
+      return out;
+    }
+
+    // Iteration
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size_); }
+
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+  private:
+    template <bool>
+    friend class basic_iterator;
+
+    void append(ErrorText key, MetaValue value)
+    {
+      if (size_ < inline_capacity)
+      {
+        inline_[size_] = Entry{std::move(key), std::move(value)};
+      }
+      else
+      {
+        if (!spill_)
+        {
+          spill_ = std::make_unique<std::vector<Entry>>();
+        }
+        spill_->push_back(Entry{std::move(key), std::move(value)});
+      }
+      ++size_;
+    }
+
+    Entry &entry(std::size_t i) noexcept
+    {
+      return i < inline_capacity ? inline_[i] : (*spill_)[i - inline_capacity];
+    }
+
+    const Entry &entry(std::size_t i) const noexcept
+    {
+      return i < inline_capacity ? inline_[i] : (*spill_)[i - inline_capacity];
+    }
+
+    std::array<Entry, inline_capacity> inline_{};
+    std::size_t size_{0};
+    std::unique_ptr<std::vector<Entry>> spill_;
+  };
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_ERROR_META_HPP
@@ -0,0 +1,290 @@
+/**
+ *
+ *  @file ErrorSink.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_ERROR_SINK_HPP
+#define VIX_VALIDATION_ERROR_SINK_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/ValidationError.hpp>
+#include <vix/validation/ValidationPolicy.hpp>
+
+namespace vix::validation
+{
+
+  /**
+   * @brief Destination for validation errors.
+   *
+   * A sink receives errors one at a time through `add(ValidationError&&)`.
+   * It may also expose `bool full() const`: once it returns true, the
+   * schema or validator feeding the sink stops early.
+   *
+   * ValidationErrors is a sink; so are the built-in sinks below.
+   */
+  template <typename S>
+  concept ErrorSink = requires(S &s, ValidationError &&e) {
+    s.add(std::move(e));
+  };
+
+  namespace detail
+  {
+    template <typename S>
+    [[nodiscard]] bool sink_full(const S &s) noexcept
+    {
+      if constexpr (requires { { s.full() } -> std::convertible_to<bool>; })
+      {
+        return static_cast<bool>(s.full());
+      }
+      else
+      {
+        return false;
+      }
+    }
+  } // namespace detail
+
+  /**
+   * @class ErrorSinkRef
+   * @brief Non-owning, type-erased reference to an ErrorSink.
+   *
+   * Two function pointers and an object pointer; used where a concrete
+   * sink type cannot be a template parameter (schema checks, Rule<T>).
+   * The referenced sink must outlive the ErrorSinkRef.
+   */
+  class ErrorSinkRef
+  {
+  public:
+    template <ErrorSink S>
+      requires(!std::is_same_v<std::remove_cvref_t<S>, ErrorSinkRef>)
+    ErrorSinkRef(S &sink) noexcept
+        : obj_(static_cast<void *>(&sink)),
+          add_([](void *o, ValidationError &&e)
+               { static_cast<S *>(o)->add(std::move(e)); }),
+          full_([](const void *o) noexcept
+                { return detail::sink_full(*static_cast<const S *>(o)); })
+    {
+    }
+
+    void add(ValidationError &&e) const
+    {
+      add_(obj_, std::move(e));
+    }
+
+    [[nodiscard]] bool full() const noexcept
+    {
+      return full_(obj_);
+    }
+
+  private:
+    void *obj_;
+    void (*add_)(void *, ValidationError &&);
+    bool (*full_)(const void *) noexcept;
+  };
+
+  /**
+   * @brief Counts errors and discards them.
+   *
+   * Useful to know how many errors an input has without storing them.
+   */
+  struct CountingSink
+  {
+    std::size_t count{0};
+
+    void add(ValidationError &&) noexcept
+    {
+      ++count;
+    }
+  };
+
+  /**
+   * @brief Keeps the first N errors, then reports itself full.
+   *
+   * Validation stops once `limit` errors were received, so a request with
+   * thousands of bad rows only pays for the errors it will report.
+   */
+  class FirstNSink
+  {
+  public:
+    explicit FirstNSink(std::size_t limit)
+        : limit_(limit)
+    {
+      errors_.reserve(limit);
+    }
+
+    void add(ValidationError &&e)
+    {
+      if (errors_.size() < limit_)
+      {
+        errors_.push_back(std::move(e));
+      }
+    }
+
+    [[nodiscard]] bool full() const noexcept { return errors_.size() >= limit_; }
+
+    [[nodiscard]] const std::vector<ValidationError> &errors() const noexcept { return errors_; }
+    [[nodiscard]] std::size_t limit() const noexcept { return limit_; }
+
+  private:
+    std::size_t limit_;
+    std::vector<ValidationError> errors_;
+  };
+
+  /**
+   * @brief Records which fields failed as a 64-bit mask.
+   *
+   * Bit i is set when an error is reported for `fields[i]`. Errors for
+   * fields outside the list set `other()`. The field names are borrowed
+   * and must outlive the sink.
+   */
+  class FieldMaskSink
+  {
+  public:
+    static constexpr std::size_t max_fields = 64;
+
+    FieldMaskSink(std::initializer_list<std::string_view> fields)
+        : fields_(fields)
+    {
+      if (fields_.size() > max_fields)
+      {
+        fields_.resize(max_fields);
+      }
+    }
+
+    void add(ValidationError &&e) noexcept
+    {
+      const std::string_view field = e.field.view();
+      for (std::size_t i = 0; i < fields_.size(); ++i)
+      {
+        if (fields_[i] == field)
+        {
+          mask_ |= (std::uint64_t{1} << i);
+          return;
+        }
+      }
+      other_ = true;
+    }
+
+    [[nodiscard]] std::uint64_t mask() const noexcept { return mask_; }
+    [[nodiscard]] bool other() const noexcept { return other_; }
+    [[nodiscard]] bool any() const noexcept { return mask_ != 0 || other_; }
+
+    [[nodiscard]] bool failed(std::string_view field) const noexcept
+    {
+      for (std::size_t i = 0; i < fields_.size(); ++i)
+      {
+        if (fields_[i] == field)
+        {
+          return (mask_ >> i) & 1u;
+        }
+      }
+      return false;
+    }
+
+  private:
+    std::vector<std::string_view> fields_;
+    std::uint64_t mask_{0};
+    bool other_{false};
+  };
+
+  /**
+   * @brief Hands every error to a callable, e.g. to serialize it directly
+   * into a response buffer without storing it.
+   *
+   * The callable receives `const ValidationError&`.
+   */
+  template <typename Fn>
+  class CallbackSink
+  {
+  public:
+    explicit CallbackSink(Fn fn)
+        : fn_(std::move(fn))
+    {
+    }
+
+    void add(ValidationError &&e)
+    {
+      fn_(static_cast<const ValidationError &>(e));
+    }
+
+  private:
+    Fn fn_;
+  };
+
+  template <typename Fn>
+  CallbackSink(Fn) -> CallbackSink<Fn>;
+
+  namespace detail
+  {
+    /**
+     * @brief Applies a ValidationPolicy in front of a sink.
+     *
+     * Errors that already reached a sink cannot be taken back, so schema
+     * policies are enforced here, as errors arrive.
+     */
+    template <ErrorSink S>
+    class PolicySink
+    {
+    public:
+      PolicySink(S &inner, ValidationPolicy policy) noexcept
+          : inner_(inner), policy_(policy)
+      {
+      }
+
+      void add(ValidationError &&e)
+      {
+        if (policy_ == ValidationPolicy::FailFast)
+        {
+          if (stopped_)
+          {
+            return;
+          }
+          stopped_ = true;
+        }
+        else if (policy_ == ValidationPolicy::FirstErrorPerField)
+        {
+          for (const ErrorText &f : seen_)
+          {
+            if (f == e.field.view())
+            {
+              return;
+            }
+          }
+          seen_.push_back(e.field);
+        }
+
+        inner_.add(std::move(e));
+      }
+
+      [[nodiscard]] bool full() const noexcept
+      {
+        return stopped_ || sink_full(inner_);
+      }
+
+    private:
+      S &inner_;
+      ValidationPolicy policy_;
+      bool stopped_{false};
+      std::vector<ErrorText> seen_;
+    };
+  } // namespace detail
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_ERROR_SINK_HPP
@@ -0,0 +1,294 @@
+/**
+ *
+ *  @file ErrorText.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_ERROR_TEXT_HPP
+#define VIX_VALIDATION_ERROR_TEXT_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace vix::validation
+{
+
+  namespace detail
+  {
+    /**
+     * @brief Header of a shared, immutable, null-terminated text buffer.
+     *
+     * The characters follow the header in the same allocation. Owners keep
+     * a pointer to the header and derive the characters from it, never the
+     * other way around.
+     */
+    struct TextBlock
+    {
+      std::atomic<std::uint32_t> refs;
+      std::uint32_t size;
+    };
+
+    [[nodiscard]] inline const char *text_chars(const TextBlock *block) noexcept
+    {
+      return reinterpret_cast<const char *>(block + 1);
+    }
+
+    /// @brief Allocate a shared copy of `s` (refcount = 1).
+    [[nodiscard]] inline TextBlock *text_alloc(std::string_view s)
+    {
+      if (s.size() >= std::numeric_limits<std::uint32_t>::max())
+      {
+        throw std::length_error("vix::validation::ErrorText: text too long");
+      }
+
+      void *mem = ::operator new(sizeof(TextBlock) + s.size() + 1);
+      auto *block = ::new (mem) TextBlock{{1u}, static_cast<std::uint32_t>(s.size())};
+      char *chars = reinterpret_cast<char *>(block) + sizeof(TextBlock);
+      if (!s.empty())
+      {
+        std::memcpy(chars, s.data(), s.size());
+      }
+      chars[s.size()] = '\0';
+      return block;
+    }
+
+    inline void text_retain(TextBlock *block) noexcept
+    {
+      block->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    inline void text_release(TextBlock *block) noexcept
+    {
+      if (block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        block->~TextBlock();
+        ::operator delete(static_cast<void *>(block));
+      }
+    }
+  } // namespace detail
+
+  class MetaValue;
+
+  /**
+   * @class ErrorText
+   * @brief Compact, immutable text used for error fields, messages and meta.
+   *
+   * An ErrorText is 16 bytes and is either:
+   * - borrowed: a view of storage that outlives every error (string literals,
+   *   see `ErrorText::literal`), never allocated nor freed
+   * - shared: a reference-counted copy; copying the ErrorText only bumps
+   *   an atomic counter, so one message can back thousands of errors
+   *
+   * Constructing from `const char*`, `std::string` or `std::string_view`
+   * always makes a shared copy, which is safe for any input.
+   *
+   * It behaves like a read-only string view: compare it with strings,
+   * stream it, or call `view()` / `str()`. It also converts implicitly to
+   * std::string (a copy), as the former std::string fields did.
+   */
+  class ErrorText
+  {
+  public:
+    ErrorText() noexcept = default;
+
+    ErrorText(const char *s)
+        : ErrorText(std::string_view(s ? s : ""))
+    {
+    }
+
+    ErrorText(const std::string &s)
+        : ErrorText(std::string_view(s))
+    {
+    }
+
+    ErrorText(std::string_view s)
+    {
+      if (!s.empty())
+      {
+        ptr_.block = detail::text_alloc(s);
+        size_ = static_cast<std::uint32_t>(s.size());
+        shared_ = true;
+      }
+    }
+
+    ErrorText(const ErrorText &other) noexcept
+        : ptr_(other.ptr_), size_(other.size_), shared_(other.shared_)
+    {
+      if (shared_)
+      {
+        detail::text_retain(ptr_.block);
+      }
+    }
+
+    ErrorText(ErrorText &&other) noexcept
+        : ptr_(other.ptr_), size_(other.size_), shared_(other.shared_)
+    {
+      other.ptr_.chars = "";
+      other.size_ = 0;
+      other.shared_ = false;
+    }
+
+    ErrorText &operator=(const ErrorText &other) noexcept
+    {
+      ErrorText tmp(other);
+      swap(tmp);
+      return *this;
+    }
+
+    ErrorText &operator=(ErrorText &&other) noexcept
+    {
+      ErrorText tmp(std::move(other));
+      swap(tmp);
+      return *this;
+    }
+
+    ~ErrorText()
+    {
+      if (shared_)
+      {
+        detail::text_release(ptr_.block);
+      }
+    }
+
+    /**
+     * @brief Borrow a string literal (no allocation, no ownership).
+     */
+    template <std::size_t N>
+    [[nodiscard]] static ErrorText literal(const char (&s)[N]) noexcept
+    {
+      return borrowed(std::string_view(s, N - 1));
+    }
+
+    /**
+     * @brief Borrow storage the caller guarantees to outlive every copy.
+     */
+    [[nodiscard]] static ErrorText borrowed(std::string_view s) noexcept
+    {
+      ErrorText t;
+      t.ptr_.chars = s.data();
+      t.size_ = static_cast<std::uint32_t>(s.size());
+      return t;
+    }
+
+    void swap(ErrorText &other) noexcept
+    {
+      std::swap(ptr_, other.ptr_);
+      std::swap(size_, other.size_);
+      std::swap(shared_, other.shared_);
+    }
+
+    [[nodiscard]] std::string_view view() const noexcept { return {data(), size_}; }
+    [[nodiscard]] std::string str() const { return std::string(data(), size_); }
+
+    operator std::string_view() const noexcept { return view(); }
+
+    /// @brief Implicit copy, so code written against std::string fields keeps compiling.
+    operator std::string() const { return str(); }
+
+    [[nodiscard]] const char *data() const noexcept
+    {
+      return shared_ ? detail::text_chars(ptr_.block) : ptr_.chars;
+    }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /// @brief True if this text owns a shared (heap) copy.
+    [[nodiscard]] bool is_shared() const noexcept { return shared_; }
+
+    friend bool operator==(const ErrorText &a, std::string_view b) noexcept
+    {
+      return a.view() == b;
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const ErrorText &t)
+    {
+      return os << t.view();
+    }
+
+  private:
+    friend class MetaValue;
+
+    /// Borrowed characters, or the header of a shared block.
+    union Ptr
+    {
+      const char *chars;
+      detail::TextBlock *block;
+    };
+
+    Ptr ptr_{""};
+    std::uint32_t size_{0};
+    bool shared_{false};
+  };
+
+  namespace detail
+  {
+    /**
+     * @brief Thread-local "current field" published by Schema while a field runs.
+     *
+     * Rules only receive the field name as std::string_view. When that view
+     * is the one published here, the error can share the schema's ErrorText
+     * instead of copying the name.
+     */
+    inline const ErrorText *&current_field_slot() noexcept
+    {
+      thread_local const ErrorText *slot = nullptr;
+      return slot;
+    }
+
+    /// @brief RAII publisher for current_field_slot().
+    class FieldNameScope
+    {
+    public:
+      explicit FieldNameScope(const ErrorText &name) noexcept
+          : previous_(current_field_slot())
+      {
+        current_field_slot() = &name;
+      }
+
+      FieldNameScope(const FieldNameScope &) = delete;
+      FieldNameScope &operator=(const FieldNameScope &) = delete;
+
+      ~FieldNameScope()
+      {
+        current_field_slot() = previous_;
+      }
+
+    private:
+      const ErrorText *previous_;
+    };
+
+    /**
+     * @brief Field text for an error: shares the current schema field name
+     * when `field` is that exact view, otherwise makes a copy.
+     */
+    [[nodiscard]] inline ErrorText field_text(std::string_view field)
+    {
+      const ErrorText *current = current_field_slot();
+      if (current && current->data() == field.data() && current->size() == field.size())
+      {
+        return *current;
+      }
+      return ErrorText(field);
+    }
+  } // namespace detail
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_ERROR_TEXT_HPP
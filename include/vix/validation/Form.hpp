@@ -15,7 +15,10 @@
 #ifndef VIX_VALIDATION_FORM_HPP
 #define VIX_VALIDATION_FORM_HPP
 
+#include <cstdint>
+#include <initializer_list>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -23,8 +26,12 @@
 #include <vector>
 
 #include <vix/validation/Schema.hpp>
+#include <vix/validation/Multipart.hpp>
+#include <vix/validation/StringSet.hpp>
+#include <vix/validation/UrlEncoded.hpp>
 #include <vix/validation/ValidationError.hpp>
 #include <vix/validation/ValidationErrors.hpp>
+#include <vix/validation/ValidationPolicy.hpp>
 #include <vix/validation/ValidationResult.hpp>
 
 namespace vix::validation
@@ -116,6 +123,64 @@ namespace vix::validation
     template <typename Derived>
     inline constexpr bool has_kv_set_v = has_kv_set<Derived>::value;
 
+    /**
+     * @brief Detects: static FormFields<Derived> fields().
+     *
+     * Declarative KV binding table (see FormFields).
+     */
+    template <typename Derived, typename = void>
+    struct has_form_fields : std::false_type
+    {
+    };
+
+    template <typename Derived>
+    struct has_form_fields<Derived, std::void_t<decltype(Derived::fields())>> : std::true_type
+    {
+    };
+
+    template <typename Derived>
+    inline constexpr bool has_form_fields_v = has_form_fields<Derived>::value;
+
+    /**
+     * @brief Detects: static bool file(Derived&, const MultipartPart&, std::string_view).
+     *
+     * Receiver of uploaded file bytes (see Form::MultipartBinder).
+     */
+    template <typename Derived, typename = void>
+    struct has_form_file : std::false_type
+    {
+    };
+
+    template <typename Derived>
+    struct has_form_file<Derived, std::void_t<decltype(Derived::file(
+                                      std::declval<Derived &>(),
+                                      std::declval<const MultipartPart &>(),
+                                      std::declval<std::string_view>()))>> : std::true_type
+    {
+    };
+
+    template <typename Derived>
+    inline constexpr bool has_form_file_v = has_form_file<Derived>::value;
+
+    /**
+     * @brief Detects: static void reset(Derived&).
+     *
+     * Puts a reused form back in its initial state (see Form::validate_into).
+     */
+    template <typename Derived, typename = void>
+    struct has_form_reset : std::false_type
+    {
+    };
+
+    template <typename Derived>
+    struct has_form_reset<Derived, std::void_t<decltype(Derived::reset(
+                                       std::declval<Derived &>()))>> : std::true_type
+    {
+    };
+
+    template <typename Derived>
+    inline constexpr bool has_form_reset_v = has_form_reset<Derived>::value;
+
     /**
      * @brief Detect KV input type: std::vector<std::pair<std::string_view, std::string_view>>.
      */
@@ -154,6 +219,23 @@ namespace vix::validation
     template <typename Derived>
     inline constexpr bool has_clean_method_v = has_clean_method<Derived>::value;
 
+    /**
+     * @brief Detects `void clean(Clean &out) const`, which completes a
+     * cleaned value pre-filled by the schema.
+     */
+    template <typename Derived, typename Clean, typename = void>
+    struct has_clean_into_method : std::false_type
+    {
+    };
+
+    template <typename Derived, typename Clean>
+    struct has_clean_into_method<Derived, Clean, std::void_t<decltype(std::declval<const Derived &>().clean(std::declval<Clean &>()))>> : std::true_type
+    {
+    };
+
+    template <typename Derived, typename Clean>
+    inline constexpr bool has_clean_into_method_v = has_clean_into_method<Derived, Clean>::value;
+
     /**
      * @brief Lazy selection of the cleaned output type.
      *
@@ -183,7 +265,7 @@ namespace vix::validation
      * detailed errors.
      */
     [[nodiscard]] inline ValidationError make_form_error(
-        std::string message = "invalid input",
+        ErrorText message = ErrorText::literal("invalid input"),
         ValidationErrorCode code = ValidationErrorCode::Format)
     {
       return ValidationError{
@@ -194,6 +276,244 @@ namespace vix::validation
 
   } // namespace detail
 
+  /**
+   * @class FormField
+   * @brief One entry of a FormFields table: an input key and the member
+   * that receives its value.
+   *
+   * Supported members: std::string, std::optional<std::string> (set when
+   * the key is present) and std::string_view (borrows the input, which
+   * must then outlive the form).
+   */
+  template <typename Derived>
+  class FormField
+  {
+  public:
+    constexpr FormField(std::string_view key, std::string Derived::*member) noexcept
+        : key_(key), kind_(Kind::String), string_(member)
+    {
+    }
+
+    constexpr FormField(std::string_view key, std::optional<std::string> Derived::*member) noexcept
+        : key_(key), kind_(Kind::Optional), optional_(member)
+    {
+    }
+
+    constexpr FormField(std::string_view key, std::string_view Derived::*member) noexcept
+        : key_(key), kind_(Kind::View), view_(member)
+    {
+    }
+
+    [[nodiscard]] constexpr std::string_view key() const noexcept
+    {
+      return key_;
+    }
+
+    void assign(Derived &out, std::string_view value) const
+    {
+      switch (kind_)
+      {
+      case Kind::String:
+        (out.*string_).assign(value);
+        break;
+      case Kind::Optional:
+        (out.*optional_).emplace(value);
+        break;
+      case Kind::View:
+        out.*view_ = value;
+        break;
+      }
+    }
+
+    /**
+     * @brief Give the member back the value it has in `defaults`.
+     *
+     * A std::string is assigned in place and keeps its capacity.
+     */
+    void reset(Derived &out, const Derived &defaults) const
+    {
+      switch (kind_)
+      {
+      case Kind::String:
+        (out.*string_).assign(defaults.*string_);
+        break;
+      case Kind::Optional:
+        if (!(defaults.*optional_))
+        {
+          (out.*optional_).reset();
+        }
+        else if (out.*optional_)
+        {
+          (out.*optional_)->assign(*(defaults.*optional_));
+        }
+        else
+        {
+          (out.*optional_).emplace(*(defaults.*optional_));
+        }
+        break;
+      case Kind::View:
+        out.*view_ = defaults.*view_;
+        break;
+      }
+    }
+
+  private:
+    enum class Kind : std::uint8_t
+    {
+      String,
+      Optional,
+      View
+    };
+
+    std::string_view key_;
+    Kind kind_;
+    std::string Derived::*string_{nullptr};
+    std::optional<std::string> Derived::*optional_{nullptr};
+    std::string_view Derived::*view_{nullptr};
+  };
+
+  /**
+   * @class FormFields
+   * @brief Declarative KV binding table for Form.
+   *
+   * Replaces a hand-written `set()` (a chain of key comparisons) or a
+   * `bind()` that scans the input once per field. The keys are indexed
+   * once, in a StringSet (a perfect hash for large forms), so each input
+   * pair costs one lookup and binding is linear in the number of pairs.
+   *
+   * @code
+   * static vix::validation::FormFields<RegisterForm> fields()
+   * {
+   *   return {{"email", &RegisterForm::email},
+   *           {"password", &RegisterForm::password}};
+   * }
+   * @endcode
+   *
+   * `Form<Derived>` builds the table once, like the schema. A repeated key
+   * keeps its last value. Unknown keys fail binding with a "__form__"
+   * error unless ignore_unknown() is set.
+   *
+   * @throws std::invalid_argument if two entries share a key.
+   */
+  template <typename Derived>
+  class FormFields
+  {
+  public:
+    FormFields(std::initializer_list<FormField<Derived>> fields)
+        : keys_(keys_of(fields))
+    {
+      if (keys_.size() != fields.size())
+      {
+        throw std::invalid_argument("vix::validation::FormFields: duplicate key");
+      }
+
+      // Store the entries in the set's layout order: find() is the index.
+      fields_.reserve(fields.size());
+      for (std::size_t i = 0; i < keys_.size(); ++i)
+      {
+        for (const FormField<Derived> &f : fields)
+        {
+          if (f.key() == keys_.key(i))
+          {
+            fields_.push_back(f);
+            break;
+          }
+        }
+      }
+    }
+
+    /// @brief Skip keys that match no field instead of failing.
+    FormFields &ignore_unknown(bool ignore = true) &
+    {
+      ignore_unknown_ = ignore;
+      return *this;
+    }
+
+    [[nodiscard]] FormFields &&ignore_unknown(bool ignore = true) &&
+    {
+      ignore_unknown_ = ignore;
+      return std::move(*this);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+      return fields_.size();
+    }
+
+    /// @brief Entry for `key`, or nullptr.
+    [[nodiscard]] const FormField<Derived> *find(std::string_view key) const noexcept
+    {
+      const std::size_t i = keys_.find(key);
+      return i == StringSet::npos ? nullptr : &fields_[i];
+    }
+
+    /**
+     * @brief Assign every (key, value) pair of `in` to its member.
+     *
+     * On an unknown key, adds a form-level error (when `errors` is
+     * non-null) and returns false, unless unknown keys are ignored.
+     */
+    template <typename Pairs>
+    bool bind(Derived &out, const Pairs &in, ValidationErrors *errors = nullptr) const
+    {
+      for (const auto &kv : in)
+      {
+        if (!bind_pair(out, std::string_view(kv.first), std::string_view(kv.second), errors))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /// @brief One pair of bind(): assign, skip, or report an unknown key.
+    bool bind_pair(Derived &out, std::string_view key, std::string_view value,
+                   ValidationErrors *errors = nullptr) const
+    {
+      if (const FormField<Derived> *f = find(key))
+      {
+        f->assign(out, value);
+        return true;
+      }
+      if (ignore_unknown_)
+      {
+        return true;
+      }
+      if (errors)
+      {
+        errors->add(detail::make_form_error(
+            "unknown or invalid field: " + std::string(key),
+            ValidationErrorCode::Format));
+      }
+      return false;
+    }
+
+    /// @brief Reset every bound member of `out` to its value in `defaults`.
+    void reset(Derived &out, const Derived &defaults) const
+    {
+      for (const FormField<Derived> &f : fields_)
+      {
+        f.reset(out, defaults);
+      }
+    }
+
+  private:
+    static StringSet keys_of(std::initializer_list<FormField<Derived>> fields)
+    {
+      std::vector<std::string_view> keys;
+      keys.reserve(fields.size());
+      for (const FormField<Derived> &f : fields)
+      {
+        keys.push_back(f.key());
+      }
+      return StringSet(keys);
+    }
+
+    StringSet keys_;
+    std::vector<FormField<Derived>> fields_;
+    bool ignore_unknown_{false};
+  };
+
   /**
    * @class FormResult
    * @brief Value-or-errors result returned by `Form<Derived>::validate(...)`.
@@ -299,10 +619,23 @@ namespace vix::validation
    *   `static bool bind(Derived &out, const Input &in, ValidationErrors &errors);`
    * - Alternative:
    *   `static bool bind(Derived &out, const Input &in);`
+   * - KV input, declarative:
+   *   `static vix::validation::FormFields<Derived> fields();`
+   * - KV input, by hand:
+   *   `static bool set(Derived &out, std::string_view key, std::string_view value);`
+   *
+   * File uploads (optional, multipart input):
+   * - `static bool file(Derived &out, const MultipartPart &part, std::string_view bytes);`
+   *
+   * Reuse (optional, see validate_into()):
+   * - `static void reset(Derived &out);`
    *
    * Clean output (optional):
-   * - If you define `using cleaned_type = X;` you should implement:
-   *   `X clean() const;`
+   * - If you define `using cleaned_type = X;` either implement
+   *   `X clean() const;`, or register schema entries with an output member
+   *   (`.parsed<int>("age", &Derived::age, spec, &X::age)`): the schema then
+   *   fills X with the values it already parsed and checked, and an optional
+   *   `void clean(X &out) const;` completes the rest.
    * - Otherwise, the validated output is simply `Derived`.
    *
    * @section form_caching Schema caching
@@ -331,6 +664,7 @@ namespace vix::validation
      *
      * @tparam Input Raw input type supported by `Derived::bind(...)`
      * @param in Input payload (kv pairs, JSON-like, request body, etc.)
+     * @param policy How many schema errors to collect (see ValidationPolicy).
      * @return FormResult<cleaned_type>
      *
      * @code
@@ -342,81 +676,360 @@ namespace vix::validation
      * @endcode
      */
     template <typename Input>
-    [[nodiscard]] static FormResult<cleaned_type> validate(const Input &in)
+    [[nodiscard]] static FormResult<cleaned_type> validate(
+        const Input &in,
+        ValidationPolicy policy = ValidationPolicy::AllErrors)
     {
       ValidationErrors errors;
       Derived form{};
 
       // 1) Bind input -> form
-      if constexpr (detail::has_bind3_v<Derived, Input>)
+      if (!bind_input(form, in, &errors))
+      {
+        return FormResult<cleaned_type>(std::move(errors));
+      }
+
+      // 2) + 3) Validate and produce the output
+      return check(form, std::move(errors), policy);
+    }
+
+    /**
+     * @brief Bind and validate an application/x-www-form-urlencoded body.
+     *
+     * The body is tokenized in one pass and each pair goes straight to the
+     * binder (`Derived::fields()` or `Derived::set()`), with no intermediate
+     * vector. Only keys and values containing '%' or '+' are decoded, into a
+     * scratch arena; the others are views of `body`. A malformed escape
+     * fails with a "__form__" Format error, reason "invalid_escape" and the
+     * byte "offset".
+     *
+     * @see UrlEncodedBinder to validate a body as its chunks arrive.
+     */
+    [[nodiscard]] static FormResult<cleaned_type> validate_urlencoded(
+        std::string_view body,
+        ValidationPolicy policy = ValidationPolicy::AllErrors)
+    {
+      UrlEncodedBinder binder;
+      (void)binder.parser_.parse(body, binder.sink());
+      return binder.done(policy);
+    }
+
+    /**
+     * @class UrlEncodedBinder
+     * @brief Chunked form of validate_urlencoded().
+     *
+     * @code
+     * Form<SignupForm>::UrlEncodedBinder binder;
+     * for (std::string_view chunk : body_chunks)
+     *   if (!binder.feed(chunk))
+     *     break; // binding failed: the rest need not be read
+     * auto r = binder.finish();
+     * @endcode
+     *
+     * Pairs are bound as soon as they are complete. A `std::string_view`
+     * member borrows the chunk it came from, which must then outlive the
+     * result; `std::string` members copy.
+     */
+    class UrlEncodedBinder
+    {
+    public:
+      /// @brief Bind the pairs completed by `chunk`; false once binding failed.
+      bool feed(std::string_view chunk)
       {
-        const bool ok = static_cast<bool>(Derived::bind(form, in, errors));
-        if (!ok)
+        return parser_.feed(chunk, sink());
+      }
+
+      /// @brief Bind the last pair, then validate.
+      [[nodiscard]] FormResult<cleaned_type> finish(ValidationPolicy policy = ValidationPolicy::AllErrors)
+      {
+        (void)parser_.finish(sink());
+        return done(policy);
+      }
+
+    private:
+      friend class Form;
+
+      [[nodiscard]] auto sink()
+      {
+        return [this](std::string_view key, std::string_view value)
+        {
+          return bind_pair(form_, key, value, &errors_);
+        };
+      }
+
+      [[nodiscard]] FormResult<cleaned_type> done(ValidationPolicy policy)
+      {
+        if (parser_.failed())
         {
-          if (errors.size() == 0)
+          if (parser_.error_offset() != std::string_view::npos)
           {
-            errors.add(detail::make_form_error());
+            rules::detail::add_format_error("__form__", "invalid_escape", parser_.error_offset(),
+                                            ErrorText::literal("invalid percent-encoding"), errors_);
           }
-          return FormResult<cleaned_type>(std::move(errors));
+          else if (errors_.size() == 0)
+          {
+            errors_.add(detail::make_form_error());
+          }
+          return FormResult<cleaned_type>(std::move(errors_));
         }
+        return check(form_, std::move(errors_), policy);
       }
-      else if constexpr (detail::has_bind2_v<Derived, Input>)
+
+      Derived form_{};
+      ValidationErrors errors_;
+      UrlEncodedParser parser_;
+    };
+
+    /**
+     * @brief Bind and validate a multipart/form-data body.
+     *
+     * `boundary` comes from the request's Content-Type (see
+     * multipart_boundary()). Text parts are bound like key/value pairs;
+     * file parts go to `Derived::file()`. Part limits are applied while
+     * reading (see MultipartBinder).
+     */
+    [[nodiscard]] static FormResult<cleaned_type> validate_multipart(
+        std::string_view body,
+        std::string_view boundary,
+        MultipartLimits limits = {},
+        ValidationPolicy policy = ValidationPolicy::AllErrors)
+    {
+      MultipartBinder binder(boundary, std::move(limits));
+      (void)binder.feed(body);
+      return binder.finish(policy);
+    }
+
+    /**
+     * @class MultipartBinder
+     * @brief Bind a multipart/form-data body as its chunks arrive.
+     *
+     * @code
+     * Form<UploadForm>::MultipartBinder binder(multipart_boundary(content_type), limits);
+     * for (std::string_view chunk : body_chunks)
+     *   if (!binder.feed(chunk))
+     *     break; // upload rejected: stop reading the body
+     * auto r = binder.finish();
+     * @endcode
+     *
+     * Each part is checked against its MultipartRules as it arrives: the
+     * declared Content-Type and the file name when its headers are
+     * complete, the size with every chunk. A violation fails feed() at
+     * once, with a Format error on the part's name (reason "too_large",
+     * "content_type" or "filename", and the byte "offset" in the body);
+     * malformed bodies fail with a "__form__" Format error. The schema
+     * does not run after a failed upload.
+     *
+     * Text parts go to `Derived::fields()` / `Derived::set()` as views of
+     * the chunk they lie in (a `std::string_view` member then borrows that
+     * chunk) or, when cut by a chunk boundary, of a copy owned by the
+     * binder. File parts are streamed to `Derived::file(form, part, bytes)`,
+     * the last call with `part.complete` set; without it, a file part is
+     * an unknown field.
+     */
+    class MultipartBinder
+    {
+    public:
+      explicit MultipartBinder(std::string_view boundary, MultipartLimits limits = {})
+          : parser_(boundary, std::move(limits))
       {
-        const bool ok = static_cast<bool>(Derived::bind(form, in));
-        if (!ok)
-        {
-          errors.add(detail::make_form_error());
-          return FormResult<cleaned_type>(std::move(errors));
-        }
       }
-      else if constexpr (detail::is_kv_input_v<Input> && detail::has_kv_set_v<Derived>)
+
+      /// @brief Bind the parts completed by `chunk`; false once the upload failed.
+      bool feed(std::string_view chunk)
       {
-        for (const auto &kv : in)
+        return parser_.feed(chunk, sink());
+      }
+
+      /// @brief Check the body was complete, then validate.
+      [[nodiscard]] FormResult<cleaned_type> finish(ValidationPolicy policy = ValidationPolicy::AllErrors)
+      {
+        (void)parser_.finish();
+
+        if (parser_.failed())
         {
-          const bool ok = static_cast<bool>(Derived::set(form, kv.first, kv.second));
-          if (!ok)
+          if (const char *reason = parser_.error())
+          {
+            const std::string_view part = parser_.error_part();
+            rules::detail::add_format_error(part.empty() ? std::string_view("__form__") : part, reason,
+                                            parser_.error_offset(), message_of(reason), errors_);
+          }
+          else if (errors_.size() == 0)
           {
-            errors.add(detail::make_form_error(
-                "unknown or invalid field: " + std::string(kv.first),
-                ValidationErrorCode::Format));
-            return FormResult<cleaned_type>(std::move(errors));
+            errors_.add(detail::make_form_error());
           }
+          return FormResult<cleaned_type>(std::move(errors_));
         }
+        return check(form_, std::move(errors_), policy);
       }
-      else
+
+    private:
+      [[nodiscard]] auto sink()
       {
-        static_assert(vix::validation::detail::dependent_false_v<Input>,
-                      "Form::validate(Input): Derived must implement a compatible bind(). "
-                      "Expected: static bool bind(Derived&, const Input&, ValidationErrors&) "
-                      "or static bool bind(Derived&, const Input&) "
-                      "or (KV input) static bool set(Derived&, std::string_view, std::string_view).");
+        return [this](const MultipartPart &part, std::string_view bytes)
+        {
+          if (!part.file)
+          {
+            return bind_pair(form_, part.name, bytes, &errors_);
+          }
+          if constexpr (detail::has_form_file_v<Derived>)
+          {
+            if (static_cast<bool>(Derived::file(form_, part, bytes)))
+            {
+              return true;
+            }
+          }
+          errors_.add(detail::make_form_error(
+              "unknown or invalid field: " + std::string(part.name),
+              ValidationErrorCode::Format));
+          return false;
+        };
       }
 
-      // 2) Validate using Schema<Derived>
-      ValidationResult vr = schema_ref().validate(form);
-      if (!vr.ok())
+      [[nodiscard]] static ErrorText message_of(std::string_view reason)
       {
-        errors.merge(vr.errors);
-        return FormResult<cleaned_type>(std::move(errors));
+        if (reason == "too_large")
+          return ErrorText::literal("part is too large");
+        if (reason == "content_type")
+          return ErrorText::literal("content type not allowed");
+        if (reason == "filename")
+          return ErrorText::literal("invalid file name");
+        return ErrorText::literal("invalid multipart body");
       }
 
-      // 3) Produce cleaned output (optional)
-      if constexpr (detail::has_clean_method_v<Derived>)
-      {
-        using CleanRet = vix::validation::detail::remove_cvref_t<
-            decltype(std::declval<const Derived &>().clean())>;
+      Derived form_{};
+      ValidationErrors errors_;
+      MultipartParser parser_;
+    };
 
-        static_assert(std::is_same_v<CleanRet, cleaned_type>,
-                      "Form: Derived::clean() must return cleaned_type.");
+    /**
+     * @class Workspace
+     * @brief Storage reused from one validation to the next.
+     *
+     * Holds the bound form, its errors and the urlencoded parser (whose
+     * arena receives decoded text). Keep one per worker, or use the
+     * thread's own (workspace()), and pass it to validate_into() /
+     * validate_urlencoded_into(): once strings, error vector and arena
+     * have grown to the size of the requests seen, a valid request binds
+     * and validates without allocating.
+     */
+    struct Workspace
+    {
+      Derived form{};
+      ValidationErrors errors;
+      UrlEncodedParser parser;
+    };
+
+    /**
+     * @brief The calling thread's Workspace for this form type.
+     *
+     * Its content is valid until the thread's next `*_into(workspace(), ...)`
+     * call for the same form.
+     *
+     * @code
+     * auto &ws = Form<SignupForm>::workspace();
+     * if (!Form<SignupForm>::validate_urlencoded_into(ws, body))
+     *   return reply(400, ws.errors);
+     * create_account(ws.form);
+     * @endcode
+     */
+    [[nodiscard]] static Workspace &workspace()
+    {
+      thread_local Workspace local;
+      return local;
+    }
+
+    /**
+     * @brief Bind and validate into caller-owned storage.
+     *
+     * `form` and `errors` are reset first, then filled like validate()
+     * fills its result: `errors` holds the binding or schema errors, and
+     * on success `form` is the validated value (`cleaned_type` is not
+     * built; call `clean()` on the form if needed).
+     *
+     * Resetting keeps allocated memory: `errors` is cleared, and members
+     * bound through `fields()` are assigned their default value in place,
+     * so a `std::string` keeps its capacity. A form bound another way, or
+     * with members set outside `fields()`, may define
+     * `static void reset(Derived&)` to do the same; otherwise it is
+     * reassigned `Derived{}`.
+     *
+     * @return true if the input bound and passed the schema.
+     */
+    template <typename Input>
+    static bool validate_into(
+        Derived &form,
+        ValidationErrors &errors,
+        const Input &in,
+        ValidationPolicy policy = ValidationPolicy::AllErrors)
+    {
+      reset_form(form);
+      errors.clear();
 
-        return FormResult<cleaned_type>(form.clean());
+      if (!bind_input(form, in, &errors))
+      {
+        return false;
       }
-      else
+      schema_ref().validate_into(form, errors, policy);
+      return errors.ok();
+    }
+
+    /// @brief validate_into() on a Workspace.
+    template <typename Input>
+    static bool validate_into(
+        Workspace &ws,
+        const Input &in,
+        ValidationPolicy policy = ValidationPolicy::AllErrors)
+    {
+      return validate_into(ws.form, ws.errors, in, policy);
+    }
+
+    /**
+     * @brief validate_urlencoded() into a Workspace.
+     *
+     * Decoded keys and values go to the workspace's arena, reused from the
+     * previous call; `std::string_view` members borrow `body` or the
+     * arena until the next call.
+     */
+    static bool validate_urlencoded_into(
+        Workspace &ws,
+        std::string_view body,
+        ValidationPolicy policy = ValidationPolicy::AllErrors)
+    {
+      reset_form(ws.form);
+      ws.errors.clear();
+      ws.parser.reset();
+
+      const bool bound = ws.parser.parse(body, [&ws](std::string_view key, std::string_view value)
+                                         { return bind_pair(ws.form, key, value, &ws.errors); });
+      if (!bound)
       {
-        static_assert(std::is_same_v<cleaned_type, Derived>,
-                      "Form: cleaned_type != Derived but Derived::clean() is missing.");
-        return FormResult<cleaned_type>(std::move(form));
+        if (ws.parser.error_offset() != std::string_view::npos)
+        {
+          rules::detail::add_format_error("__form__", "invalid_escape", ws.parser.error_offset(),
+                                          ErrorText::literal("invalid percent-encoding"), ws.errors);
+        }
+        else if (ws.errors.size() == 0)
+        {
+          ws.errors.add(detail::make_form_error());
+        }
+        return false;
       }
+      schema_ref().validate_into(ws.form, ws.errors, policy);
+      return ws.errors.ok();
+    }
+
+    /**
+     * @brief Pre-screen raw input: bind and check without building errors.
+     *
+     * Runs the same binding as `validate()`, then the schema's predicate
+     * path (`Schema::is_valid`). Useful to reject garbage cheaply before
+     * paying for a full, error-reporting validation.
+     */
+    template <typename Input>
+    [[nodiscard]] static bool is_valid(const Input &in)
+    {
+      Derived form{};
+      return bind_input(form, in, nullptr) && schema_ref().is_valid(form);
     }
 
     // helper KV input type used by validate_kv
@@ -424,13 +1037,15 @@ namespace vix::validation
     using kv_list = std::initializer_list<kv_pair>;
     using kv_input = std::vector<kv_pair>;
 
-    [[nodiscard]] static FormResult<cleaned_type> validate_kv(kv_list kv)
+    [[nodiscard]] static FormResult<cleaned_type> validate_kv(
+        kv_list kv,
+        ValidationPolicy policy = ValidationPolicy::AllErrors)
     {
       kv_input in;
       in.reserve(kv.size());
       for (const auto &p : kv)
         in.push_back(p);
-      return validate(in);
+      return validate(in, policy);
     }
 
     /**
@@ -447,10 +1062,185 @@ namespace vix::validation
     }
 
   private:
+    /**
+     * @brief Bind raw input into `form`.
+     *
+     * On failure, a form-level error is added to `errors` (when non-null)
+     * and false is returned.
+     */
+    template <typename Input>
+    [[nodiscard]] static bool bind_input(Derived &form, const Input &in, ValidationErrors *errors)
+    {
+      if constexpr (detail::has_bind3_v<Derived, Input>)
+      {
+        ValidationErrors scratch;
+        ValidationErrors &target = errors ? *errors : scratch;
+
+        const bool ok = static_cast<bool>(Derived::bind(form, in, target));
+        if (!ok && errors && errors->size() == 0)
+        {
+          errors->add(detail::make_form_error());
+        }
+        return ok;
+      }
+      else if constexpr (detail::has_bind2_v<Derived, Input>)
+      {
+        const bool ok = static_cast<bool>(Derived::bind(form, in));
+        if (!ok && errors)
+        {
+          errors->add(detail::make_form_error());
+        }
+        return ok;
+      }
+      else if constexpr (detail::is_kv_input_v<Input> &&
+                         (detail::has_form_fields_v<Derived> || detail::has_kv_set_v<Derived>))
+      {
+        for (const auto &kv : in)
+        {
+          if (!bind_pair(form, kv.first, kv.second, errors))
+          {
+            return false;
+          }
+        }
+        return true;
+      }
+      else
+      {
+        static_assert(vix::validation::detail::dependent_false_v<Input>,
+                      "Form::validate(Input): Derived must implement a compatible bind(). "
+                      "Expected: static bool bind(Derived&, const Input&, ValidationErrors&) "
+                      "or static bool bind(Derived&, const Input&) "
+                      "or (KV input) static FormFields<Derived> fields() "
+                      "or (KV input) static bool set(Derived&, std::string_view, std::string_view).");
+        return false;
+      }
+    }
+
+    /**
+     * @brief Put a reused form back in its initial state (see validate_into()).
+     */
+    static void reset_form(Derived &form)
+    {
+      if constexpr (detail::has_form_reset_v<Derived>)
+      {
+        Derived::reset(form);
+      }
+      else if constexpr (detail::has_form_fields_v<Derived>)
+      {
+        static const Derived defaults{};
+        fields_ref().reset(form, defaults);
+      }
+      else
+      {
+        form = Derived{};
+      }
+    }
+
+    /**
+     * @brief Validate a bound form and produce the cleaned output.
+     */
+    [[nodiscard]] static FormResult<cleaned_type> check(Derived &form, ValidationErrors errors,
+                                                        ValidationPolicy policy)
+    {
+      if constexpr (!detail::has_clean_method_v<Derived> && !std::is_same_v<cleaned_type, Derived>)
+      {
+        // Schema-filled output: values are parsed once, during validation.
+        static_assert(std::is_default_constructible_v<cleaned_type>,
+                      "Form: cleaned_type != Derived without Derived::clean(): "
+                      "cleaned_type must be default constructible so the schema can fill it.");
+
+        cleaned_type clean{};
+        schema_ref().validate_into(form, errors, clean, policy);
+        if (!errors.ok())
+        {
+          return FormResult<cleaned_type>(std::move(errors));
+        }
+
+        if constexpr (detail::has_clean_into_method_v<Derived, cleaned_type>)
+        {
+          form.clean(clean);
+        }
+
+        return FormResult<cleaned_type>(std::move(clean));
+      }
+      else
+      {
+        schema_ref().validate_into(form, errors, policy);
+        if (!errors.ok())
+        {
+          return FormResult<cleaned_type>(std::move(errors));
+        }
+
+        // 3) Produce cleaned output (optional)
+        if constexpr (detail::has_clean_method_v<Derived>)
+        {
+          using CleanRet = vix::validation::detail::remove_cvref_t<
+              decltype(std::declval<const Derived &>().clean())>;
+
+          static_assert(std::is_same_v<CleanRet, cleaned_type>,
+                        "Form: Derived::clean() must return cleaned_type.");
+
+          return FormResult<cleaned_type>(form.clean());
+        }
+        else
+        {
+          return FormResult<cleaned_type>(std::move(form));
+        }
+      }
+    }
+
+    /**
+     * @brief Bind one key/value pair, for inputs tokenized on the fly.
+     */
+    [[nodiscard]] static bool bind_pair(Derived &form, std::string_view key, std::string_view value,
+                                        ValidationErrors *errors)
+    {
+      if constexpr (detail::has_form_fields_v<Derived>)
+      {
+        return fields_ref().bind_pair(form, key, value, errors);
+      }
+      else if constexpr (detail::has_kv_set_v<Derived>)
+      {
+        if (static_cast<bool>(Derived::set(form, key, value)))
+        {
+          return true;
+        }
+        if (errors)
+        {
+          errors->add(detail::make_form_error(
+              "unknown or invalid field: " + std::string(key),
+              ValidationErrorCode::Format));
+        }
+        return false;
+      }
+      else
+      {
+        static_assert(vix::validation::detail::dependent_false_v<Derived>,
+                      "Form: key/value input needs static FormFields<Derived> fields() "
+                      "or static bool set(Derived&, std::string_view, std::string_view).");
+        return false;
+      }
+    }
+
+    /**
+     * @brief Binding table from `Derived::fields()`, built once.
+     */
+    [[nodiscard]] static const FormFields<Derived> &fields_ref()
+    {
+      using Ret = decltype(Derived::fields());
+
+      static_assert(std::is_same_v<std::remove_cv_t<Ret>, FormFields<Derived>>,
+                    "Form: Derived::fields() must return vix::validation::FormFields<Derived>.");
+
+      static const FormFields<Derived> cached = Derived::fields();
+      return cached;
+    }
+
     /**
      * @brief Internal accessor for the schema cache.
      *
      * Enforces at compile-time that `Derived::schema()` returns `Schema<Derived>`.
+     * The schema is built once and shared by all threads (see Schema).
      */
     [[nodiscard]] static const Schema<Derived> &schema_ref()
     {
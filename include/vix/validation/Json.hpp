@@ -0,0 +1,578 @@
+/**
+ *
+ *  @file Json.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_JSON_HPP
+#define VIX_VALIDATION_JSON_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <vix/validation/CharSet.hpp>
+#include <vix/validation/JsonValue.hpp>
+#include <vix/validation/TextKernels.hpp>
+
+namespace vix::validation
+{
+
+  /**
+   * @class JsonReader
+   * @brief Pull-style (SAX) reader over one JSON object, RFC 8259 grammar.
+   *
+   * No document is built: keys and values are handed out one at a time,
+   * as views into the body whenever possible, so the caller can act on a
+   * member as soon as it was read and stop reading at any point.
+   *
+   * @code
+   * JsonReader in(body);
+   * std::string_view key;
+   * JsonValue value;
+   * if (in.begin_object())
+   * {
+   *   while (in.next_key(key) && in.read_value(value)) { ... }
+   *   in.finish();
+   * }
+   * if (in.failed()) { in.error(); in.error_offset(); }
+   * @endcode
+   *
+   * Every method returns false on a syntax error or at the end of the
+   * object; failed() tells the two apart. Errors carry a reason
+   * ("unexpected_char", "unexpected_end", "invalid_escape", ...) and the
+   * byte offset where they were found.
+   */
+  class JsonReader
+  {
+  public:
+    /// @brief Nesting limit for skipped objects and arrays.
+    static constexpr std::size_t max_depth = 64;
+
+    explicit JsonReader(std::string_view body) noexcept
+        : body_(body)
+    {
+    }
+
+    /// @brief Read the opening brace of the top-level object.
+    [[nodiscard]] bool begin_object()
+    {
+      skip_ws();
+      if (!consume('{'))
+      {
+        return fail(pos_ < body_.size() ? "expected_object" : "unexpected_end");
+      }
+      skip_ws();
+      if (consume('}'))
+      {
+        closed_ = true;
+      }
+      return true;
+    }
+
+    /**
+     * @brief Read the next member name, or return false at the closing
+     * brace (or on error). `key` stays valid until the next string is read.
+     */
+    [[nodiscard]] bool next_key(std::string_view &key)
+    {
+      if (closed_ || failed())
+      {
+        return false;
+      }
+      if (members_ != 0)
+      {
+        skip_ws();
+        if (consume('}'))
+        {
+          closed_ = true;
+          return false;
+        }
+        if (!consume(','))
+        {
+          return fail(pos_ < body_.size() ? "expected_comma" : "unexpected_end");
+        }
+      }
+      ++members_;
+
+      skip_ws();
+      key_offset_ = pos_;
+      if (!peek('"'))
+      {
+        return fail(pos_ < body_.size() ? "expected_key" : "unexpected_end");
+      }
+      bool escaped = false;
+      if (!read_string(key, escaped, true))
+      {
+        return false;
+      }
+      skip_ws();
+      if (!consume(':'))
+      {
+        return fail(pos_ < body_.size() ? "expected_colon" : "unexpected_end");
+      }
+      skip_ws();
+      return true;
+    }
+
+    /// @brief Read the value of the current member.
+    [[nodiscard]] bool read_value(JsonValue &value)
+    {
+      value_offset_ = pos_;
+      return read_any(value, true, 0);
+    }
+
+    /// @brief Validate and discard the value of the current member.
+    [[nodiscard]] bool skip_value()
+    {
+      value_offset_ = pos_;
+      JsonValue ignored;
+      return read_any(ignored, false, 0);
+    }
+
+    /**
+     * @brief Read the rest of the object and check that only whitespace
+     * follows it.
+     */
+    [[nodiscard]] bool finish()
+    {
+      std::string_view key;
+      while (next_key(key))
+      {
+        if (!skip_value())
+        {
+          return false;
+        }
+      }
+      if (failed())
+      {
+        return false;
+      }
+      skip_ws();
+      return pos_ == body_.size() || fail("trailing_data");
+    }
+
+    /// @brief Report an error found by the caller, e.g. a duplicate key.
+    bool fail_at(const char *reason, std::size_t offset) noexcept
+    {
+      if (!error_)
+      {
+        error_ = reason;
+        error_offset_ = offset;
+      }
+      return false;
+    }
+
+    [[nodiscard]] bool failed() const noexcept { return error_ != nullptr; }
+    [[nodiscard]] const char *error() const noexcept { return error_; }
+    [[nodiscard]] std::size_t error_offset() const noexcept { return error_offset_; }
+
+    /// @brief Offset of the last member name / value read.
+    [[nodiscard]] std::size_t key_offset() const noexcept { return key_offset_; }
+    [[nodiscard]] std::size_t value_offset() const noexcept { return value_offset_; }
+
+  private:
+    /// Bytes that may appear unescaped in a string: anything but '"', '\\'
+    /// and the C0 controls.
+    static constexpr CharSet string_plain = ~(CharSet::range(0x00, 0x1F) | CharSet("\"\\"));
+
+    bool fail(const char *reason) noexcept
+    {
+      return fail_at(reason, pos_);
+    }
+
+    void skip_ws() noexcept
+    {
+      while (pos_ < body_.size())
+      {
+        const char c = body_[pos_];
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t')
+        {
+          return;
+        }
+        ++pos_;
+      }
+    }
+
+    [[nodiscard]] bool peek(char c) const noexcept
+    {
+      return pos_ < body_.size() && body_[pos_] == c;
+    }
+
+    [[nodiscard]] bool consume(char c) noexcept
+    {
+      if (peek(c))
+      {
+        ++pos_;
+        return true;
+      }
+      return false;
+    }
+
+    [[nodiscard]] bool literal(std::string_view word) noexcept
+    {
+      const std::string_view got = body_.substr(pos_, word.size());
+      if (got != word)
+      {
+        const bool truncated = got.size() < word.size() && word.substr(0, got.size()) == got;
+        return fail(truncated ? "unexpected_end" : "unexpected_char");
+      }
+      pos_ += word.size();
+      return true;
+    }
+
+    [[nodiscard]] static int hex_value(char c) noexcept
+    {
+      if (c >= '0' && c <= '9')
+        return c - '0';
+      if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+      if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+      return -1;
+    }
+
+    /// @brief Four hex digits at `at`, or -1.
+    [[nodiscard]] long hex4(std::size_t at) const noexcept
+    {
+      if (body_.size() - at < 4)
+      {
+        return -1;
+      }
+      long v = 0;
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+        const int d = hex_value(body_[at + i]);
+        if (d < 0)
+        {
+          return -1;
+        }
+        v = v * 16 + d;
+      }
+      return v;
+    }
+
+    void append_utf8(std::uint32_t cp)
+    {
+      if (cp < 0x80)
+      {
+        scratch_ += static_cast<char>(cp);
+      }
+      else if (cp < 0x800)
+      {
+        scratch_ += static_cast<char>(0xC0 | (cp >> 6));
+        scratch_ += static_cast<char>(0x80 | (cp & 0x3F));
+      }
+      else if (cp < 0x10000)
+      {
+        scratch_ += static_cast<char>(0xE0 | (cp >> 12));
+        scratch_ += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        scratch_ += static_cast<char>(0x80 | (cp & 0x3F));
+      }
+      else
+      {
+        scratch_ += static_cast<char>(0xF0 | (cp >> 18));
+        scratch_ += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        scratch_ += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        scratch_ += static_cast<char>(0x80 | (cp & 0x3F));
+      }
+    }
+
+    /**
+     * @brief Decode one escape at pos_ (just after the backslash).
+     * Unpaired surrogates are rejected.
+     */
+    [[nodiscard]] bool read_escape(bool decode)
+    {
+      if (pos_ >= body_.size())
+      {
+        return fail("unexpected_end");
+      }
+
+      const char c = body_[pos_];
+      char plain = 0;
+      switch (c)
+      {
+      case '"': plain = '"'; break;
+      case '\\': plain = '\\'; break;
+      case '/': plain = '/'; break;
+      case 'b': plain = '\b'; break;
+      case 'f': plain = '\f'; break;
+      case 'n': plain = '\n'; break;
+      case 'r': plain = '\r'; break;
+      case 't': plain = '\t'; break;
+      case 'u': break;
+      default: return fail("invalid_escape");
+      }
+
+      if (plain != 0)
+      {
+        if (decode)
+        {
+          scratch_ += plain;
+        }
+        ++pos_;
+        return true;
+      }
+
+      const std::size_t start = pos_ - 1;
+      const long hi = hex4(pos_ + 1);
+      if (hi < 0)
+      {
+        return fail_at("invalid_escape", start);
+      }
+      pos_ += 5;
+
+      std::uint32_t cp = static_cast<std::uint32_t>(hi);
+      if (cp >= 0xDC00 && cp <= 0xDFFF)
+      {
+        return fail_at("invalid_escape", start);
+      }
+      if (cp >= 0xD800 && cp <= 0xDBFF)
+      {
+        const long lo = (body_.substr(pos_, 2) == "\\u") ? hex4(pos_ + 2) : -1;
+        if (lo < 0xDC00 || lo > 0xDFFF)
+        {
+          return fail_at("invalid_escape", start);
+        }
+        pos_ += 6;
+        cp = 0x10000 + ((cp - 0xD800) << 10) + (static_cast<std::uint32_t>(lo) - 0xDC00);
+      }
+
+      if (decode)
+      {
+        append_utf8(cp);
+      }
+      return true;
+    }
+
+    /**
+     * @brief String at pos_ (on the opening quote). Unescaped runs are
+     * found with the charset kernel; escapes are decoded into scratch_
+     * only when `decode` is set.
+     */
+    [[nodiscard]] bool read_string(std::string_view &out, bool &escaped, bool decode)
+    {
+      ++pos_;
+      const std::size_t start = pos_;
+      std::size_t run = pos_;
+      escaped = false;
+
+      for (;;)
+      {
+        const std::size_t k = kernels::charset_find(body_.substr(pos_), string_plain);
+        if (k == std::string_view::npos)
+        {
+          pos_ = body_.size();
+          return fail("unexpected_end");
+        }
+        pos_ += k;
+
+        const char c = body_[pos_];
+        if (c == '"')
+        {
+          if (!escaped)
+          {
+            out = body_.substr(start, pos_ - start);
+          }
+          else if (decode)
+          {
+            scratch_.append(body_.data() + run, pos_ - run);
+            out = scratch_;
+          }
+          ++pos_;
+          return true;
+        }
+        if (c != '\\')
+        {
+          return fail("control_char");
+        }
+
+        if (decode)
+        {
+          if (!escaped)
+          {
+            scratch_.clear();
+          }
+          scratch_.append(body_.data() + run, pos_ - run);
+        }
+        escaped = true;
+        ++pos_;
+        if (!read_escape(decode))
+        {
+          return false;
+        }
+        run = pos_;
+      }
+    }
+
+    /// @brief Number at pos_: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+    [[nodiscard]] bool read_number(std::string_view &out)
+    {
+      const std::size_t start = pos_;
+      const auto digit = [this]
+      { return pos_ < body_.size() && body_[pos_] >= '0' && body_[pos_] <= '9'; };
+      const auto digits = [&]
+      {
+        if (!digit())
+        {
+          return pos_ < body_.size() ? fail("invalid_number") : fail("unexpected_end");
+        }
+        while (digit())
+        {
+          ++pos_;
+        }
+        return true;
+      };
+
+      (void)consume('-');
+      if (consume('0'))
+      {
+        if (digit())
+        {
+          return fail("invalid_number");
+        }
+      }
+      else if (!digits())
+      {
+        return false;
+      }
+      if (consume('.') && !digits())
+      {
+        return false;
+      }
+      if (consume('e') || consume('E'))
+      {
+        if (!consume('+'))
+        {
+          (void)consume('-');
+        }
+        if (!digits())
+        {
+          return false;
+        }
+      }
+
+      out = body_.substr(start, pos_ - start);
+      return true;
+    }
+
+    /// @brief Any value at pos_; containers are skipped up to max_depth.
+    [[nodiscard]] bool read_any(JsonValue &value, bool decode, std::size_t depth)
+    {
+      if (pos_ >= body_.size())
+      {
+        return fail("unexpected_end");
+      }
+
+      value.escaped = false;
+      value.text = {};
+      switch (body_[pos_])
+      {
+      case '"':
+        value.kind = JsonValue::Kind::String;
+        return read_string(value.text, value.escaped, decode);
+      case 't':
+        value.kind = JsonValue::Kind::True;
+        return literal("true");
+      case 'f':
+        value.kind = JsonValue::Kind::False;
+        return literal("false");
+      case 'n':
+        value.kind = JsonValue::Kind::Null;
+        return literal("null");
+      case '{':
+        value.kind = JsonValue::Kind::Object;
+        return skip_container('}', depth);
+      case '[':
+        value.kind = JsonValue::Kind::Array;
+        return skip_container(']', depth);
+      default:
+        break;
+      }
+
+      if (body_[pos_] == '-' || (body_[pos_] >= '0' && body_[pos_] <= '9'))
+      {
+        value.kind = JsonValue::Kind::Number;
+        return read_number(value.text);
+      }
+      return fail("unexpected_char");
+    }
+
+    [[nodiscard]] bool skip_container(char close, std::size_t depth)
+    {
+      if (depth >= max_depth)
+      {
+        return fail("too_deep");
+      }
+      ++pos_;
+      skip_ws();
+      if (consume(close))
+      {
+        return true;
+      }
+
+      for (;;)
+      {
+        skip_ws();
+        if (close == '}')
+        {
+          if (!peek('"'))
+          {
+            return fail(pos_ < body_.size() ? "expected_key" : "unexpected_end");
+          }
+          std::string_view key;
+          bool escaped = false;
+          if (!read_string(key, escaped, false))
+          {
+            return false;
+          }
+          skip_ws();
+          if (!consume(':'))
+          {
+            return fail(pos_ < body_.size() ? "expected_colon" : "unexpected_end");
+          }
+          skip_ws();
+        }
+
+        JsonValue ignored;
+        if (!read_any(ignored, false, depth + 1))
+        {
+          return false;
+        }
+
+        skip_ws();
+        if (consume(close))
+        {
+          return true;
+        }
+        if (!consume(','))
+        {
+          return fail(pos_ < body_.size() ? "expected_comma" : "unexpected_end");
+        }
+      }
+    }
+
+    std::string_view body_;
+    std::size_t pos_{0};
+    std::size_t members_{0};
+    std::size_t key_offset_{0};
+    std::size_t value_offset_{0};
+    std::size_t error_offset_{0};
+    const char *error_{nullptr};
+    bool closed_{false};
+    std::string scratch_;
+  };
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_JSON_HPP
@@ -0,0 +1,155 @@
+/**
+ *
+ *  @file JsonValue.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_JSON_VALUE_HPP
+#define VIX_VALIDATION_JSON_VALUE_HPP
+
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace vix::validation
+{
+
+  /**
+   * @brief One JSON value as seen by JsonReader.
+   *
+   * For strings, `text` is the decoded content: a view into the body when
+   * the string has no escape (`escaped == false`), else a view into the
+   * reader's scratch buffer, valid until the next string is read. For
+   * numbers, `text` is the literal as written. Objects and arrays are
+   * validated and skipped; only their kind is reported.
+   */
+  struct JsonValue
+  {
+    enum class Kind : std::uint8_t
+    {
+      Null,
+      False,
+      True,
+      Number,
+      String,
+      Object,
+      Array
+    };
+
+    Kind kind{Kind::Null};
+    std::string_view text{};
+    bool escaped{false};
+  };
+
+  namespace detail
+  {
+    /**
+     * @brief Store a JSON value into a member: strings (and the literal
+     * text of numbers, for members later parsed by a ParsedSpec) into
+     * std::string / std::optional<std::string> / std::string_view, numbers
+     * into arithmetic members, true/false into bool. `null` leaves the
+     * member untouched (an optional is reset), so `required()` still
+     * applies. Returns the reason of a mismatch, or nullptr.
+     *
+     * A std::string_view member can only view the body: a string holding
+     * escapes is reported as "escaped_view".
+     */
+    template <typename FieldT>
+    [[nodiscard]] inline const char *json_assign(FieldT &member, const JsonValue &value)
+    {
+      using Kind = JsonValue::Kind;
+
+      if (value.kind == Kind::Null)
+      {
+        if constexpr (std::is_same_v<FieldT, std::optional<std::string>>)
+        {
+          member.reset();
+        }
+        return nullptr;
+      }
+
+      const bool text = value.kind == Kind::String || value.kind == Kind::Number;
+
+      if constexpr (std::is_same_v<FieldT, std::string>)
+      {
+        if (!text)
+        {
+          return "type";
+        }
+        member.assign(value.text);
+        return nullptr;
+      }
+      else if constexpr (std::is_same_v<FieldT, std::optional<std::string>>)
+      {
+        if (!text)
+        {
+          return "type";
+        }
+        member.emplace(value.text);
+        return nullptr;
+      }
+      else if constexpr (std::is_same_v<FieldT, std::string_view>)
+      {
+        if (!text)
+        {
+          return "type";
+        }
+        if (value.escaped)
+        {
+          return "escaped_view";
+        }
+        member = value.text;
+        return nullptr;
+      }
+      else if constexpr (std::is_same_v<FieldT, bool>)
+      {
+        if (value.kind != Kind::True && value.kind != Kind::False)
+        {
+          return "type";
+        }
+        member = value.kind == Kind::True;
+        return nullptr;
+      }
+      else if constexpr (std::is_arithmetic_v<FieldT>)
+      {
+        if (value.kind != Kind::Number)
+        {
+          return "type";
+        }
+        FieldT parsed{};
+        const char *first = value.text.data();
+        const char *last = first + value.text.size();
+        const auto [end, ec] = std::from_chars(first, last, parsed);
+        if (ec == std::errc::result_out_of_range)
+        {
+          return "out_of_range";
+        }
+        if (ec != std::errc{} || end != last)
+        {
+          return "type";
+        }
+        member = parsed;
+        return nullptr;
+      }
+      else
+      {
+        return "type";
+      }
+    }
+  } // namespace detail
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_JSON_VALUE_HPP
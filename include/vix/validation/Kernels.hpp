@@ -0,0 +1,384 @@
+/**
+ *
+ *  @file Kernels.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_KERNELS_HPP
+#define VIX_VALIDATION_KERNELS_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <vix/validation/Simd.hpp>
+
+/**
+ * @brief Low-level block kernels shared by column rules and batch validation.
+ *
+ * Every kernel scans `n` contiguous values and ORs a bit into `words` for
+ * each failing value (bit i of the bitmap = value i). Callers own and zero
+ * the bitmap. Public entry points are range_bits, non_finite_bits and
+ * nan_bits; they pick SSE2 / AVX2 / scalar from a SimdLevel.
+ */
+namespace vix::validation::kernels
+{
+
+  template <typename T>
+  inline void range_scalar(const T *p, std::size_t begin, std::size_t n, T lo, T hi, std::uint64_t *words) noexcept
+  {
+    for (std::size_t i = begin; i < n; ++i)
+    {
+      const bool bad = p[i] < lo || p[i] > hi;
+      words[i / 64] |= (static_cast<std::uint64_t>(bad) << (i % 64));
+    }
+  }
+
+  template <typename T>
+  inline void non_finite_scalar(const T *p, std::size_t begin, std::size_t n, std::uint64_t *words) noexcept
+  {
+    for (std::size_t i = begin; i < n; ++i)
+    {
+      const bool bad = !std::isfinite(p[i]);
+      words[i / 64] |= (static_cast<std::uint64_t>(bad) << (i % 64));
+    }
+  }
+
+  template <typename T>
+  inline void nan_scalar(const T *p, std::size_t begin, std::size_t n, std::uint64_t *words) noexcept
+  {
+    for (std::size_t i = begin; i < n; ++i)
+    {
+      const bool bad = std::isnan(p[i]);
+      words[i / 64] |= (static_cast<std::uint64_t>(bad) << (i % 64));
+    }
+  }
+
+  /// @brief OR a lane mask for rows [i, i + lanes) into the bitmap.
+  inline void put_mask(std::uint64_t *words, std::size_t i, unsigned mask) noexcept
+  {
+    // Lane counts divide 64, so a vector never straddles two words.
+    words[i / 64] |= static_cast<std::uint64_t>(mask) << (i % 64);
+  }
+
+#if VIX_VALIDATION_X86_SIMD
+  // SSE2 (baseline on x86-64)
+
+  inline void range_sse2(const std::int32_t *p, std::size_t n, std::int32_t lo, std::int32_t hi, std::uint64_t *words) noexcept
+  {
+    const __m128i vlo = _mm_set1_epi32(lo);
+    const __m128i vhi = _mm_set1_epi32(hi);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+      const __m128i bad = _mm_or_si128(_mm_cmpgt_epi32(vlo, v), _mm_cmpgt_epi32(v, vhi));
+      put_mask(words, i, static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(bad))));
+    }
+    range_scalar(p, i, n, lo, hi, words);
+  }
+
+  inline void range_sse2(const float *p, std::size_t n, float lo, float hi, std::uint64_t *words) noexcept
+  {
+    const __m128 vlo = _mm_set1_ps(lo);
+    const __m128 vhi = _mm_set1_ps(hi);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      const __m128 v = _mm_loadu_ps(p + i);
+      const __m128 bad = _mm_or_ps(_mm_cmplt_ps(v, vlo), _mm_cmpgt_ps(v, vhi));
+      put_mask(words, i, static_cast<unsigned>(_mm_movemask_ps(bad)));
+    }
+    range_scalar(p, i, n, lo, hi, words);
+  }
+
+  inline void range_sse2(const double *p, std::size_t n, double lo, double hi, std::uint64_t *words) noexcept
+  {
+    const __m128d vlo = _mm_set1_pd(lo);
+    const __m128d vhi = _mm_set1_pd(hi);
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+      const __m128d v = _mm_loadu_pd(p + i);
+      const __m128d bad = _mm_or_pd(_mm_cmplt_pd(v, vlo), _mm_cmpgt_pd(v, vhi));
+      put_mask(words, i, static_cast<unsigned>(_mm_movemask_pd(bad)));
+    }
+    range_scalar(p, i, n, lo, hi, words);
+  }
+
+  inline void non_finite_sse2(const float *p, std::size_t n, std::uint64_t *words) noexcept
+  {
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 vmax = _mm_set1_ps(std::numeric_limits<float>::max());
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      // |v| <= max is false for +-inf and NaN.
+      const __m128 ok = _mm_cmple_ps(_mm_and_ps(_mm_loadu_ps(p + i), abs_mask), vmax);
+      put_mask(words, i, static_cast<unsigned>(~_mm_movemask_ps(ok)) & 0xFu);
+    }
+    non_finite_scalar(p, i, n, words);
+  }
+
+  inline void non_finite_sse2(const double *p, std::size_t n, std::uint64_t *words) noexcept
+  {
+    const __m128d abs_mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+    const __m128d vmax = _mm_set1_pd(std::numeric_limits<double>::max());
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+      const __m128d ok = _mm_cmple_pd(_mm_and_pd(_mm_loadu_pd(p + i), abs_mask), vmax);
+      put_mask(words, i, static_cast<unsigned>(~_mm_movemask_pd(ok)) & 0x3u);
+    }
+    non_finite_scalar(p, i, n, words);
+  }
+
+  inline void nan_sse2(const float *p, std::size_t n, std::uint64_t *words) noexcept
+  {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      const __m128 v = _mm_loadu_ps(p + i);
+      put_mask(words, i, static_cast<unsigned>(_mm_movemask_ps(_mm_cmpunord_ps(v, v))));
+    }
+    nan_scalar(p, i, n, words);
+  }
+
+  inline void nan_sse2(const double *p, std::size_t n, std::uint64_t *words) noexcept
+  {
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+      const __m128d v = _mm_loadu_pd(p + i);
+      put_mask(words, i, static_cast<unsigned>(_mm_movemask_pd(_mm_cmpunord_pd(v, v))));
+    }
+    nan_scalar(p, i, n, words);
+  }
+
+  // AVX2
+
+  VIX_VALIDATION_TARGET_AVX2 inline void
+  range_avx2(const std::int32_t *p, std::size_t n, std::int32_t lo, std::int32_t hi, std::uint64_t *words) noexcept
+  {
+    const __m256i vlo = _mm256_set1_epi32(lo);
+    const __m256i vhi = _mm256_set1_epi32(hi);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+      const __m256i bad = _mm256_or_si256(_mm256_cmpgt_epi32(vlo, v), _mm256_cmpgt_epi32(v, vhi));
+      put_mask(words, i, static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(bad))));
+    }
+    range_scalar(p, i, n, lo, hi, words);
+  }
+
+  VIX_VALIDATION_TARGET_AVX2 inline void
+  range_avx2(const std::int64_t *p, std::size_t n, std::int64_t lo, std::int64_t hi, std::uint64_t *words) noexcept
+  {
+    const __m256i vlo = _mm256_set1_epi64x(lo);
+    const __m256i vhi = _mm256_set1_epi64x(hi);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+      const __m256i bad = _mm256_or_si256(_mm256_cmpgt_epi64(vlo, v), _mm256_cmpgt_epi64(v, vhi));
+      put_mask(words, i, static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(bad))));
+    }
+    range_scalar(p, i, n, lo, hi, words);
+  }
+
+  VIX_VALIDATION_TARGET_AVX2 inline void
+  range_avx2(const float *p, std::size_t n, float lo, float hi, std::uint64_t *words) noexcept
+  {
+    const __m256 vlo = _mm256_set1_ps(lo);
+    const __m256 vhi = _mm256_set1_ps(hi);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+      const __m256 v = _mm256_loadu_ps(p + i);
+      const __m256 bad = _mm256_or_ps(_mm256_cmp_ps(v, vlo, _CMP_LT_OQ), _mm256_cmp_ps(v, vhi, _CMP_GT_OQ));
+      put_mask(words, i, static_cast<unsigned>(_mm256_movemask_ps(bad)));
+    }
+    range_scalar(p, i, n, lo, hi, words);
+  }
+
+  VIX_VALIDATION_TARGET_AVX2 inline void
+  range_avx2(const double *p, std::size_t n, double lo, double hi, std::uint64_t *words) noexcept
+  {
+    const __m256d vlo = _mm256_set1_pd(lo);
+    const __m256d vhi = _mm256_set1_pd(hi);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      const __m256d v = _mm256_loadu_pd(p + i);
+      const __m256d bad = _mm256_or_pd(_mm256_cmp_pd(v, vlo, _CMP_LT_OQ), _mm256_cmp_pd(v, vhi, _CMP_GT_OQ));
+      put_mask(words, i, static_cast<unsigned>(_mm256_movemask_pd(bad)));
+    }
+    range_scalar(p, i, n, lo, hi, words);
+  }
+
+  VIX_VALIDATION_TARGET_AVX2 inline void
+  non_finite_avx2(const float *p, std::size_t n, std::uint64_t *words) noexcept
+  {
+    const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const __m256 vmax = _mm256_set1_ps(std::numeric_limits<float>::max());
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+      const __m256 ok = _mm256_cmp_ps(_mm256_and_ps(_mm256_loadu_ps(p + i), abs_mask), vmax, _CMP_LE_OQ);
+      put_mask(words, i, static_cast<unsigned>(~_mm256_movemask_ps(ok)) & 0xFFu);
+    }
+    non_finite_scalar(p, i, n, words);
+  }
+
+  VIX_VALIDATION_TARGET_AVX2 inline void
+  non_finite_avx2(const double *p, std::size_t n, std::uint64_t *words) noexcept
+  {
+    const __m256d abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    const __m256d vmax = _mm256_set1_pd(std::numeric_limits<double>::max());
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      const __m256d ok = _mm256_cmp_pd(_mm256_and_pd(_mm256_loadu_pd(p + i), abs_mask), vmax, _CMP_LE_OQ);
+      put_mask(words, i, static_cast<unsigned>(~_mm256_movemask_pd(ok)) & 0xFu);
+    }
+    non_finite_scalar(p, i, n, words);
+  }
+
+  VIX_VALIDATION_TARGET_AVX2 inline void
+  nan_avx2(const float *p, std::size_t n, std::uint64_t *words) noexcept
+  {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+      const __m256 v = _mm256_loadu_ps(p + i);
+      put_mask(words, i, static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(v, v, _CMP_UNORD_Q))));
+    }
+    nan_scalar(p, i, n, words);
+  }
+
+  VIX_VALIDATION_TARGET_AVX2 inline void
+  nan_avx2(const double *p, std::size_t n, std::uint64_t *words) noexcept
+  {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+      const __m256d v = _mm256_loadu_pd(p + i);
+      put_mask(words, i, static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(v, v, _CMP_UNORD_Q))));
+    }
+    nan_scalar(p, i, n, words);
+  }
+#endif // VIX_VALIDATION_X86_SIMD
+
+  template <typename T>
+  inline void range_bits(const T *p, std::size_t n, T lo, T hi, std::uint64_t *words, SimdLevel level) noexcept
+  {
+#if VIX_VALIDATION_X86_SIMD
+    level = usable_simd_level(level);
+    if constexpr (std::is_same_v<T, std::int32_t> || std::is_same_v<T, float> || std::is_same_v<T, double>)
+    {
+      if (level == SimdLevel::AVX2)
+      {
+        return range_avx2(p, n, lo, hi, words);
+      }
+      if (level == SimdLevel::SSE2)
+      {
+        return range_sse2(p, n, lo, hi, words);
+      }
+    }
+    else if constexpr (std::is_same_v<T, std::int64_t>)
+    {
+      if (level == SimdLevel::AVX2)
+      {
+        return range_avx2(p, n, lo, hi, words);
+      }
+    }
+#else
+    (void)level;
+#endif
+    range_scalar(p, 0, n, lo, hi, words);
+  }
+
+  template <typename T>
+  inline void non_finite_bits(const T *p, std::size_t n, std::uint64_t *words, SimdLevel level) noexcept
+  {
+#if VIX_VALIDATION_X86_SIMD
+    level = usable_simd_level(level);
+    if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+    {
+      if (level == SimdLevel::AVX2)
+      {
+        return non_finite_avx2(p, n, words);
+      }
+      if (level == SimdLevel::SSE2)
+      {
+        return non_finite_sse2(p, n, words);
+      }
+    }
+#else
+    (void)level;
+#endif
+    non_finite_scalar(p, 0, n, words);
+  }
+
+  template <typename T>
+  inline void nan_bits(const T *p, std::size_t n, std::uint64_t *words, SimdLevel level) noexcept
+  {
+#if VIX_VALIDATION_X86_SIMD
+    level = usable_simd_level(level);
+    if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+    {
+      if (level == SimdLevel::AVX2)
+      {
+        return nan_avx2(p, n, words);
+      }
+      if (level == SimdLevel::SSE2)
+      {
+        return nan_sse2(p, n, words);
+      }
+    }
+#else
+    (void)level;
+#endif
+    nan_scalar(p, 0, n, words);
+  }
+
+  template <typename T>
+  [[nodiscard]] inline constexpr T lowest() noexcept
+  {
+    if constexpr (std::numeric_limits<T>::has_infinity)
+    {
+      return -std::numeric_limits<T>::infinity();
+    }
+    else
+    {
+      return std::numeric_limits<T>::lowest();
+    }
+  }
+
+  template <typename T>
+  [[nodiscard]] inline constexpr T highest() noexcept
+  {
+    if constexpr (std::numeric_limits<T>::has_infinity)
+    {
+      return std::numeric_limits<T>::infinity();
+    }
+    else
+    {
+      return std::numeric_limits<T>::max();
+    }
+  }
+
+} // namespace vix::validation::kernels
+
+#endif // VIX_VALIDATION_KERNELS_HPP
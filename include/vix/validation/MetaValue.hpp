@@ -0,0 +1,254 @@
+/**
+ *
+ *  @file MetaValue.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_META_VALUE_HPP
+#define VIX_VALIDATION_META_VALUE_HPP
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <vix/validation/ErrorText.hpp>
+
+namespace vix::validation
+{
+
+  /**
+   * @class MetaValue
+   * @brief Typed value stored in error metadata.
+   *
+   * Holds an int64, uint64, double, bool or text (ErrorText semantics:
+   * borrowed literal or shared copy) in 16 bytes. Numbers are kept as
+   * numbers and only formatted (with std::to_chars) when the error is
+   * printed or serialized, so failing numeric rules do not allocate.
+   */
+  class MetaValue
+  {
+  public:
+    enum class Kind : std::uint8_t
+    {
+      Int,
+      UInt,
+      Double,
+      Bool,
+      String
+    };
+
+    /// @brief Buffer large enough for any formatted number.
+    using FormatBuffer = std::array<char, 32>;
+
+    MetaValue() noexcept
+    {
+      v_.s = "";
+    }
+
+    template <typename N,
+              std::enable_if_t<std::is_arithmetic_v<N> && !std::is_same_v<N, char>, int> = 0>
+    MetaValue(N n) noexcept
+    {
+      if constexpr (std::is_same_v<N, bool>)
+      {
+        kind_ = Kind::Bool;
+        v_.b = n;
+      }
+      else if constexpr (std::is_floating_point_v<N>)
+      {
+        kind_ = Kind::Double;
+        v_.d = static_cast<double>(n);
+      }
+      else if constexpr (std::is_signed_v<N>)
+      {
+        kind_ = Kind::Int;
+        v_.i = static_cast<std::int64_t>(n);
+      }
+      else
+      {
+        kind_ = Kind::UInt;
+        v_.u = static_cast<std::uint64_t>(n);
+      }
+    }
+
+    MetaValue(const ErrorText &text) noexcept
+    {
+      size_ = static_cast<std::uint32_t>(text.size());
+      shared_ = text.is_shared();
+      if (shared_)
+      {
+        v_.t = text.ptr_.block;
+        detail::text_retain(v_.t);
+      }
+      else
+      {
+        v_.s = text.ptr_.chars;
+      }
+    }
+
+    MetaValue(const char *s) : MetaValue(ErrorText(s)) {}
+    MetaValue(const std::string &s) : MetaValue(ErrorText(s)) {}
+    MetaValue(std::string_view s) : MetaValue(ErrorText(s)) {}
+
+    MetaValue(const MetaValue &other) noexcept
+        : v_(other.v_), size_(other.size_), kind_(other.kind_), shared_(other.shared_)
+    {
+      if (shared_)
+      {
+        detail::text_retain(v_.t);
+      }
+    }
+
+    MetaValue(MetaValue &&other) noexcept
+        : v_(other.v_), size_(other.size_), kind_(other.kind_), shared_(other.shared_)
+    {
+      if (other.shared_)
+      {
+        other.v_.s = "";
+        other.size_ = 0;
+        other.shared_ = false;
+      }
+    }
+
+    MetaValue &operator=(const MetaValue &other) noexcept
+    {
+      MetaValue tmp(other);
+      swap(tmp);
+      return *this;
+    }
+
+    MetaValue &operator=(MetaValue &&other) noexcept
+    {
+      MetaValue tmp(std::move(other));
+      swap(tmp);
+      return *this;
+    }
+
+    ~MetaValue()
+    {
+      if (shared_)
+      {
+        detail::text_release(v_.t);
+      }
+    }
+
+    void swap(MetaValue &other) noexcept
+    {
+      std::swap(v_, other.v_);
+      std::swap(size_, other.size_);
+      std::swap(kind_, other.kind_);
+      std::swap(shared_, other.shared_);
+    }
+
+    [[nodiscard]] Kind kind() const noexcept { return kind_; }
+
+    [[nodiscard]] bool is_int() const noexcept { return kind_ == Kind::Int; }
+    [[nodiscard]] bool is_uint() const noexcept { return kind_ == Kind::UInt; }
+    [[nodiscard]] bool is_double() const noexcept { return kind_ == Kind::Double; }
+    [[nodiscard]] bool is_bool() const noexcept { return kind_ == Kind::Bool; }
+    [[nodiscard]] bool is_string() const noexcept { return kind_ == Kind::String; }
+
+    /// @pre is_int()
+    [[nodiscard]] std::int64_t as_int() const noexcept { return v_.i; }
+    /// @pre is_uint()
+    [[nodiscard]] std::uint64_t as_uint() const noexcept { return v_.u; }
+    /// @pre is_double()
+    [[nodiscard]] double as_double() const noexcept { return v_.d; }
+    /// @pre is_bool()
+    [[nodiscard]] bool as_bool() const noexcept { return v_.b; }
+    /// @pre is_string()
+    [[nodiscard]] std::string_view as_string() const noexcept
+    {
+      return {shared_ ? detail::text_chars(v_.t) : v_.s, size_};
+    }
+
+    /**
+     * @brief Format the value without allocating.
+     *
+     * Numbers are written into `buf`; text is returned as-is.
+     * The view is valid while both `buf` and this value live.
+     */
+    [[nodiscard]] std::string_view format(FormatBuffer &buf) const noexcept
+    {
+      char *first = buf.data();
+      char *last = buf.data() + buf.size();
+      std::to_chars_result r{first, std::errc{}};
+
+      switch (kind_)
+      {
+      case Kind::Int:
+        r = std::to_chars(first, last, v_.i);
+        break;
+      case Kind::UInt:
+        r = std::to_chars(first, last, v_.u);
+        break;
+      case Kind::Double:
+        r = std::to_chars(first, last, v_.d);
+        break;
+      case Kind::Bool:
+        return v_.b ? std::string_view("true") : std::string_view("false");
+      case Kind::String:
+        return as_string();
+      }
+
+      return std::string_view(first, static_cast<std::size_t>(r.ptr - first));
+    }
+
+    /// @brief Formatted copy (allocates).
+    [[nodiscard]] std::string str() const
+    {
+      FormatBuffer buf;
+      return std::string(format(buf));
+    }
+
+    /// @brief Formatted copy, so code written against string meta values keeps compiling.
+    operator std::string() const { return str(); }
+
+    /// @brief Compare the formatted value with text.
+    friend bool operator==(const MetaValue &a, std::string_view b) noexcept
+    {
+      FormatBuffer buf;
+      return a.format(buf) == b;
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const MetaValue &v)
+    {
+      FormatBuffer buf;
+      return os << v.format(buf);
+    }
+
+  private:
+    union Storage
+    {
+      const char *s;
+      detail::TextBlock *t; // shared text (shared_ == true)
+      std::int64_t i;
+      std::uint64_t u;
+      double d;
+      bool b;
+    };
+
+    Storage v_{};
+    std::uint32_t size_{0};
+    Kind kind_{Kind::String};
+    bool shared_{false};
+  };
+
+  static_assert(sizeof(MetaValue) == 16, "MetaValue is expected to stay 16 bytes");
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_META_VALUE_HPP
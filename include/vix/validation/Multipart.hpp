@@ -0,0 +1,666 @@
+/**
+ *
+ *  @file Multipart.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_MULTIPART_HPP
+#define VIX_VALIDATION_MULTIPART_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/CharSet.hpp>
+#include <vix/validation/TextKernels.hpp>
+#include <vix/validation/UrlEncoded.hpp>
+
+namespace vix::validation
+{
+
+  /**
+   * @brief Rules applied to one multipart part while it is being read.
+   */
+  struct MultipartRules
+  {
+    /// @brief Largest accepted body, in bytes.
+    std::size_t max_size{1024 * 1024};
+
+    /// @brief Accepted Content-Type values ("image/png", or "image/*");
+    /// empty accepts any. A part without Content-Type is "text/plain".
+    std::vector<std::string> content_types{};
+
+    /// @brief Bytes allowed in a file name.
+    CharSet filename_chars{charsets::alnum | CharSet("._- ")};
+  };
+
+  /**
+   * @brief Limits of a multipart/form-data body.
+   *
+   * Text parts (no `filename`) and file parts get the `text` and `file`
+   * rules, unless rules were registered for their name with part().
+   *
+   * @code
+   * MultipartLimits limits;
+   * limits.part("avatar", {.max_size = 512 * 1024, .content_types = {"image/png", "image/jpeg"}});
+   * @endcode
+   */
+  struct MultipartLimits
+  {
+    std::size_t max_parts{128};
+    std::size_t max_header_size{8 * 1024};
+    MultipartRules text{64 * 1024};
+    MultipartRules file{};
+    std::vector<std::pair<std::string, MultipartRules>> parts{};
+
+    /// @brief Rules for the part named `name`.
+    MultipartLimits &part(std::string name, MultipartRules rules) &
+    {
+      parts.emplace_back(std::move(name), std::move(rules));
+      return *this;
+    }
+
+    MultipartLimits &&part(std::string name, MultipartRules rules) &&
+    {
+      parts.emplace_back(std::move(name), std::move(rules));
+      return std::move(*this);
+    }
+
+    [[nodiscard]] const MultipartRules &rules_for(std::string_view name, bool is_file) const noexcept
+    {
+      for (const auto &p : parts)
+      {
+        if (p.first == name)
+        {
+          return p.second;
+        }
+      }
+      return is_file ? file : text;
+    }
+  };
+
+  /**
+   * @brief The part being read, as seen by a MultipartParser sink.
+   *
+   * Views point into the parser and stay valid until the next part.
+   */
+  struct MultipartPart
+  {
+    std::string_view name{};
+    std::string_view filename{};
+    std::string_view content_type{};
+
+    /// @brief The part has a `filename` parameter.
+    bool file{false};
+
+    /// @brief Last call for this part.
+    bool complete{false};
+  };
+
+  namespace detail
+  {
+    [[nodiscard]] inline char ascii_lower(char c) noexcept
+    {
+      return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    [[nodiscard]] inline bool iequals(std::string_view a, std::string_view b) noexcept
+    {
+      if (a.size() != b.size())
+      {
+        return false;
+      }
+      for (std::size_t i = 0; i < a.size(); ++i)
+      {
+        if (ascii_lower(a[i]) != ascii_lower(b[i]))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    [[nodiscard]] inline std::string_view trim_lwsp(std::string_view s) noexcept
+    {
+      while (!s.empty() && (s.front() == ' ' || s.front() == '\t'))
+      {
+        s.remove_prefix(1);
+      }
+      while (!s.empty() && (s.back() == ' ' || s.back() == '\t'))
+      {
+        s.remove_suffix(1);
+      }
+      return s;
+    }
+
+    /**
+     * @brief Next `key=value` parameter of a header value (after the first
+     * ';'), with quotes removed. Returns false at the end, or with `bad`
+     * set on an unterminated quote.
+     */
+    [[nodiscard]] inline bool next_header_param(std::string_view &rest, std::string_view &key,
+                                                std::string_view &value, bool &bad) noexcept
+    {
+      while (!rest.empty() && (rest.front() == ';' || rest.front() == ' ' || rest.front() == '\t'))
+      {
+        rest.remove_prefix(1);
+      }
+      if (rest.empty())
+      {
+        return false;
+      }
+
+      const std::size_t stop = rest.find_first_of("=;");
+      key = trim_lwsp(rest.substr(0, stop));
+      value = {};
+      if (stop == std::string_view::npos || rest[stop] == ';')
+      {
+        rest.remove_prefix(stop == std::string_view::npos ? rest.size() : stop);
+        return true;
+      }
+
+      rest.remove_prefix(stop + 1);
+      rest = trim_lwsp(rest);
+      if (!rest.empty() && rest.front() == '"')
+      {
+        const std::size_t close = rest.find('"', 1);
+        if (close == std::string_view::npos)
+        {
+          bad = true;
+          return false;
+        }
+        value = rest.substr(1, close - 1);
+        rest.remove_prefix(close + 1);
+        return true;
+      }
+
+      const std::size_t end = rest.find(';');
+      value = trim_lwsp(rest.substr(0, end));
+      rest.remove_prefix(end == std::string_view::npos ? rest.size() : end);
+      return true;
+    }
+
+    /// @brief `mime` (parameters ignored) matches "type/sub" or "type/*".
+    [[nodiscard]] inline bool content_type_matches(std::string_view mime, std::string_view accepted) noexcept
+    {
+      mime = trim_lwsp(mime.substr(0, mime.find(';')));
+      if (accepted.size() >= 2 && accepted.substr(accepted.size() - 2) == "/*")
+      {
+        const std::string_view type = accepted.substr(0, accepted.size() - 1);
+        return mime.size() > type.size() && iequals(mime.substr(0, type.size()), type);
+      }
+      return iequals(mime, accepted);
+    }
+  } // namespace detail
+
+  /**
+   * @brief Boundary parameter of a multipart Content-Type header, or an
+   * empty view.
+   */
+  [[nodiscard]] inline std::string_view multipart_boundary(std::string_view content_type) noexcept
+  {
+    std::string_view rest = content_type.substr(std::min(content_type.find(';'), content_type.size()));
+    std::string_view key;
+    std::string_view value;
+    bool bad = false;
+    while (detail::next_header_param(rest, key, value, bad))
+    {
+      if (detail::iequals(key, "boundary"))
+      {
+        return value;
+      }
+    }
+    return {};
+  }
+
+  /**
+   * @class MultipartParser
+   * @brief Incremental multipart/form-data reader (RFC 7578).
+   *
+   * The body is fed in chunks of any size. Part headers are checked as
+   * soon as they are complete (declared Content-Type, file name charset)
+   * and part sizes while the bytes arrive, so an invalid upload fails in
+   * the middle of the stream, before its remaining bytes are read.
+   *
+   * Parts go to a sink `bool(const MultipartPart &part, std::string_view
+   * bytes)`; a false return stops parsing:
+   * - text parts, once, with the whole value: a view of the chunk when the
+   *   part lies in one chunk, else a copy assembled in the arena;
+   * - file parts, once per piece, the last call with `part.complete`
+   *   set. Pieces are views of the chunk, except for the few bytes held
+   *   back when a chunk ends on what might be a delimiter; they are only
+   *   valid during the call.
+   *
+   * Delimiters are found with memchr on '\r' and one compare per hit; a
+   * delimiter cut by a chunk boundary is held until the next chunk.
+   */
+  class MultipartParser
+  {
+  public:
+    /// @brief `boundary` as given by the Content-Type header (1 to 70 bytes).
+    explicit MultipartParser(std::string_view boundary, MultipartLimits limits = {})
+        : limits_(std::move(limits)), delimiter_("\r\n--"), hold_("\r\n")
+    {
+      if (boundary.empty() || boundary.size() > 70)
+      {
+        (void)fail("boundary", 0);
+      }
+      delimiter_.append(boundary);
+    }
+
+    /**
+     * @brief Parse the next chunk.
+     * @return false once parsing failed or the sink stopped it.
+     */
+    template <typename Sink>
+    bool feed(std::string_view chunk, Sink &&sink)
+    {
+      std::size_t i = 0;
+      while (i < chunk.size() && !stopped_)
+      {
+        switch (state_)
+        {
+        case State::Data:
+          i = scan_data(chunk, i, sink);
+          break;
+        case State::Delimiter:
+          i = after_delimiter(chunk, i);
+          break;
+        case State::Headers:
+          i = read_headers(chunk, i);
+          break;
+        case State::Epilogue:
+          i = chunk.size();
+          break;
+        }
+      }
+      consumed_ += chunk.size();
+      return !stopped_;
+    }
+
+    /// @brief End of the body: fails unless the closing delimiter was read.
+    bool finish()
+    {
+      if (stopped_)
+      {
+        return false;
+      }
+      return state_ == State::Epilogue || fail("truncated", consumed_);
+    }
+
+    [[nodiscard]] bool failed() const noexcept { return stopped_; }
+
+    /**
+     * @brief Why parsing failed, or nullptr when the sink stopped it:
+     * "boundary", "malformed", "header_too_large", "bad_header",
+     * "missing_name", "too_many_parts", "truncated" (body errors), or
+     * "too_large", "content_type", "filename" (rules of error_part()).
+     */
+    [[nodiscard]] const char *error() const noexcept { return error_; }
+
+    /// @brief Offset in the whole body where the error was found.
+    [[nodiscard]] std::size_t error_offset() const noexcept { return error_offset_; }
+
+    /// @brief Name of the part that broke a rule, empty for body errors.
+    [[nodiscard]] std::string_view error_part() const noexcept { return error_part_; }
+
+    [[nodiscard]] const MultipartLimits &limits() const noexcept { return limits_; }
+
+  private:
+    enum class State : unsigned char
+    {
+      Data,      // preamble or part body, up to the next delimiter
+      Delimiter, // after a delimiter: "--" or transport padding then CRLF
+      Headers,
+      Epilogue
+    };
+
+    bool fail(const char *reason, std::size_t offset, std::string_view part = {})
+    {
+      stopped_ = true;
+      error_ = reason;
+      error_offset_ = offset;
+      error_part_.assign(part);
+      return false;
+    }
+
+    /**
+     * @brief Part body up to the next delimiter, from chunk[i]. Returns
+     * the index to continue from.
+     */
+    template <typename Sink>
+    std::size_t scan_data(std::string_view chunk, std::size_t i, Sink &sink)
+    {
+      if (!hold_.empty())
+      {
+        // Complete the delimiter prefix left at the end of the last chunk.
+        const std::size_t held = hold_.size();
+        const std::string_view head = chunk.substr(i, delimiter_.size() - held);
+        if (delimiter_.compare(held, head.size(), head) == 0)
+        {
+          if (held + head.size() < delimiter_.size())
+          {
+            hold_.append(head);
+            return chunk.size();
+          }
+          hold_.clear();
+          if (!data({}, consumed_ + i, true, sink))
+          {
+            return chunk.size();
+          }
+          state_ = State::Delimiter;
+          return i + head.size();
+        }
+
+        // Not a delimiter: the held bytes were data (a delimiter can only
+        // start at hold_[0], as boundaries never contain '\r').
+        const bool ok = data(hold_, consumed_ + i - held, false, sink);
+        hold_.clear();
+        if (!ok)
+        {
+          return chunk.size();
+        }
+      }
+
+      const char *p = chunk.data();
+      const std::size_t n = chunk.size();
+      std::size_t from = i;
+      while (from < n)
+      {
+        const void *hit = std::memchr(p + from, '\r', n - from);
+        if (!hit)
+        {
+          break;
+        }
+        const std::size_t k = static_cast<std::size_t>(static_cast<const char *>(hit) - p);
+        const std::size_t rest = n - k;
+
+        if (rest >= delimiter_.size())
+        {
+          if (std::memcmp(p + k, delimiter_.data(), delimiter_.size()) == 0)
+          {
+            if (!data(chunk.substr(i, k - i), consumed_ + i, true, sink))
+            {
+              return n;
+            }
+            state_ = State::Delimiter;
+            return k + delimiter_.size();
+          }
+        }
+        else if (std::memcmp(p + k, delimiter_.data(), rest) == 0)
+        {
+          if (data(chunk.substr(i, k - i), consumed_ + i, false, sink))
+          {
+            hold_.assign(p + k, rest);
+          }
+          return n;
+        }
+        from = k + 1;
+      }
+
+      (void)data(chunk.substr(i), consumed_ + i, false, sink);
+      return n;
+    }
+
+    /**
+     * @brief Body bytes of the current part (`offset` in the whole body);
+     * `last` when a delimiter ends it.
+     */
+    template <typename Sink>
+    bool data(std::string_view bytes, std::size_t offset, bool last, Sink &sink)
+    {
+      if (!in_part_)
+      {
+        return true; // preamble
+      }
+
+      if (bytes.size() > rules_->max_size - size_)
+      {
+        return fail("too_large", offset + (rules_->max_size - size_), part_.name);
+      }
+      size_ += bytes.size();
+      part_.complete = last;
+
+      if (part_.file)
+      {
+        if (!bytes.empty() || last)
+        {
+          if (!sink(part_, bytes))
+          {
+            stopped_ = true;
+            return false;
+          }
+        }
+      }
+      else if (!last)
+      {
+        text_.append(bytes);
+        carried_ = true;
+        return true;
+      }
+      else
+      {
+        std::string_view value = bytes;
+        if (carried_)
+        {
+          text_.append(bytes);
+          value = arena_.store(text_);
+        }
+        if (!sink(part_, value))
+        {
+          stopped_ = true;
+          return false;
+        }
+      }
+
+      if (last)
+      {
+        in_part_ = false;
+      }
+      return true;
+    }
+
+    /// @brief After a delimiter: "--" ends the body, CRLF starts a part.
+    std::size_t after_delimiter(std::string_view chunk, std::size_t i)
+    {
+      for (; i < chunk.size(); ++i)
+      {
+        const char c = chunk[i];
+        if (after_ == 0 && (c == ' ' || c == '\t'))
+        {
+          continue;
+        }
+        if (after_ == 0 && (c == '-' || c == '\r'))
+        {
+          after_ = c;
+          continue;
+        }
+        if (after_ == '-' && c == '-')
+        {
+          state_ = State::Epilogue;
+          return i + 1;
+        }
+        if (after_ == '\r' && c == '\n')
+        {
+          after_ = 0;
+          if (++parts_ > limits_.max_parts)
+          {
+            (void)fail("too_many_parts", consumed_ + i + 1);
+            return chunk.size();
+          }
+          header_.clear();
+          header_start_ = consumed_ + i + 1;
+          state_ = State::Headers;
+          return i + 1;
+        }
+        (void)fail("malformed", consumed_ + i);
+        return chunk.size();
+      }
+      return i;
+    }
+
+    /// @brief Header block up to the blank line, then checks the part.
+    std::size_t read_headers(std::string_view chunk, std::size_t i)
+    {
+      const std::size_t old = header_.size();
+      const std::size_t room = limits_.max_header_size + 4 - old;
+      const std::string_view piece = chunk.substr(i, room);
+      header_.append(piece);
+
+      std::size_t end = 0;
+      std::size_t blank = 2;
+      if (header_.compare(0, 2, "\r\n") != 0)
+      {
+        end = header_.find("\r\n\r\n", old >= 3 ? old - 3 : 0);
+        blank = 4;
+        if (end == std::string::npos || end > limits_.max_header_size)
+        {
+          if (header_.size() >= limits_.max_header_size + 4 || end != std::string::npos)
+          {
+            (void)fail("header_too_large", header_start_);
+          }
+          return i + piece.size();
+        }
+      }
+
+      header_.resize(end);
+      if (begin_part())
+      {
+        state_ = State::Data;
+      }
+      return i + (end + blank - old);
+    }
+
+    /// @brief Parse the header block and apply the part's header rules.
+    bool begin_part()
+    {
+      part_ = MultipartPart{};
+      bool named = false;
+
+      std::string_view block = header_;
+      while (!block.empty())
+      {
+        const std::size_t eol = block.find("\r\n");
+        const std::string_view line = block.substr(0, eol);
+        block.remove_prefix(eol == std::string_view::npos ? block.size() : eol + 2);
+
+        const std::size_t colon = line.find(':');
+        if (colon == std::string_view::npos)
+        {
+          return fail("bad_header", header_start_ + static_cast<std::size_t>(line.data() - header_.data()));
+        }
+        const std::string_view key = detail::trim_lwsp(line.substr(0, colon));
+        const std::string_view value = detail::trim_lwsp(line.substr(colon + 1));
+
+        if (detail::iequals(key, "content-type"))
+        {
+          part_.content_type = value;
+        }
+        else if (detail::iequals(key, "content-disposition"))
+        {
+          const std::size_t semi = value.find(';');
+          if (!detail::iequals(detail::trim_lwsp(value.substr(0, semi)), "form-data"))
+          {
+            return fail("bad_header", header_start_ + static_cast<std::size_t>(value.data() - header_.data()));
+          }
+
+          std::string_view rest = value.substr(std::min(semi, value.size()));
+          std::string_view param;
+          std::string_view text;
+          bool bad = false;
+          while (detail::next_header_param(rest, param, text, bad))
+          {
+            if (detail::iequals(param, "name"))
+            {
+              part_.name = text;
+              named = true;
+            }
+            else if (detail::iequals(param, "filename"))
+            {
+              part_.filename = text;
+              part_.file = true;
+            }
+          }
+          if (bad)
+          {
+            return fail("bad_header", header_start_ + static_cast<std::size_t>(value.data() - header_.data()));
+          }
+        }
+      }
+
+      if (!named)
+      {
+        return fail("missing_name", header_start_);
+      }
+
+      rules_ = &limits_.rules_for(part_.name, part_.file);
+
+      if (!rules_->content_types.empty())
+      {
+        const std::string_view mime = part_.content_type.empty() ? std::string_view("text/plain") : part_.content_type;
+        bool accepted = false;
+        for (const std::string &type : rules_->content_types)
+        {
+          accepted = accepted || detail::content_type_matches(mime, type);
+        }
+        if (!accepted)
+        {
+          return fail("content_type", header_start_, part_.name);
+        }
+      }
+
+      if (part_.file)
+      {
+        const std::size_t bad = kernels::charset_find(part_.filename, rules_->filename_chars);
+        if (bad != std::string_view::npos)
+        {
+          return fail("filename",
+                      header_start_ + static_cast<std::size_t>(part_.filename.data() - header_.data()) + bad,
+                      part_.name);
+        }
+      }
+
+      in_part_ = true;
+      size_ = 0;
+      carried_ = false;
+      text_.clear();
+      return true;
+    }
+
+    MultipartLimits limits_;
+    std::string delimiter_; // "\r\n--" + boundary
+    std::string hold_;      // delimiter prefix cut by a chunk boundary
+    std::string header_;
+    std::string text_;
+    ScratchArena arena_;
+    MultipartPart part_{};
+    const MultipartRules *rules_{nullptr};
+    State state_{State::Data};
+    char after_{0};
+    bool in_part_{false};
+    bool carried_{false};
+    bool stopped_{false};
+    std::size_t size_{0};
+    std::size_t parts_{0};
+    std::size_t header_start_{0};
+    std::size_t consumed_{0};
+    const char *error_{nullptr};
+    std::size_t error_offset_{0};
+    std::string error_part_;
+  };
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_MULTIPART_HPP
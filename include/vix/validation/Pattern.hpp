@@ -0,0 +1,924 @@
+/**
+ *
+ *  @file Pattern.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_PATTERN_HPP
+#define VIX_VALIDATION_PATTERN_HPP
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace vix::validation
+{
+
+  namespace detail
+  {
+    using ByteSet = std::bitset<256>;
+
+    /**
+     * @brief Compiled form of a Pattern: a minimized DFA over byte classes.
+     *
+     * `next` holds, for each state row and byte class, the target row
+     * offset shifted left by one; the low bit marks a state where the
+     * answer is already known (no match possible, or matched regardless of
+     * what follows). Row 0 is the dead state.
+     */
+    struct PatternProgram
+    {
+      std::string source;
+      std::array<std::uint8_t, 256> classes{};
+      std::uint32_t class_count{1};
+      std::uint32_t start{0};
+      std::vector<std::uint32_t> next;
+      std::vector<std::uint8_t> accept_at_end; // per state
+    };
+
+    /// @brief Parse tree of the supported regex subset.
+    struct PatternNode
+    {
+      enum class Kind : std::uint8_t
+      {
+        Empty,
+        Bytes,
+        Concat,
+        Alt,
+        Repeat
+      };
+
+      Kind kind{Kind::Empty};
+      ByteSet bytes;
+      std::vector<std::size_t> children;
+      std::size_t min{0};
+      std::size_t max{0}; // unbounded when == repeat_unbounded
+    };
+
+    inline constexpr std::size_t repeat_unbounded = std::numeric_limits<std::size_t>::max();
+    inline constexpr std::size_t pattern_max_repeat = 1000;
+    inline constexpr std::size_t pattern_max_nfa_states = 100000;
+    inline constexpr std::size_t pattern_max_dfa_states = 10000;
+
+    /// @brief One top-level alternative with its anchors.
+    struct PatternBranch
+    {
+      std::size_t node{0};
+      bool anchored_start{false};
+      bool anchored_end{false};
+    };
+
+    class PatternParser
+    {
+    public:
+      explicit PatternParser(std::string_view source) : src_(source) {}
+
+      std::vector<PatternBranch> parse()
+      {
+        std::vector<PatternBranch> branches;
+        for (;;)
+        {
+          PatternBranch b;
+          if (peek('^'))
+          {
+            b.anchored_start = true;
+            ++pos_;
+          }
+          b.node = parse_concat(true);
+          if (peek('$'))
+          {
+            b.anchored_end = true;
+            ++pos_;
+          }
+          branches.push_back(b);
+
+          if (peek('|'))
+          {
+            ++pos_;
+            continue;
+          }
+          if (pos_ != src_.size())
+          {
+            fail(src_[pos_] == ')' ? "unmatched ')'" : "'$' is only supported at the end of an alternative");
+          }
+          return branches;
+        }
+      }
+
+      std::vector<PatternNode> nodes;
+
+    private:
+      [[noreturn]] void fail(const char *what) const
+      {
+        throw std::invalid_argument("vix::validation::Pattern: " + std::string(what) + " at offset " +
+                                    std::to_string(pos_) + " in \"" + std::string(src_) + "\"");
+      }
+
+      [[nodiscard]] bool peek(char c) const noexcept
+      {
+        return pos_ < src_.size() && src_[pos_] == c;
+      }
+
+      [[nodiscard]] bool at_branch_end(bool top) const noexcept
+      {
+        if (pos_ == src_.size() || src_[pos_] == '|' || src_[pos_] == ')')
+        {
+          return true;
+        }
+        // A top-level '$' ends the alternative when nothing but '|' follows.
+        return top && src_[pos_] == '$' &&
+               (pos_ + 1 == src_.size() || src_[pos_ + 1] == '|');
+      }
+
+      std::size_t add(PatternNode n)
+      {
+        nodes.push_back(std::move(n));
+        return nodes.size() - 1;
+      }
+
+      std::size_t parse_alt()
+      {
+        PatternNode alt;
+        alt.kind = PatternNode::Kind::Alt;
+        alt.children.push_back(parse_concat(false));
+        while (peek('|'))
+        {
+          ++pos_;
+          alt.children.push_back(parse_concat(false));
+        }
+        return alt.children.size() == 1 ? alt.children[0] : add(std::move(alt));
+      }
+
+      std::size_t parse_concat(bool top)
+      {
+        PatternNode cat;
+        cat.kind = PatternNode::Kind::Concat;
+        while (!at_branch_end(top))
+        {
+          cat.children.push_back(parse_repeat());
+        }
+        if (cat.children.empty())
+        {
+          return add(PatternNode{});
+        }
+        return cat.children.size() == 1 ? cat.children[0] : add(std::move(cat));
+      }
+
+      std::size_t parse_number()
+      {
+        std::size_t n = 0;
+        const std::size_t begin = pos_;
+        while (pos_ < src_.size() && src_[pos_] >= '0' && src_[pos_] <= '9')
+        {
+          n = n * 10 + static_cast<std::size_t>(src_[pos_] - '0');
+          if (n > pattern_max_repeat)
+          {
+            fail("repetition count above 1000");
+          }
+          ++pos_;
+        }
+        if (pos_ == begin)
+        {
+          fail("expected a number");
+        }
+        return n;
+      }
+
+      std::size_t parse_repeat()
+      {
+        std::size_t atom = parse_atom();
+        while (pos_ < src_.size())
+        {
+          std::size_t min = 0;
+          std::size_t max = 0;
+          const char c = src_[pos_];
+          if (c == '*')
+          {
+            min = 0;
+            max = repeat_unbounded;
+            ++pos_;
+          }
+          else if (c == '+')
+          {
+            min = 1;
+            max = repeat_unbounded;
+            ++pos_;
+          }
+          else if (c == '?')
+          {
+            min = 0;
+            max = 1;
+            ++pos_;
+          }
+          else if (c == '{')
+          {
+            ++pos_;
+            min = parse_number();
+            max = min;
+            if (peek(','))
+            {
+              ++pos_;
+              max = peek('}') ? repeat_unbounded : parse_number();
+            }
+            if (!peek('}'))
+            {
+              fail("expected '}'");
+            }
+            ++pos_;
+            if (max < min)
+            {
+              fail("repetition range out of order");
+            }
+          }
+          else
+          {
+            break;
+          }
+
+          // Lazy quantifiers match the same strings; accept and ignore.
+          if (peek('?'))
+          {
+            ++pos_;
+          }
+
+          PatternNode rep;
+          rep.kind = PatternNode::Kind::Repeat;
+          rep.children.push_back(atom);
+          rep.min = min;
+          rep.max = max;
+          atom = add(std::move(rep));
+        }
+        return atom;
+      }
+
+      std::size_t bytes_node(const ByteSet &set)
+      {
+        PatternNode n;
+        n.kind = PatternNode::Kind::Bytes;
+        n.bytes = set;
+        return add(std::move(n));
+      }
+
+      static ByteSet range(unsigned first, unsigned last)
+      {
+        ByteSet s;
+        for (unsigned c = first; c <= last; ++c)
+        {
+          s.set(c);
+        }
+        return s;
+      }
+
+      static ByteSet digits() { return range('0', '9'); }
+      static ByteSet word() { return range('0', '9') | range('a', 'z') | range('A', 'Z') | range('_', '_'); }
+      static ByteSet spaces() { return range('\t', '\r') | range(' ', ' '); }
+
+      /// @brief Escape after '\\'; sets `single` when it names one byte.
+      ByteSet parse_escape(bool &single, unsigned &byte)
+      {
+        if (pos_ >= src_.size())
+        {
+          fail("trailing '\\'");
+        }
+        const char c = src_[pos_++];
+        single = false;
+        switch (c)
+        {
+        case 'd':
+          return digits();
+        case 'D':
+          return ~digits();
+        case 'w':
+          return word();
+        case 'W':
+          return ~word();
+        case 's':
+          return spaces();
+        case 'S':
+          return ~spaces();
+        default:
+          break;
+        }
+
+        single = true;
+        switch (c)
+        {
+        case 'n':
+          byte = '\n';
+          break;
+        case 't':
+          byte = '\t';
+          break;
+        case 'r':
+          byte = '\r';
+          break;
+        case 'f':
+          byte = '\f';
+          break;
+        case 'v':
+          byte = '\v';
+          break;
+        case '0':
+          byte = 0;
+          break;
+        case 'x':
+        {
+          auto hex = [&](char h) -> unsigned
+          {
+            if (h >= '0' && h <= '9')
+              return static_cast<unsigned>(h - '0');
+            if (h >= 'a' && h <= 'f')
+              return static_cast<unsigned>(h - 'a' + 10);
+            if (h >= 'A' && h <= 'F')
+              return static_cast<unsigned>(h - 'A' + 10);
+            fail("bad \\x escape");
+          };
+          if (src_.size() - pos_ < 2)
+          {
+            fail("bad \\x escape");
+          }
+          byte = hex(src_[pos_]) * 16 + hex(src_[pos_ + 1]);
+          pos_ += 2;
+          break;
+        }
+        default:
+          if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))
+          {
+            --pos_;
+            fail("unsupported escape");
+          }
+          byte = static_cast<unsigned char>(c);
+          break;
+        }
+
+        ByteSet s;
+        s.set(byte);
+        return s;
+      }
+
+      ByteSet parse_class()
+      {
+        // After '['.
+        bool negate = false;
+        if (peek('^'))
+        {
+          negate = true;
+          ++pos_;
+        }
+
+        // As in ECMAScript, "[]" matches nothing and "[^]" any byte.
+        ByteSet set;
+        while (pos_ < src_.size() && src_[pos_] != ']')
+        {
+          bool single = true;
+          unsigned lo = static_cast<unsigned char>(src_[pos_]);
+          ByteSet item;
+          if (src_[pos_] == '\\')
+          {
+            ++pos_;
+            item = parse_escape(single, lo);
+          }
+          else
+          {
+            ++pos_;
+            item.set(lo);
+          }
+
+          if (single && pos_ + 1 < src_.size() && src_[pos_] == '-' && src_[pos_ + 1] != ']')
+          {
+            ++pos_;
+            unsigned hi = static_cast<unsigned char>(src_[pos_]);
+            if (src_[pos_] == '\\')
+            {
+              ++pos_;
+              bool hi_single = true;
+              (void)parse_escape(hi_single, hi);
+              if (!hi_single)
+              {
+                fail("class escape used as a range bound");
+              }
+            }
+            else
+            {
+              ++pos_;
+            }
+            if (hi < lo)
+            {
+              fail("class range out of order");
+            }
+            item = range(lo, hi);
+          }
+          set |= item;
+        }
+
+        if (!peek(']'))
+        {
+          fail("unterminated '['");
+        }
+        ++pos_;
+        return negate ? ~set : set;
+      }
+
+      std::size_t parse_atom()
+      {
+        const char c = src_[pos_];
+        switch (c)
+        {
+        case '(':
+        {
+          ++pos_;
+          if (src_.substr(pos_, 2) == "?:")
+          {
+            pos_ += 2;
+          }
+          const std::size_t inner = parse_alt();
+          if (!peek(')'))
+          {
+            fail("missing ')'");
+          }
+          ++pos_;
+          return inner;
+        }
+        case '[':
+          ++pos_;
+          return bytes_node(parse_class());
+        case '.':
+          ++pos_;
+          return bytes_node(~range('\n', '\n'));
+        case '\\':
+        {
+          ++pos_;
+          bool single = false;
+          unsigned byte = 0;
+          return bytes_node(parse_escape(single, byte));
+        }
+        case '*':
+        case '+':
+        case '?':
+        case '{':
+          fail("nothing to repeat");
+        case '^':
+          fail("'^' is only supported at the start of an alternative");
+        case '$':
+          fail("'$' is only supported at the end of an alternative");
+        default:
+        {
+          ++pos_;
+          ByteSet s;
+          s.set(static_cast<unsigned char>(c));
+          return bytes_node(s);
+        }
+        }
+      }
+
+      std::string_view src_;
+      std::size_t pos_{0};
+    };
+
+    /**
+     * @brief Thompson NFA: each state has either a byte edge or epsilon edges.
+     */
+    class PatternNfa
+    {
+    public:
+      struct State
+      {
+        ByteSet bytes;
+        int next{-1};
+        std::vector<int> eps;
+      };
+
+      std::vector<State> states;
+      int start{0};
+      int accept_end{0};
+      int accept_now{0};
+
+      PatternNfa(const std::vector<PatternNode> &nodes, const std::vector<PatternBranch> &branches)
+          : nodes_(nodes)
+      {
+        start = add();
+        const int scan = add();
+        accept_end = add();
+        accept_now = add();
+
+        // Unanchored alternatives may start at any offset.
+        states[static_cast<std::size_t>(scan)].bytes.set();
+        states[static_cast<std::size_t>(scan)].next = scan;
+
+        bool scanning = false;
+        for (const PatternBranch &b : branches)
+        {
+          const Frag f = build(b.node);
+          link(b.anchored_start ? start : scan, f.start);
+          link(f.end, b.anchored_end ? accept_end : accept_now);
+          scanning = scanning || !b.anchored_start;
+        }
+        if (scanning)
+        {
+          link(start, scan);
+        }
+      }
+
+    private:
+      struct Frag
+      {
+        int start;
+        int end;
+      };
+
+      int add()
+      {
+        if (states.size() >= pattern_max_nfa_states)
+        {
+          throw std::invalid_argument("vix::validation::Pattern: pattern too large");
+        }
+        states.emplace_back();
+        return static_cast<int>(states.size() - 1);
+      }
+
+      void link(int from, int to)
+      {
+        states[static_cast<std::size_t>(from)].eps.push_back(to);
+      }
+
+      Frag build(std::size_t index)
+      {
+        const PatternNode &n = nodes_[index];
+        switch (n.kind)
+        {
+        case PatternNode::Kind::Empty:
+        {
+          const int s = add();
+          return {s, s};
+        }
+        case PatternNode::Kind::Bytes:
+        {
+          const int s = add();
+          const int e = add();
+          states[static_cast<std::size_t>(s)].bytes = n.bytes;
+          states[static_cast<std::size_t>(s)].next = e;
+          return {s, e};
+        }
+        case PatternNode::Kind::Concat:
+        {
+          Frag f = build(n.children[0]);
+          for (std::size_t i = 1; i < n.children.size(); ++i)
+          {
+            const Frag g = build(n.children[i]);
+            link(f.end, g.start);
+            f.end = g.end;
+          }
+          return f;
+        }
+        case PatternNode::Kind::Alt:
+        {
+          const int s = add();
+          const int e = add();
+          for (std::size_t child : n.children)
+          {
+            const Frag g = build(child);
+            link(s, g.start);
+            link(g.end, e);
+          }
+          return {s, e};
+        }
+        case PatternNode::Kind::Repeat:
+        {
+          const int s = add();
+          int cur = s;
+          for (std::size_t i = 0; i < n.min; ++i)
+          {
+            const Frag g = build(n.children[0]);
+            link(cur, g.start);
+            cur = g.end;
+          }
+          if (n.max == repeat_unbounded)
+          {
+            const int loop = add();
+            const Frag g = build(n.children[0]);
+            link(cur, loop);
+            link(loop, g.start);
+            link(g.end, loop);
+            cur = loop;
+          }
+          else
+          {
+            for (std::size_t i = n.min; i < n.max; ++i)
+            {
+              const Frag g = build(n.children[0]);
+              const int e = add();
+              link(cur, g.start);
+              link(cur, e);
+              link(g.end, e);
+              cur = e;
+            }
+          }
+          return {s, cur};
+        }
+        }
+        return {0, 0};
+      }
+
+      const std::vector<PatternNode> &nodes_;
+    };
+
+    /// @brief Partition bytes into classes that no edge tells apart.
+    inline std::uint32_t pattern_byte_classes(const PatternNfa &nfa, std::array<std::uint8_t, 256> &classes)
+    {
+      std::array<std::uint32_t, 256> cls{};
+      std::uint32_t count = 1;
+      for (const auto &st : nfa.states)
+      {
+        if (st.next < 0 || st.bytes.all())
+        {
+          continue;
+        }
+        std::map<std::pair<std::uint32_t, bool>, std::uint32_t> split;
+        for (std::size_t b = 0; b < 256; ++b)
+        {
+          const auto key = std::make_pair(cls[b], static_cast<bool>(st.bytes[b]));
+          auto it = split.find(key);
+          if (it == split.end())
+          {
+            it = split.emplace(key, static_cast<std::uint32_t>(split.size())).first;
+          }
+          cls[b] = it->second;
+        }
+        count = static_cast<std::uint32_t>(split.size());
+      }
+      for (std::size_t b = 0; b < 256; ++b)
+      {
+        classes[b] = static_cast<std::uint8_t>(cls[b]);
+      }
+      return count;
+    }
+
+    /**
+     * @brief Compile: parse, Thompson NFA, subset construction over byte
+     * classes, then Moore minimization.
+     */
+    inline std::shared_ptr<const PatternProgram> compile_pattern(std::string_view source)
+    {
+      PatternParser parser(source);
+      const std::vector<PatternBranch> branches = parser.parse();
+      const PatternNfa nfa(parser.nodes, branches);
+
+      auto program = std::make_shared<PatternProgram>();
+      program->source = std::string(source);
+      const std::uint32_t k = pattern_byte_classes(nfa, program->classes);
+      program->class_count = k;
+
+      std::array<std::uint8_t, 256> representative{};
+      for (std::size_t b = 256; b-- > 0;)
+      {
+        representative[program->classes[b]] = static_cast<std::uint8_t>(b);
+      }
+
+      // Subset construction. State 0 is the dead (empty) set.
+      const std::size_t nfa_size = nfa.states.size();
+      auto closure = [&](std::vector<int> seeds)
+      {
+        std::vector<char> seen(nfa_size, 0);
+        std::vector<int> out;
+        while (!seeds.empty())
+        {
+          const int s = seeds.back();
+          seeds.pop_back();
+          if (seen[static_cast<std::size_t>(s)])
+          {
+            continue;
+          }
+          seen[static_cast<std::size_t>(s)] = 1;
+          out.push_back(s);
+          for (int e : nfa.states[static_cast<std::size_t>(s)].eps)
+          {
+            seeds.push_back(e);
+          }
+        }
+        std::sort(out.begin(), out.end());
+        return out;
+      };
+
+      std::map<std::vector<int>, std::uint32_t> ids;
+      std::vector<std::vector<int>> sets;
+      std::vector<std::uint8_t> kind; // 0 reject, 1 accept at end, 2 accept now
+      std::vector<std::uint32_t> next;
+
+      auto intern = [&](std::vector<int> set) -> std::uint32_t
+      {
+        auto it = ids.find(set);
+        if (it != ids.end())
+        {
+          return it->second;
+        }
+        if (sets.size() >= pattern_max_dfa_states)
+        {
+          throw std::invalid_argument("vix::validation::Pattern: pattern too complex");
+        }
+        std::uint8_t kd = 0;
+        for (int s : set)
+        {
+          kd = s == nfa.accept_now ? 2 : (s == nfa.accept_end && kd == 0 ? 1 : kd);
+        }
+        const auto id = static_cast<std::uint32_t>(sets.size());
+        ids.emplace(set, id);
+        sets.push_back(std::move(set));
+        kind.push_back(kd);
+        return id;
+      };
+
+      (void)intern({});
+      const std::uint32_t start = intern(closure({nfa.start}));
+
+      for (std::uint32_t d = 0; d < sets.size(); ++d)
+      {
+        next.resize(static_cast<std::size_t>(sets.size()) * k);
+        for (std::uint32_t c = 0; c < k; ++c)
+        {
+          std::uint32_t target = d;
+          if (d != 0 && kind[d] != 2)
+          {
+            std::vector<int> seeds;
+            for (int s : sets[d])
+            {
+              const auto &st = nfa.states[static_cast<std::size_t>(s)];
+              if (st.next >= 0 && st.bytes[representative[c]])
+              {
+                seeds.push_back(st.next);
+              }
+            }
+            target = intern(closure(std::move(seeds)));
+            next.resize(static_cast<std::size_t>(sets.size()) * k);
+          }
+          next[static_cast<std::size_t>(d) * k + c] = target;
+        }
+      }
+
+      // Moore minimization: refine by (kind, successor blocks).
+      const std::size_t n = sets.size();
+      std::vector<std::uint32_t> block(n);
+      std::size_t blocks = 0;
+      for (std::size_t s = 0; s < n; ++s)
+      {
+        block[s] = kind[s];
+      }
+      for (;;)
+      {
+        std::map<std::vector<std::uint32_t>, std::uint32_t> sig;
+        std::vector<std::uint32_t> refined(n);
+        for (std::size_t s = 0; s < n; ++s)
+        {
+          std::vector<std::uint32_t> key;
+          key.reserve(k + 1);
+          key.push_back(block[s]);
+          for (std::uint32_t c = 0; c < k; ++c)
+          {
+            key.push_back(block[next[s * k + c]]);
+          }
+          auto it = sig.find(key);
+          if (it == sig.end())
+          {
+            it = sig.emplace(std::move(key), static_cast<std::uint32_t>(sig.size())).first;
+          }
+          refined[s] = it->second;
+        }
+        block.swap(refined);
+        if (sig.size() == blocks)
+        {
+          break;
+        }
+        blocks = sig.size();
+      }
+
+      // Renumber so the dead state's block is 0.
+      std::vector<std::uint32_t> order(blocks, std::numeric_limits<std::uint32_t>::max());
+      std::uint32_t used = 0;
+      order[block[0]] = used++;
+      for (std::size_t s = 0; s < n; ++s)
+      {
+        if (order[block[s]] == std::numeric_limits<std::uint32_t>::max())
+        {
+          order[block[s]] = used++;
+        }
+      }
+
+      program->next.assign(static_cast<std::size_t>(blocks) * k, 0);
+      program->accept_at_end.assign(blocks, 0);
+      std::vector<std::uint8_t> stop(blocks, 0);
+      for (std::size_t s = 0; s < n; ++s)
+      {
+        const std::uint32_t b = order[block[s]];
+        program->accept_at_end[b] = kind[s] != 0;
+        stop[b] = b == 0 || kind[s] == 2;
+      }
+      for (std::size_t s = 0; s < n; ++s)
+      {
+        const std::uint32_t b = order[block[s]];
+        for (std::uint32_t c = 0; c < k; ++c)
+        {
+          const std::uint32_t t = order[block[next[s * k + c]]];
+          program->next[static_cast<std::size_t>(b) * k + c] = ((t * k) << 1) | stop[t];
+        }
+      }
+      const std::uint32_t s0 = order[block[start]];
+      program->start = ((s0 * k) << 1) | stop[s0];
+      return program;
+    }
+  } // namespace detail
+
+  /**
+   * @class Pattern
+   * @brief Regular expression compiled to a minimized DFA.
+   *
+   * Supported: literals, `.`, classes (`[a-z]`, `[^...]`), `\d \w \s` and
+   * their negations, `\n \t \r \f \v \0 \xHH`, escaped punctuation, groups
+   * `(...)` / `(?:...)`, `* + ? {n} {n,} {n,m}` (lazy forms match the same
+   * strings), `|`, and `^` / `$` at the start / end of an alternative.
+   * No backreferences, lookaround or word boundaries. Matching is on
+   * bytes; a non-ASCII literal matches its UTF-8 bytes in sequence.
+   *
+   * Like std::regex_search, an alternative without `^` may match anywhere
+   * and one without `$` need not reach the end; write `^...$` for a full
+   * match.
+   *
+   * Compilation throws std::invalid_argument on unsupported syntax or a
+   * pattern that would need too many DFA states. Matching reads each byte
+   * once through one table lookup, never allocates and never backtracks.
+   * Copies share the compiled program.
+   */
+  class Pattern
+  {
+  public:
+    explicit Pattern(std::string_view source)
+        : program_(detail::compile_pattern(source))
+    {
+    }
+
+    [[nodiscard]] bool matches(std::string_view value) const noexcept
+    {
+      return mismatch(value) == std::string_view::npos;
+    }
+
+    /**
+     * @brief npos on a match; otherwise the offset of the byte after which
+     * no match was possible, or value.size() when the input ran out first.
+     */
+    [[nodiscard]] std::size_t mismatch(std::string_view value) const noexcept
+    {
+      const detail::PatternProgram &p = *program_;
+      const std::uint32_t *next = p.next.data();
+      const std::uint8_t *classes = p.classes.data();
+      const std::size_t n = value.size();
+
+      std::uint32_t t = p.start;
+      if (t & 1u)
+      {
+        return (t >> 1) != 0 ? std::string_view::npos : 0;
+      }
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        t = next[(t >> 1) + classes[static_cast<unsigned char>(value[i])]];
+        if (t & 1u)
+        {
+          return (t >> 1) != 0 ? std::string_view::npos : i;
+        }
+      }
+      return p.accept_at_end[(t >> 1) / p.class_count] != 0 ? std::string_view::npos : n;
+    }
+
+    [[nodiscard]] std::string_view source() const noexcept
+    {
+      return program_->source;
+    }
+
+    /// @brief States of the minimized DFA (including the dead state).
+    [[nodiscard]] std::size_t state_count() const noexcept
+    {
+      return program_->accept_at_end.size();
+    }
+
+  private:
+    std::shared_ptr<const detail::PatternProgram> program_;
+  };
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_PATTERN_HPP
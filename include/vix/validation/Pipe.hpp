@@ -15,6 +15,8 @@
 #ifndef VIX_VALIDATION_PIPE_HPP
 #define VIX_VALIDATION_PIPE_HPP
 
+#include <cstddef>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -24,10 +26,12 @@
 #include <vix/conversion/ConversionError.hpp>
 #include <vix/conversion/Parse.hpp>
 
+#include <vix/validation/ErrorSink.hpp>
 #include <vix/validation/Rule.hpp>
 #include <vix/validation/Rules.hpp>
 #include <vix/validation/ValidationError.hpp>
 #include <vix/validation/ValidationErrors.hpp>
+#include <vix/validation/ValidationPolicy.hpp>
 #include <vix/validation/ValidationResult.hpp>
 
 namespace vix::validation
@@ -46,19 +50,19 @@ namespace vix::validation
   conversion_error_to_validation(
       std::string_view field,
       const vix::conversion::ConversionError &err,
-      std::string message = "invalid value")
+      ErrorText message = ErrorText::literal("invalid value"))
   {
     ValidationError ve{
-        std::string(field),
+        detail::field_text(field),
         ValidationErrorCode::Format,
         std::move(message)};
 
-    ve.meta["conversion_code"] = std::string(vix::conversion::to_string(err.code));
-    ve.meta["position"] = std::to_string(err.position);
+    ve.meta.set(ErrorText::literal("conversion_code"), MetaValue(vix::conversion::to_string(err.code)));
+    ve.meta.set(ErrorText::literal("position"), err.position);
 
     if (!err.input.empty())
     {
-      ve.meta["input"] = std::string(err.input);
+      ve.meta.set(ErrorText::literal("input"), MetaValue(err.input));
     }
 
     return ve;
@@ -92,19 +96,19 @@ namespace vix::validation
       return *this;
     }
 
-    ParsedValidator &min(T v, std::string message = "value is below minimum")
+    ParsedValidator &min(T v, ErrorText message = ErrorText::literal("value is below minimum"))
       requires std::is_arithmetic_v<T>
     {
       return rule(rules::min<T>(v, std::move(message)));
     }
 
-    ParsedValidator &max(T v, std::string message = "value is above maximum")
+    ParsedValidator &max(T v, ErrorText message = ErrorText::literal("value is above maximum"))
       requires std::is_arithmetic_v<T>
     {
       return rule(rules::max<T>(v, std::move(message)));
     }
 
-    ParsedValidator &between(T a, T b, std::string message = "value is out of range")
+    ParsedValidator &between(T a, T b, ErrorText message = ErrorText::literal("value is out of range"))
       requires std::is_arithmetic_v<T>
     {
       return rule(rules::between<T>(a, b, std::move(message)));
@@ -117,7 +121,42 @@ namespace vix::validation
      */
     [[nodiscard]] bool result_into(
         ValidationErrors &out,
-        std::string parse_message = "invalid value") const
+        ErrorText parse_message = ErrorText::literal("invalid value")) const
+    {
+      return result_into(out, ValidationPolicy::AllErrors, std::move(parse_message));
+    }
+
+    /**
+     * @brief Execute validation under a policy and append errors into `out`.
+     *
+     * A parse failure always produces exactly one error. Once parsing
+     * succeeded, any policy other than AllErrors stops at the first failing
+     * rule.
+     *
+     * @return true if ok (no new errors were added), false otherwise.
+     */
+    [[nodiscard]] bool result_into(
+        ValidationErrors &out,
+        ValidationPolicy policy,
+        ErrorText parse_message = ErrorText::literal("invalid value")) const
+    {
+      return value_into(out, policy, std::move(parse_message)).has_value();
+    }
+
+    /**
+     * @brief Parse, validate, and hand back the typed value.
+     *
+     * Same errors as `result_into(out, policy, parse_message)`, but the value
+     * parsed along the way is returned instead of being thrown away, so
+     * callers never need to parse the input a second time.
+     *
+     * @return the parsed value if parsing succeeded and every rule passed,
+     *         std::nullopt otherwise.
+     */
+    [[nodiscard]] std::optional<T> value_into(
+        ValidationErrors &out,
+        ValidationPolicy policy = ValidationPolicy::AllErrors,
+        ErrorText parse_message = ErrorText::literal("invalid value")) const
     {
       const std::size_t before = out.size();
 
@@ -125,33 +164,64 @@ namespace vix::validation
       if (!parsed)
       {
         out.add(conversion_error_to_validation(field_, parsed.error(), std::move(parse_message)));
-        return false;
+        return std::nullopt;
       }
 
-      const T &value = parsed.value();
+      apply_rules_into<T>(field_, parsed.value(), rules_, out, policy);
 
-      for (const auto &r : rules_)
+      if (out.size() != before)
       {
-        if (r)
-        {
-          r(field_, value, out);
-        }
+        return std::nullopt;
       }
+      return std::optional<T>(std::move(parsed.value()));
+    }
 
-      return out.size() == before;
+    /**
+     * @brief Execute validation and stream errors into any ErrorSink.
+     *
+     * @return true if ok (no error was produced), false otherwise.
+     */
+    template <ErrorSink S>
+      requires(!std::is_same_v<S, ValidationErrors>)
+    [[nodiscard]] bool result_into(
+        S &sink,
+        ValidationPolicy policy = ValidationPolicy::AllErrors,
+        ErrorText parse_message = ErrorText::literal("invalid value")) const
+    {
+      ValidationErrors stream{ErrorSinkRef(sink)};
+      return result_into(stream, policy, std::move(parse_message));
     }
 
     /**
      * @brief Execute validation and return a standalone ValidationResult.
      */
     [[nodiscard]] ValidationResult result(
-        std::string parse_message = "invalid value") const
+        ErrorText parse_message = ErrorText::literal("invalid value")) const
+    {
+      return result(ValidationPolicy::AllErrors, std::move(parse_message));
+    }
+
+    /**
+     * @brief Execute validation under a policy and return a ValidationResult.
+     */
+    [[nodiscard]] ValidationResult result(
+        ValidationPolicy policy,
+        ErrorText parse_message = ErrorText::literal("invalid value")) const
     {
       ValidationErrors out;
-      (void)result_into(out, std::move(parse_message));
+      (void)result_into(out, policy, std::move(parse_message));
       return ValidationResult{std::move(out)};
     }
 
+    /**
+     * @brief Parse and evaluate the rules as a predicate, without building errors.
+     */
+    [[nodiscard]] bool is_valid() const
+    {
+      auto parsed = vix::conversion::parse<T>(input_);
+      return parsed && test_rules<T>(parsed.value(), rules_);
+    }
+
   private:
     std::string_view field_;
     std::string_view input_;
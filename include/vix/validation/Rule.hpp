@@ -15,49 +15,324 @@
 #ifndef VIX_VALIDATION_RULE_HPP
 #define VIX_VALIDATION_RULE_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <memory>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <vix/validation/ValidationErrors.hpp>
+#include <vix/validation/ValidationPolicy.hpp>
 #include <vix/validation/ValidationResult.hpp>
 
 namespace vix::validation
 {
 
+  namespace detail
+  {
+    /**
+     * @brief Detects a `bool test(const T&) const` predicate on a rule object.
+     */
+    template <typename R, typename T, typename = void>
+    struct has_rule_test : std::false_type
+    {
+    };
+
+    template <typename R, typename T>
+    struct has_rule_test<R, T, std::void_t<decltype(static_cast<bool>(std::declval<const R &>().test(std::declval<const T &>())))>>
+        : std::true_type
+    {
+    };
+
+    template <typename R, typename T>
+    inline constexpr bool has_rule_test_v = has_rule_test<R, T>::value;
+
+    /**
+     * @brief Evaluate a rule as a pass/fail predicate.
+     *
+     * Rule objects that expose `test()` are evaluated without building any
+     * ValidationError. Plain callables fall back to running into a scratch
+     * collector, which only allocates when they actually report an error.
+     */
+    template <typename R, typename T>
+    [[nodiscard]] inline bool test_rule(const R &rule, const T &value)
+    {
+      if constexpr (has_rule_test_v<R, T>)
+      {
+        return static_cast<bool>(rule.test(value));
+      }
+      else
+      {
+        ValidationErrors scratch;
+        rule(std::string_view{}, value, scratch);
+        return scratch.empty();
+      }
+    }
+
+    /**
+     * @brief Detects a block predicate
+     * `void fail_block(const T *values, std::size_t n, std::uint64_t *failed) const`.
+     */
+    template <typename R, typename T, typename = void>
+    struct has_rule_fail_block : std::false_type
+    {
+    };
+
+    template <typename R, typename T>
+    struct has_rule_fail_block<R, T, std::void_t<decltype(std::declval<const R &>().fail_block(std::declval<const T *>(), std::size_t{}, std::declval<std::uint64_t *>()))>>
+        : std::true_type
+    {
+    };
+
+    template <typename R, typename T>
+    inline constexpr bool has_rule_fail_block_v = has_rule_fail_block<R, T>::value;
+
+    /**
+     * @brief Evaluate a rule over `n` contiguous values.
+     *
+     * Sets bit i of `failed` (which the caller zeroes) for each value that
+     * fails. Rules with their own `fail_block()` (range rules) run a
+     * vectorized kernel; others are tested value by value.
+     */
+    template <typename R, typename T>
+    inline void fail_block_rule(const R &rule, const T *values, std::size_t n, std::uint64_t *failed)
+    {
+      if constexpr (has_rule_fail_block_v<R, T>)
+      {
+        rule.fail_block(values, n, failed);
+      }
+      else
+      {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          const bool bad = !test_rule(rule, values[i]);
+          failed[i / 64] |= (static_cast<std::uint64_t>(bad) << (i % 64));
+        }
+      }
+    }
+  } // namespace detail
+
   /**
    * @brief Rule<T> represents a single validation rule for a value of type T.
    *
    * A rule is a callable that can push errors into ValidationErrors.
+   * Built-in rule objects (rules::Min, rules::Email, ...) convert to Rule<T>
+   * implicitly; see StaticFieldSpec for a non type-erased alternative.
    *
    * Signature:
    *   void(std::string_view field, const T &value, ValidationErrors &out)
+   *
+   * Besides the error-reporting call, Rule<T> offers `test(value)`, a
+   * predicate form used by `Schema::is_valid()`. It forwards to the wrapped
+   * rule's own `test()` when there is one, so built-in rules answer without
+   * building ValidationError objects.
+   *
+   * The callable must be invocable through a const reference: rules are
+   * shared by every thread validating with the same schema.
    */
   template <typename T>
-  using Rule = std::function<void(std::string_view, const T &, ValidationErrors &)>;
+  class Rule
+  {
+  public:
+    Rule() noexcept = default;
+
+    Rule(std::nullptr_t) noexcept
+    {
+    }
+
+    template <typename F>
+      requires(!std::is_same_v<std::remove_cvref_t<F>, Rule> &&
+               std::is_invocable_v<std::remove_cvref_t<F> &, std::string_view, const T &, ValidationErrors &>)
+    Rule(F &&fn)
+        : impl_(std::make_unique<Model<std::remove_cvref_t<F>>>(std::forward<F>(fn)))
+    {
+      static_assert(std::is_invocable_v<const std::remove_cvref_t<F> &, std::string_view, const T &, ValidationErrors &>,
+                    "Rule<T> callables must be invocable as const: a rule may be shared by "
+                    "concurrent validations, so it cannot keep mutable state");
+    }
+
+    Rule(const Rule &other)
+        : impl_(other.impl_ ? other.impl_->clone() : nullptr)
+    {
+    }
+
+    Rule(Rule &&) noexcept = default;
+
+    Rule &operator=(const Rule &other)
+    {
+      if (this != &other)
+      {
+        impl_ = other.impl_ ? other.impl_->clone() : nullptr;
+      }
+      return *this;
+    }
+
+    Rule &operator=(Rule &&) noexcept = default;
+
+    ~Rule() = default;
+
+    /**
+     * @brief Run the rule and append errors into `out`.
+     *
+     * @throws std::bad_function_call if the rule is empty (like std::function).
+     */
+    void operator()(std::string_view field, const T &value, ValidationErrors &out) const
+    {
+      if (!impl_)
+      {
+        throw std::bad_function_call();
+      }
+      impl_->emit(field, value, out);
+    }
+
+    /**
+     * @brief Pass/fail predicate. An empty rule always passes.
+     */
+    [[nodiscard]] bool test(const T &value) const
+    {
+      return !impl_ || impl_->test(value);
+    }
+
+    /**
+     * @brief Block predicate: set bit i of `failed` when values[i] fails.
+     *
+     * One virtual call per block; built-in range rules then run a SIMD
+     * kernel. An empty rule marks nothing.
+     */
+    void fail_block(const T *values, std::size_t n, std::uint64_t *failed) const
+    {
+      if (impl_)
+      {
+        impl_->fail_block(values, n, failed);
+      }
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept
+    {
+      return static_cast<bool>(impl_);
+    }
+
+  private:
+    struct Concept
+    {
+      virtual ~Concept() = default;
+      virtual void emit(std::string_view field, const T &value, ValidationErrors &out) const = 0;
+      [[nodiscard]] virtual bool test(const T &value) const = 0;
+      virtual void fail_block(const T *values, std::size_t n, std::uint64_t *failed) const = 0;
+      [[nodiscard]] virtual std::unique_ptr<Concept> clone() const = 0;
+    };
+
+    template <typename F>
+    struct Model final : Concept
+    {
+      template <typename U>
+      explicit Model(U &&f)
+          : fn(std::forward<U>(f))
+      {
+      }
+
+      void emit(std::string_view field, const T &value, ValidationErrors &out) const override
+      {
+        fn(field, value, out);
+      }
+
+      [[nodiscard]] bool test(const T &value) const override
+      {
+        if constexpr (detail::has_rule_test_v<F, T>)
+        {
+          return static_cast<bool>(fn.test(value));
+        }
+        else
+        {
+          ValidationErrors scratch;
+          fn(std::string_view{}, value, scratch);
+          return scratch.empty();
+        }
+      }
+
+      void fail_block(const T *values, std::size_t n, std::uint64_t *failed) const override
+      {
+        detail::fail_block_rule(fn, values, n, failed);
+      }
+
+      [[nodiscard]] std::unique_ptr<Concept> clone() const override
+      {
+        return std::make_unique<Model>(fn);
+      }
+
+      F fn;
+    };
+
+    std::unique_ptr<Concept> impl_;
+  };
 
   /**
    * @brief Apply rules to a value and append errors into an existing collector.
    *
    * Useful when validating multiple fields/models and accumulating everything
    * into a single ValidationErrors instance.
+   *
+   * With a policy other than AllErrors, the remaining rules are skipped as
+   * soon as one of them reports an error. They are also skipped once a
+   * streaming `out` reports its sink full.
    */
   template <typename T>
   inline void apply_rules_into(
       std::string_view field,
       const T &value,
       const std::vector<Rule<T>> &rules,
-      ValidationErrors &out)
+      ValidationErrors &out,
+      ValidationPolicy policy = ValidationPolicy::AllErrors)
   {
+    const std::size_t before = out.size();
+
     for (const auto &rule : rules)
     {
       if (rule)
       {
         rule(field, value, out);
+
+        if (detail::policy_stops_field(policy, out.size() - before) || out.full())
+        {
+          return;
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Evaluate a list of rules as a predicate (no errors are built).
+   *
+   * Stops at the first failing rule.
+   */
+  template <typename T>
+  [[nodiscard]] inline bool test_rules(const T &value, const std::vector<Rule<T>> &rules)
+  {
+    for (const auto &rule : rules)
+    {
+      if (!rule.test(value))
+      {
+        return false;
       }
     }
+    return true;
+  }
+
+  /**
+   * @brief Block form of test_rules(): set bit i of `failed` when values[i]
+   * fails any rule.
+   */
+  template <typename T>
+  inline void fail_block_rules(const T *values, std::size_t n, const std::vector<Rule<T>> &rules, std::uint64_t *failed)
+  {
+    for (const auto &rule : rules)
+    {
+      rule.fail_block(values, n, failed);
+    }
   }
 
   /**
@@ -67,10 +342,11 @@ namespace vix::validation
   [[nodiscard]] inline ValidationResult apply_rules(
       std::string_view field,
       const T &value,
-      const std::vector<Rule<T>> &rules)
+      const std::vector<Rule<T>> &rules,
+      ValidationPolicy policy = ValidationPolicy::AllErrors)
   {
     ValidationErrors errors;
-    apply_rules_into(field, value, rules, errors);
+    apply_rules_into(field, value, rules, errors, policy);
     return ValidationResult{std::move(errors)};
   }
 
@@ -84,7 +360,7 @@ namespace vix::validation
   [[nodiscard]] inline ValidationResult apply_rules(
       std::string_view field,
       const T &value,
-      std::initializer_list<Rule<T>> rules)
+      std::initializer_list<std::type_identity_t<Rule<T>>> rules)
   {
     ValidationErrors errors;
 
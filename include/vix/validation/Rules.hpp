@@ -16,16 +16,25 @@
 #define VIX_VALIDATION_RULES_HPP
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <vix/validation/CharSet.hpp>
+#include <vix/validation/Kernels.hpp>
+#include <vix/validation/Pattern.hpp>
 #include <vix/validation/Rule.hpp>
+#include <vix/validation/StaticStringSet.hpp>
+#include <vix/validation/StringSet.hpp>
+#include <vix/validation/TextKernels.hpp>
 #include <vix/validation/ValidationError.hpp>
 
 namespace vix::validation::rules
@@ -34,261 +43,1023 @@ namespace vix::validation::rules
   namespace detail
   {
 
-    [[nodiscard]] inline std::unordered_map<std::string, std::string>
-    meta_kv(std::initializer_list<std::pair<std::string, std::string>> items)
+    /**
+     * @brief Build error meta; keys must be string literals (they are borrowed).
+     */
+    [[nodiscard]] inline ErrorMeta
+    meta_kv(std::initializer_list<std::pair<std::string_view, MetaValue>> items)
     {
-      std::unordered_map<std::string, std::string> m;
-      m.reserve(items.size());
-
+      ErrorMeta m;
       for (const auto &p : items)
       {
-        m.emplace(p.first, p.second);
+        m.set(ErrorText::borrowed(p.first), p.second);
       }
-
       return m;
     }
 
+    /**
+     * @brief Typed meta value for a checked value (numbers stay unformatted).
+     */
     template <typename T>
-    [[nodiscard]] inline std::string to_string_value(const T &v)
+    [[nodiscard]] inline MetaValue meta_value(const T &v)
     {
-      if constexpr (std::is_same_v<T, std::string>)
+      if constexpr (std::is_arithmetic_v<T> ||
+                    std::is_same_v<T, std::string> ||
+                    std::is_same_v<T, std::string_view>)
       {
-        return v;
+        return MetaValue(v);
       }
-      else if constexpr (std::is_same_v<T, std::string_view>)
+      else
       {
-        return std::string(v);
+        return MetaValue(ErrorText::literal("<value>"));
       }
-      else if constexpr (std::is_same_v<T, bool>)
+    }
+
+    /// @brief Longest string value copied verbatim into meta "got".
+    inline constexpr std::size_t got_max = 64;
+
+    /**
+     * @brief First got_max bytes of `value`, cut back to a UTF-8 boundary.
+     */
+    [[nodiscard]] inline std::string_view excerpt(std::string_view value) noexcept
+    {
+      if (value.size() <= got_max)
       {
-        return v ? "true" : "false";
+        return value;
       }
-      else if constexpr (std::is_arithmetic_v<T>)
+
+      std::size_t n = got_max;
+      while (n > 0 && (static_cast<unsigned char>(value[n]) & 0xC0) == 0x80)
       {
-        return std::to_string(v);
+        --n;
       }
-      else
+      return value.substr(0, n);
+    }
+
+    /**
+     * @brief InSet failure: "got" (an excerpt past got_max bytes, with
+     * "got_size") and "allowed_count".
+     */
+    inline void add_in_set_error(std::string_view field, std::string_view value, std::size_t allowed_count,
+                                 const ErrorText &message, ValidationErrors &out)
+    {
+      if (value.size() <= got_max)
       {
-        return "<value>";
+        out.add(validation::detail::field_text(field), ValidationErrorCode::InSet, message,
+                meta_kv({{"got", value},
+                         {"allowed_count", allowed_count}}));
+        return;
       }
+
+      out.add(validation::detail::field_text(field), ValidationErrorCode::InSet, message,
+              meta_kv({{"got", excerpt(value)},
+                       {"got_size", value.size()},
+                       {"allowed_count", allowed_count}}));
     }
 
-    [[nodiscard]] inline bool has_space(std::string_view s) noexcept
+    /**
+     * @brief Format error located in the value: "reason" (a literal) and
+     * the byte "offset" it refers to.
+     */
+    inline void add_format_error(std::string_view field, const char *reason, std::size_t offset,
+                                 const ErrorText &message, ValidationErrors &out)
     {
-      return std::find(s.begin(), s.end(), ' ') != s.end();
+      out.add(validation::detail::field_text(field), ValidationErrorCode::Format, message,
+              meta_kv({{"reason", ErrorText::borrowed(reason)},
+                       {"offset", offset}}));
     }
 
-  } // namespace detail
+    /**
+     * @brief Invalid UTF-8: code Format, "reason" and byte "offset".
+     */
+    inline void add_utf8_error(std::string_view field, const kernels::Utf8Scan &scan,
+                               const ErrorText &message, ValidationErrors &out)
+    {
+      add_format_error(field, "invalid_utf8", scan.error, message, out);
+    }
 
-  [[nodiscard]] inline Rule<std::string>
-  required(std::string message = "field is required")
-  {
-    return [msg = std::move(message)](std::string_view field, const std::string &value, ValidationErrors &out)
+    /**
+     * @brief Base64 (RFC 4648 section 4, or section 5 when `url`) check.
+     *
+     * Standard: length a multiple of 4, at most two trailing '='.
+     * URL-safe: padding optional, but if present the length is a multiple
+     * of 4; an unpadded length % 4 == 1 can never be produced.
+     * Returns the reason, or nullptr, and sets `offset`.
+     */
+    [[nodiscard]] inline const char *base64_reason(std::string_view value, bool url, std::size_t &offset) noexcept
+    {
+      const std::size_t n = value.size();
+      const std::size_t body = kernels::charset_find(value, url ? charsets::base64url : charsets::base64);
+      if (body == std::string_view::npos)
+      {
+        offset = n;
+        return (url ? n % 4 == 1 : n % 4 != 0) ? "padding" : nullptr;
+      }
+
+      for (std::size_t j = body; j < n; ++j)
+      {
+        if (value[j] != '=')
+        {
+          offset = j;
+          return "invalid_char";
+        }
+      }
+
+      offset = body;
+      return (n - body > 2 || n % 4 != 0) ? "padding" : nullptr;
+    }
+
+    /**
+     * @brief Slug check: [a-z0-9-], no leading, trailing or doubled '-'.
+     * Returns the reason, or nullptr, and sets `offset`.
+     */
+    [[nodiscard]] inline const char *slug_reason(std::string_view value, std::size_t &offset) noexcept
     {
+      offset = kernels::charset_find(value, charsets::slug);
+      if (offset != std::string_view::npos)
+      {
+        return "invalid_char";
+      }
       if (value.empty())
       {
-        out.add(std::string(field), ValidationErrorCode::Required, msg);
+        return nullptr;
       }
+
+      offset = value.front() == '-' ? 0 : value.find("--");
+      if (offset == std::string_view::npos && value.back() == '-')
+      {
+        offset = value.size() - 1;
+      }
+      return offset == std::string_view::npos ? nullptr : "hyphen";
+    }
+
+    template <typename T>
+    struct is_optional : std::false_type
+    {
     };
-  }
 
-  [[nodiscard]] inline Rule<std::string_view>
-  required_sv(std::string message = "field is required")
-  {
-    return [msg = std::move(message)](std::string_view field, std::string_view value, ValidationErrors &out)
+    template <typename T>
+    struct is_optional<std::optional<T>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_optional_v = is_optional<T>::value;
+
+    [[nodiscard]] inline bool has_space(std::string_view s) noexcept
+    {
+      return std::find(s.begin(), s.end(), ' ') != s.end();
+    }
+
+    /**
+     * @brief Reason code for an invalid email, or nullptr when it passes.
+     *
+     * Reasons are checked in a fixed order: empty, space, missing_at,
+     * multiple_at, missing_dot. The string is read once
+     * (kernels::email_scan), and the scan stops at the first space.
+     */
+    [[nodiscard]] inline const char *email_reason(std::string_view value, kernels::EmailScan &scan) noexcept
     {
       if (value.empty())
       {
-        out.add(std::string(field), ValidationErrorCode::Required, msg);
+        return "empty";
       }
+
+      scan = kernels::email_scan(value);
+
+      if (scan.space)
+      {
+        return "space";
+      }
+
+      if (scan.at == std::string_view::npos || scan.at == 0)
+      {
+        return "missing_at";
+      }
+
+      if (scan.multiple_at)
+      {
+        return "multiple_at";
+      }
+
+      if (scan.dot == std::string_view::npos || scan.dot == scan.at + 1 || scan.dot == value.size() - 1)
+      {
+        return "missing_dot";
+      }
+
+      return nullptr;
+    }
+
+    [[nodiscard]] inline const char *email_reason(std::string_view value) noexcept
+    {
+      kernels::EmailScan scan;
+      return email_reason(value, scan);
+    }
+
+    /// @brief Character classes for EmailMode::Strict.
+    enum : std::uint8_t
+    {
+      email_local = 1,  // RFC 5322 atext, plus '.'
+      email_domain = 2, // letters, digits, '-', '.'
     };
-  }
 
+    inline constexpr std::array<std::uint8_t, 256> email_classes = []
+    {
+      std::array<std::uint8_t, 256> t{};
+      for (int c = 'a'; c <= 'z'; ++c)
+      {
+        t[static_cast<std::size_t>(c)] = email_local | email_domain;
+        t[static_cast<std::size_t>(c - 'a' + 'A')] = email_local | email_domain;
+      }
+      for (int c = '0'; c <= '9'; ++c)
+      {
+        t[static_cast<std::size_t>(c)] = email_local | email_domain;
+      }
+      for (char c : std::string_view("!#$%&'*+/=?^_`{|}~"))
+      {
+        t[static_cast<unsigned char>(c)] = email_local;
+      }
+      t['-'] = email_local | email_domain;
+      t['.'] = email_local | email_domain;
+      return t;
+    }();
+
+    /**
+     * @brief Reason code under EmailMode::Strict, or nullptr when it passes.
+     *
+     * Basic reasons keep their precedence. Then: too_long (> 254 bytes),
+     * local_length (> 64), local_char, local_dot (leading, trailing or
+     * doubled '.'), domain_char, domain_label (empty label, label > 63, or
+     * a label that starts or ends with '-').
+     *
+     * The length limits are checked before any per-character work, so an
+     * input of any size costs one SIMD scan plus at most 254 table lookups.
+     */
+    [[nodiscard]] inline const char *email_strict_reason(std::string_view value) noexcept
+    {
+      kernels::EmailScan scan;
+      if (const char *reason = email_reason(value, scan))
+      {
+        return reason;
+      }
+
+      if (value.size() > 254)
+      {
+        return "too_long";
+      }
+      if (scan.at > 64)
+      {
+        return "local_length";
+      }
+
+      const std::string_view local = value.substr(0, scan.at);
+      const std::string_view domain = value.substr(scan.at + 1);
+
+      // Branch-free accumulation: the loops are bounded by the limits above.
+      unsigned classes = email_local;
+      unsigned doubled = 0;
+      char prev = '\0';
+      for (char c : local)
+      {
+        classes &= email_classes[static_cast<unsigned char>(c)];
+        doubled |= static_cast<unsigned>(c == '.') & static_cast<unsigned>(prev == '.');
+        prev = c;
+      }
+      if (!(classes & email_local))
+      {
+        return "local_char";
+      }
+      if (doubled || local.front() == '.' || local.back() == '.')
+      {
+        return "local_dot";
+      }
+
+      classes = email_domain;
+      unsigned bad_label = 0;
+      std::size_t label = 0;
+      prev = '.';
+      for (char c : domain)
+      {
+        const unsigned dot = c == '.';
+        classes &= email_classes[static_cast<unsigned char>(c)];
+        // A label may not be empty, nor start or end with '-'.
+        bad_label |= (dot & static_cast<unsigned>(prev == '.' || prev == '-')) |
+                     static_cast<unsigned>(c == '-' && prev == '.');
+        label = dot ? 0 : label + 1;
+        bad_label |= static_cast<unsigned>(label > 63);
+        prev = c;
+      }
+      if (!(classes & email_domain))
+      {
+        return "domain_char";
+      }
+      if (bad_label || prev == '.' || prev == '-')
+      {
+        return "domain_label";
+      }
+      return nullptr;
+    }
+
+  } // namespace detail
+
+  /*
+   * Rule objects.
+   *
+   * Every built-in rule exposes two entry points:
+   * - test(value):             pure pass/fail predicate, never allocates
+   * - operator()(field, v, out): appends a ValidationError on failure
+   *
+   * The predicate form backs Schema::is_valid() and BaseModel::is_valid().
+   */
+
+  /**
+   * @brief Rule object: the value must not be empty.
+   *
+   * Works for std::string, std::string_view and std::optional<U>
+   * (where "empty" means "no value").
+   */
   template <typename T>
-  [[nodiscard]] inline Rule<std::optional<T>>
-  required(std::string message = "field is required")
+  struct Required
   {
-    return [msg = std::move(message)](std::string_view field, const std::optional<T> &value, ValidationErrors &out)
+    ErrorText message{ErrorText::literal("field is required")};
+
+    [[nodiscard]] bool test(const T &value) const noexcept
     {
-      if (!value.has_value())
+      if constexpr (detail::is_optional_v<T>)
       {
-        out.add(std::string(field), ValidationErrorCode::Required, msg);
+        return value.has_value();
       }
-    };
-  }
+      else
+      {
+        return !value.empty();
+      }
+    }
 
+    void operator()(std::string_view field, const T &value, ValidationErrors &out) const
+    {
+      if (!test(value))
+      {
+        out.add(validation::detail::field_text(field), ValidationErrorCode::Required, message);
+      }
+    }
+  };
+
+  /**
+   * @brief Rule object: arithmetic value must be >= min_value.
+   */
   template <typename T>
-  [[nodiscard]] inline Rule<T>
-  min(T min_value, std::string message = "value is below minimum")
+  struct Min
   {
-    static_assert(std::is_arithmetic_v<T>, "rules::min<T>: T must be arithmetic");
+    static_assert(std::is_arithmetic_v<T>, "rules::Min<T>: T must be arithmetic");
 
-    return [min_value, msg = std::move(message)](std::string_view field, const T &value, ValidationErrors &out)
+    T min_value{};
+    ErrorText message{ErrorText::literal("value is below minimum")};
+
+    [[nodiscard]] bool test(const T &value) const noexcept
+    {
+      return !(value < min_value);
+    }
+
+    /// @brief Block form of test(): set bit i of `failed` when values[i] fails.
+    void fail_block(const T *values, std::size_t n, std::uint64_t *failed) const noexcept
+    {
+      kernels::range_bits(values, n, min_value, kernels::highest<T>(), failed, detected_simd_level());
+    }
+
+    void operator()(std::string_view field, const T &value, ValidationErrors &out) const
     {
-      if (value < min_value)
+      if (!test(value))
       {
         out.add(
-            std::string(field),
+            validation::detail::field_text(field),
             ValidationErrorCode::Min,
-            msg,
-            detail::meta_kv({{"min", detail::to_string_value(min_value)},
-                             {"got", detail::to_string_value(value)}}));
+            message,
+            detail::meta_kv({{"min", detail::meta_value(min_value)},
+                             {"got", detail::meta_value(value)}}));
       }
-    };
-  }
+    }
+  };
 
+  /**
+   * @brief Rule object: arithmetic value must be <= max_value.
+   */
   template <typename T>
-  [[nodiscard]] inline Rule<T>
-  max(T max_value, std::string message = "value is above maximum")
+  struct Max
   {
-    static_assert(std::is_arithmetic_v<T>, "rules::max<T>: T must be arithmetic");
+    static_assert(std::is_arithmetic_v<T>, "rules::Max<T>: T must be arithmetic");
 
-    return [max_value, msg = std::move(message)](std::string_view field, const T &value, ValidationErrors &out)
+    T max_value{};
+    ErrorText message{ErrorText::literal("value is above maximum")};
+
+    [[nodiscard]] bool test(const T &value) const noexcept
+    {
+      return !(value > max_value);
+    }
+
+    /// @brief Block form of test(): set bit i of `failed` when values[i] fails.
+    void fail_block(const T *values, std::size_t n, std::uint64_t *failed) const noexcept
+    {
+      kernels::range_bits(values, n, kernels::lowest<T>(), max_value, failed, detected_simd_level());
+    }
+
+    void operator()(std::string_view field, const T &value, ValidationErrors &out) const
     {
-      if (value > max_value)
+      if (!test(value))
       {
         out.add(
-            std::string(field),
+            validation::detail::field_text(field),
             ValidationErrorCode::Max,
-            msg,
-            detail::meta_kv({{"max", detail::to_string_value(max_value)},
-                             {"got", detail::to_string_value(value)}}));
+            message,
+            detail::meta_kv({{"max", detail::meta_value(max_value)},
+                             {"got", detail::meta_value(value)}}));
       }
-    };
-  }
+    }
+  };
 
+  /**
+   * @brief Rule object: arithmetic value must be in [min_value, max_value].
+   */
   template <typename T>
-  [[nodiscard]] inline Rule<T>
-  between(T min_value, T max_value, std::string message = "value is out of range")
+  struct Between
   {
-    static_assert(std::is_arithmetic_v<T>, "rules::between<T>: T must be arithmetic");
+    static_assert(std::is_arithmetic_v<T>, "rules::Between<T>: T must be arithmetic");
 
-    return [min_value, max_value, msg = std::move(message)](std::string_view field, const T &value, ValidationErrors &out)
+    T min_value{};
+    T max_value{};
+    ErrorText message{ErrorText::literal("value is out of range")};
+
+    [[nodiscard]] bool test(const T &value) const noexcept
+    {
+      return !(value < min_value || value > max_value);
+    }
+
+    /// @brief Block form of test(): set bit i of `failed` when values[i] fails.
+    void fail_block(const T *values, std::size_t n, std::uint64_t *failed) const noexcept
+    {
+      kernels::range_bits(values, n, min_value, max_value, failed, detected_simd_level());
+    }
+
+    void operator()(std::string_view field, const T &value, ValidationErrors &out) const
     {
-      if (value < min_value || value > max_value)
+      if (!test(value))
       {
         out.add(
-            std::string(field),
+            validation::detail::field_text(field),
             ValidationErrorCode::Between,
-            msg,
-            detail::meta_kv({{"min", detail::to_string_value(min_value)},
-                             {"max", detail::to_string_value(max_value)},
-                             {"got", detail::to_string_value(value)}}));
+            message,
+            detail::meta_kv({{"min", detail::meta_value(min_value)},
+                             {"max", detail::meta_value(max_value)},
+                             {"got", detail::meta_value(value)}}));
       }
-    };
-  }
+    }
+  };
 
-  [[nodiscard]] inline Rule<std::string>
-  length_min(std::size_t n, std::string message = "length is below minimum")
+  /**
+   * @brief Rule object: string length (in bytes) must be >= n.
+   */
+  struct LengthMin
   {
-    return [n, msg = std::move(message)](std::string_view field, const std::string &value, ValidationErrors &out)
+    std::size_t n{0};
+    ErrorText message{ErrorText::literal("length is below minimum")};
+
+    [[nodiscard]] bool test(const std::string &value) const noexcept
     {
-      if (value.size() < n)
+      return value.size() >= n;
+    }
+
+    void operator()(std::string_view field, const std::string &value, ValidationErrors &out) const
+    {
+      if (!test(value))
       {
         out.add(
-            std::string(field),
+            validation::detail::field_text(field),
             ValidationErrorCode::LengthMin,
-            msg,
-            detail::meta_kv({{"min", std::to_string(n)},
-                             {"got", std::to_string(value.size())}}));
+            message,
+            detail::meta_kv({{"min", n},
+                             {"got", value.size()}}));
       }
-    };
-  }
+    }
+  };
 
-  [[nodiscard]] inline Rule<std::string>
-  length_max(std::size_t n, std::string message = "length is above maximum")
+  /**
+   * @brief Rule object: string length (in bytes) must be <= n.
+   */
+  struct LengthMax
   {
-    return [n, msg = std::move(message)](std::string_view field, const std::string &value, ValidationErrors &out)
+    std::size_t n{0};
+    ErrorText message{ErrorText::literal("length is above maximum")};
+
+    [[nodiscard]] bool test(const std::string &value) const noexcept
+    {
+      return value.size() <= n;
+    }
+
+    void operator()(std::string_view field, const std::string &value, ValidationErrors &out) const
     {
-      if (value.size() > n)
+      if (!test(value))
       {
         out.add(
-            std::string(field),
+            validation::detail::field_text(field),
             ValidationErrorCode::LengthMax,
-            msg,
-            detail::meta_kv({{"max", std::to_string(n)},
-                             {"got", std::to_string(value.size())}}));
+            message,
+            detail::meta_kv({{"max", n},
+                             {"got", value.size()}}));
       }
-    };
-  }
+    }
+  };
 
-  [[nodiscard]] inline Rule<std::string>
-  in_set(std::vector<std::string> allowed, std::string message = "value is not allowed")
+  /**
+   * @brief Rule object: value must be well-formed UTF-8.
+   *
+   * Failures carry code Format, meta "reason" = "invalid_utf8" and
+   * "offset", the byte offset of the first invalid sequence.
+   */
+  struct Utf8Valid
   {
-    std::unordered_set<std::string> set;
-    set.reserve(allowed.size());
-    for (auto &s : allowed)
+    ErrorText message{ErrorText::literal("invalid UTF-8")};
+
+    [[nodiscard]] bool test(std::string_view value) const noexcept
     {
-      set.insert(std::move(s));
+      return kernels::utf8_scan(value).valid();
     }
 
-    return [set = std::move(set), msg = std::move(message)](std::string_view field, const std::string &value, ValidationErrors &out)
+    void operator()(std::string_view field, std::string_view value, ValidationErrors &out) const
     {
-      if (set.find(value) == set.end())
+      const kernels::Utf8Scan scan = kernels::utf8_scan(value);
+      if (!scan.valid())
       {
-        out.add(
-            std::string(field),
-            ValidationErrorCode::InSet,
-            msg,
-            detail::meta_kv({{"got", value},
-                             {"allowed_count", std::to_string(set.size())}}));
+        detail::add_utf8_error(field, scan, message, out);
       }
-    };
-  }
+    }
+  };
 
   /**
-   * @brief Very lightweight email format check.
+   * @brief Rule object: length in code points within [min_length, max_length].
    *
-   * Not RFC-complete. Intended as a basic input guard:
-   * - contains exactly one '@'
-   * - at least one char before '@'
-   * - at least one '.' after '@'
-   * - no spaces
+   * Backs utf8_length_min / utf8_length_max / utf8_length_between; an
+   * unbounded side is not reported in meta. Invalid UTF-8, whose length is
+   * undefined, fails with the same code and meta as Utf8Valid but carries
+   * this rule's message.
    */
-  [[nodiscard]] inline Rule<std::string>
-  email(std::string message = "invalid email format")
+  struct Utf8Length
   {
-    return [msg = std::move(message)](std::string_view field, const std::string &value, ValidationErrors &out)
+    std::size_t min_length{0};
+    std::size_t max_length{std::numeric_limits<std::size_t>::max()};
+    ErrorText message{ErrorText::literal("length is out of range")};
+
+    [[nodiscard]] bool test(std::string_view value) const noexcept
     {
-      if (value.empty())
+      const kernels::Utf8Scan scan = kernels::utf8_scan(value);
+      return scan.valid() && scan.length >= min_length && scan.length <= max_length;
+    }
+
+    void operator()(std::string_view field, std::string_view value, ValidationErrors &out) const
+    {
+      const kernels::Utf8Scan scan = kernels::utf8_scan(value);
+      if (!scan.valid())
       {
-        out.add(std::string(field), ValidationErrorCode::Format, msg,
-                detail::meta_kv({{"reason", "empty"}}));
+        detail::add_utf8_error(field, scan, message, out);
         return;
       }
 
-      if (detail::has_space(value))
+      const bool low = scan.length < min_length;
+      if (!low && scan.length <= max_length)
       {
-        out.add(std::string(field), ValidationErrorCode::Format, msg,
-                detail::meta_kv({{"reason", "space"}}));
         return;
       }
 
-      const auto at = value.find('@');
-      if (at == std::string::npos || at == 0)
+      const bool has_min = min_length != 0;
+      const bool has_max = max_length != std::numeric_limits<std::size_t>::max();
+      const ValidationErrorCode code = low ? ValidationErrorCode::LengthMin : ValidationErrorCode::LengthMax;
+      ErrorMeta meta = has_min && has_max
+                           ? detail::meta_kv({{"min", min_length}, {"max", max_length}, {"got", scan.length}})
+                       : has_min ? detail::meta_kv({{"min", min_length}, {"got", scan.length}})
+                                 : detail::meta_kv({{"max", max_length}, {"got", scan.length}});
+      out.add(validation::detail::field_text(field), code, message, std::move(meta));
+    }
+  };
+
+  /**
+   * @brief Rule object: every byte must belong to a CharSet.
+   *
+   * Failures carry code Format, meta "reason" = "invalid_char" and the
+   * "offset" of the first byte outside the set. Empty values pass.
+   */
+  struct Charset
+  {
+    CharSet set;
+    ErrorText message{ErrorText::literal("invalid character")};
+
+    [[nodiscard]] bool test(std::string_view value) const noexcept
+    {
+      return kernels::charset_find(value, set) == std::string_view::npos;
+    }
+
+    void operator()(std::string_view field, std::string_view value, ValidationErrors &out) const
+    {
+      const std::size_t offset = kernels::charset_find(value, set);
+      if (offset != std::string_view::npos)
       {
-        out.add(std::string(field), ValidationErrorCode::Format, msg,
-                detail::meta_kv({{"reason", "missing_at"}}));
-        return;
+        detail::add_format_error(field, "invalid_char", offset, message, out);
       }
+    }
+  };
+
+  /**
+   * @brief Rule object: base64 or base64url text.
+   *
+   * Reasons: "invalid_char" (offset of the byte) or "padding" (offset
+   * where the padding starts, or the length when it is missing).
+   * @see detail::base64_reason
+   */
+  struct Base64
+  {
+    bool url{false};
+    ErrorText message{ErrorText::literal("invalid base64")};
+
+    [[nodiscard]] bool test(std::string_view value) const noexcept
+    {
+      std::size_t offset = 0;
+      return detail::base64_reason(value, url, offset) == nullptr;
+    }
 
-      if (value.find('@', at + 1) != std::string::npos)
+    void operator()(std::string_view field, std::string_view value, ValidationErrors &out) const
+    {
+      std::size_t offset = 0;
+      if (const char *why = detail::base64_reason(value, url, offset))
       {
-        out.add(std::string(field), ValidationErrorCode::Format, msg,
-                detail::meta_kv({{"reason", "multiple_at"}}));
-        return;
+        detail::add_format_error(field, why, offset, message, out);
+      }
+    }
+  };
+
+  /**
+   * @brief Rule object: URL slug ([a-z0-9-], hyphens only between words).
+   *
+   * Reasons: "invalid_char" or "hyphen", with the offending "offset".
+   */
+  struct Slug
+  {
+    ErrorText message{ErrorText::literal("invalid slug")};
+
+    [[nodiscard]] bool test(std::string_view value) const noexcept
+    {
+      std::size_t offset = 0;
+      return detail::slug_reason(value, offset) == nullptr;
+    }
+
+    void operator()(std::string_view field, std::string_view value, ValidationErrors &out) const
+    {
+      std::size_t offset = 0;
+      if (const char *why = detail::slug_reason(value, offset))
+      {
+        detail::add_format_error(field, why, offset, message, out);
       }
+    }
+  };
+
+  /**
+   * @brief Rule object: value must match a regular expression.
+   *
+   * The expression is compiled to a DFA when the rule is created (see
+   * Pattern); checking a value is one table lookup per byte. On failure,
+   * reason "pattern" and "offset" where the match became impossible.
+   */
+  struct Matches
+  {
+    Pattern pattern;
+    ErrorText message{ErrorText::literal("invalid format")};
+
+    [[nodiscard]] bool test(std::string_view value) const noexcept
+    {
+      return pattern.matches(value);
+    }
 
-      const auto dot = value.find('.', at + 1);
-      if (dot == std::string::npos || dot == at + 1 || dot == value.size() - 1)
+    void operator()(std::string_view field, std::string_view value, ValidationErrors &out) const
+    {
+      const std::size_t offset = pattern.mismatch(value);
+      if (offset != std::string_view::npos)
       {
-        out.add(std::string(field), ValidationErrorCode::Format, msg,
-                detail::meta_kv({{"reason", "missing_dot"}}));
-        return;
+        detail::add_format_error(field, "pattern", offset, message, out);
       }
-    };
+    }
+  };
+
+  /**
+   * @brief Rule object: string must be one of a fixed set of values.
+   *
+   * Works on std::string and std::string_view values alike; the lookup
+   * never copies the value (see StringSet for the storage layouts).
+   */
+  struct InSet
+  {
+    StringSet allowed;
+    ErrorText message{ErrorText::literal("value is not allowed")};
+
+    [[nodiscard]] bool test(std::string_view value) const noexcept
+    {
+      return allowed.contains(value);
+    }
+
+    void operator()(std::string_view field, std::string_view value, ValidationErrors &out) const
+    {
+      if (!test(value))
+      {
+        detail::add_in_set_error(field, value, allowed.size(), message, out);
+      }
+    }
+  };
+
+  /**
+   * @brief Rule object: in_set over values fixed at compile time.
+   *
+   * Same errors as InSet; the lookup tables are built by the compiler
+   * (see StaticStringSet), so the rule holds only its message.
+   */
+  template <FixedString... Values>
+  struct InSetCt
+  {
+    using Set = StaticStringSet<Values...>;
+
+    ErrorText message{ErrorText::literal("value is not allowed")};
+
+    [[nodiscard]] static constexpr bool test(std::string_view value) noexcept
+    {
+      return Set::contains(value);
+    }
+
+    void operator()(std::string_view field, std::string_view value, ValidationErrors &out) const
+    {
+      if (!test(value))
+      {
+        detail::add_in_set_error(field, value, Set::size(), message, out);
+      }
+    }
+  };
+
+  /**
+   * @brief How strictly rules::email checks its input.
+   */
+  enum class EmailMode : std::uint8_t
+  {
+    /// Structure only: one '@', something before it, a '.' after it, no spaces.
+    Basic,
+
+    /// Basic, plus RFC 5321/5322-style character classes and lengths for
+    /// the local part and the domain labels (see detail::email_strict_reason).
+    Strict
+  };
+
+  /**
+   * @brief Rule object: lightweight email format check.
+   *
+   * Not RFC-complete. Intended as a basic input guard:
+   * - contains exactly one '@'
+   * - at least one char before '@'
+   * - at least one '.' after '@'
+   * - no spaces
+   *
+   * The input is read in a single pass (SIMD when available), so long or
+   * adversarial inputs cost one linear scan. EmailMode::Strict adds
+   * character-class checks, still in one pass.
+   */
+  struct Email
+  {
+    ErrorText message{ErrorText::literal("invalid email format")};
+    EmailMode mode{EmailMode::Basic};
+
+    [[nodiscard]] const char *reason(std::string_view value) const noexcept
+    {
+      return mode == EmailMode::Strict ? detail::email_strict_reason(value) : detail::email_reason(value);
+    }
+
+    [[nodiscard]] bool test(const std::string &value) const noexcept
+    {
+      return reason(value) == nullptr;
+    }
+
+    void operator()(std::string_view field, const std::string &value, ValidationErrors &out) const
+    {
+      if (const char *why = reason(value))
+      {
+        out.add(validation::detail::field_text(field), ValidationErrorCode::Format, message,
+                detail::meta_kv({{"reason", ErrorText::borrowed(why)}}));
+      }
+    }
+  };
+
+  /*
+   * Factories.
+   *
+   * Each factory returns a concrete rule object. Rule objects convert
+   * implicitly to Rule<T> (type-erased), and can also be stored by value
+   * in a StaticFieldSpec to avoid std::function dispatch entirely.
+   */
+
+  [[nodiscard]] inline Required<std::string>
+  required(ErrorText message = ErrorText::literal("field is required"))
+  {
+    return Required<std::string>{std::move(message)};
+  }
+
+  [[nodiscard]] inline Required<std::string_view>
+  required_sv(ErrorText message = ErrorText::literal("field is required"))
+  {
+    return Required<std::string_view>{std::move(message)};
+  }
+
+  template <typename T>
+  [[nodiscard]] inline Required<std::optional<T>>
+  required(ErrorText message = ErrorText::literal("field is required"))
+  {
+    return Required<std::optional<T>>{std::move(message)};
+  }
+
+  template <typename T>
+  [[nodiscard]] inline Min<T>
+  min(T min_value, ErrorText message = ErrorText::literal("value is below minimum"))
+  {
+    static_assert(std::is_arithmetic_v<T>, "rules::min<T>: T must be arithmetic");
+    return Min<T>{min_value, std::move(message)};
+  }
+
+  template <typename T>
+  [[nodiscard]] inline Max<T>
+  max(T max_value, ErrorText message = ErrorText::literal("value is above maximum"))
+  {
+    static_assert(std::is_arithmetic_v<T>, "rules::max<T>: T must be arithmetic");
+    return Max<T>{max_value, std::move(message)};
+  }
+
+  template <typename T>
+  [[nodiscard]] inline Between<T>
+  between(T min_value, T max_value, ErrorText message = ErrorText::literal("value is out of range"))
+  {
+    static_assert(std::is_arithmetic_v<T>, "rules::between<T>: T must be arithmetic");
+    return Between<T>{min_value, max_value, std::move(message)};
+  }
+
+  [[nodiscard]] inline LengthMin
+  length_min(std::size_t n, ErrorText message = ErrorText::literal("length is below minimum"))
+  {
+    return LengthMin{n, std::move(message)};
+  }
+
+  [[nodiscard]] inline LengthMax
+  length_max(std::size_t n, ErrorText message = ErrorText::literal("length is above maximum"))
+  {
+    return LengthMax{n, std::move(message)};
+  }
+
+  /**
+   * @brief Every byte must belong to `set` (see CharSet, charsets).
+   * @see Charset
+   */
+  [[nodiscard]] inline Charset
+  charset(const CharSet &set, ErrorText message = ErrorText::literal("invalid character"))
+  {
+    return Charset{set, std::move(message)};
+  }
+
+  [[nodiscard]] inline Charset
+  ascii(ErrorText message = ErrorText::literal("must be ASCII"))
+  {
+    return Charset{charsets::ascii, std::move(message)};
+  }
+
+  [[nodiscard]] inline Charset
+  printable(ErrorText message = ErrorText::literal("must be printable ASCII"))
+  {
+    return Charset{charsets::printable, std::move(message)};
+  }
+
+  [[nodiscard]] inline Charset
+  alnum(ErrorText message = ErrorText::literal("must be alphanumeric"))
+  {
+    return Charset{charsets::alnum, std::move(message)};
+  }
+
+  [[nodiscard]] inline Charset
+  hex(ErrorText message = ErrorText::literal("must be hexadecimal"))
+  {
+    return Charset{charsets::hex, std::move(message)};
+  }
+
+  [[nodiscard]] inline Base64
+  base64(ErrorText message = ErrorText::literal("invalid base64"))
+  {
+    return Base64{false, std::move(message)};
+  }
+
+  [[nodiscard]] inline Base64
+  base64url(ErrorText message = ErrorText::literal("invalid base64url"))
+  {
+    return Base64{true, std::move(message)};
+  }
+
+  [[nodiscard]] inline Slug
+  slug(ErrorText message = ErrorText::literal("invalid slug"))
+  {
+    return Slug{std::move(message)};
+  }
+
+  /**
+   * @brief Value must match `source` (regex_search semantics; anchor with ^...$).
+   * @throws std::invalid_argument on unsupported syntax (see Pattern).
+   * @see Matches
+   */
+  [[nodiscard]] inline Matches
+  pattern(std::string_view source, ErrorText message = ErrorText::literal("invalid format"))
+  {
+    return Matches{Pattern(source), std::move(message)};
+  }
+
+  /// @brief Same, reusing an already compiled Pattern.
+  [[nodiscard]] inline Matches
+  pattern(const Pattern &compiled, ErrorText message = ErrorText::literal("invalid format"))
+  {
+    return Matches{compiled, std::move(message)};
+  }
+
+  [[nodiscard]] inline Utf8Valid
+  utf8_valid(ErrorText message = ErrorText::literal("invalid UTF-8"))
+  {
+    return Utf8Valid{std::move(message)};
+  }
+
+  /**
+   * @brief Length in code points must be >= n (value must be valid UTF-8).
+   * @see Utf8Length
+   */
+  [[nodiscard]] inline Utf8Length
+  utf8_length_min(std::size_t n, ErrorText message = ErrorText::literal("length is below minimum"))
+  {
+    return Utf8Length{n, std::numeric_limits<std::size_t>::max(), std::move(message)};
+  }
+
+  /**
+   * @brief Length in code points must be <= n (value must be valid UTF-8).
+   * @see Utf8Length
+   */
+  [[nodiscard]] inline Utf8Length
+  utf8_length_max(std::size_t n, ErrorText message = ErrorText::literal("length is above maximum"))
+  {
+    return Utf8Length{0, n, std::move(message)};
+  }
+
+  /**
+   * @brief Length in code points must be within [min_length, max_length].
+   * @see Utf8Length
+   */
+  [[nodiscard]] inline Utf8Length
+  utf8_length_between(std::size_t min_length, std::size_t max_length,
+                      ErrorText message = ErrorText::literal("length is out of range"))
+  {
+    return Utf8Length{min_length, max_length, std::move(message)};
+  }
+
+  [[nodiscard]] inline InSet
+  in_set(std::vector<std::string> allowed, ErrorText message = ErrorText::literal("value is not allowed"))
+  {
+    return InSet{StringSet(allowed), std::move(message)};
+  }
+
+  /**
+   * @brief in_set with values fixed at compile time: `in_set_ct<"a", "b">()`.
+   * @see InSetCt
+   */
+  template <FixedString... Values>
+  [[nodiscard]] inline InSetCt<Values...>
+  in_set_ct(ErrorText message = ErrorText::literal("value is not allowed"))
+  {
+    return InSetCt<Values...>{std::move(message)};
+  }
+
+  /**
+   * @brief Very lightweight email format check.
+   * @see Email
+   */
+  [[nodiscard]] inline Email
+  email(ErrorText message = ErrorText::literal("invalid email format"))
+  {
+    return Email{std::move(message)};
+  }
+
+  /**
+   * @brief Email format check with an explicit mode.
+   * @see Email, EmailMode
+   */
+  [[nodiscard]] inline Email
+  email(EmailMode mode, ErrorText message = ErrorText::literal("invalid email format"))
+  {
+    return Email{std::move(message), mode};
   }
 
 } // namespace vix::validation::rules
 
+namespace vix::validation
+{
+  using rules::EmailMode;
+} // namespace vix::validation
+
 #endif
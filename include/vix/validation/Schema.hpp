@@ -15,18 +15,30 @@
 #ifndef VIX_VALIDATION_SCHEMA_HPP
 #define VIX_VALIDATION_SCHEMA_HPP
 
-#include <functional>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <vix/validation/ErrorSink.hpp>
+#include <vix/validation/JsonValue.hpp>
 #include <vix/validation/Pipe.hpp>
 #include <vix/validation/Rule.hpp>
 #include <vix/validation/Rules.hpp>
+#include <vix/validation/StaticField.hpp>
+#include <vix/validation/StringSet.hpp>
 #include <vix/validation/Validate.hpp>
 #include <vix/validation/ValidationErrors.hpp>
+#include <vix/validation/ValidationPolicy.hpp>
 #include <vix/validation/ValidationResult.hpp>
 
 namespace vix::validation
@@ -69,12 +81,22 @@ namespace vix::validation
     inline constexpr bool is_validation_result_v =
         is_validation_result<remove_cvref_t<Ret>>::value;
 
+    template <typename Ret, typename FieldT>
+    struct is_validator_builder : std::false_type
+    {
+    };
+
+    template <typename FieldT, typename... Rules>
+    struct is_validator_builder<Validator<FieldT, Rules...>, FieldT> : std::true_type
+    {
+    };
+
     /**
-     * @brief Trait: true if Ret is Validator<FieldT> (cv/ref ignored).
+     * @brief Trait: true if Ret is a Validator<FieldT, ...> builder (cv/ref ignored).
      */
     template <typename Ret, typename FieldT>
     inline constexpr bool is_validator_builder_v =
-        std::is_same_v<remove_cvref_t<Ret>, Validator<FieldT>>;
+        is_validator_builder<remove_cvref_t<Ret>, FieldT>::value;
 
     /**
      * @brief Trait: true if Ret is ParsedValidator<ParsedT> (cv/ref ignored).
@@ -92,6 +114,87 @@ namespace vix::validation
     inline constexpr bool is_check_void_v =
         std::is_same_v<remove_cvref_t<Ret>, void>;
 
+    /**
+     * @brief Thread-local index in the error container where the record
+     * being validated starts.
+     *
+     * A batch chunk appends the errors of many records to one container;
+     * policy trimming must only look at the current record's errors.
+     */
+    inline std::size_t &record_begin_slot() noexcept
+    {
+      thread_local std::size_t slot = 0;
+      return slot;
+    }
+
+    /// @brief RAII publisher for record_begin_slot().
+    class RecordScope
+    {
+    public:
+      explicit RecordScope(std::size_t begin) noexcept
+          : previous_(record_begin_slot())
+      {
+        record_begin_slot() = begin;
+      }
+
+      RecordScope(const RecordScope &) = delete;
+      RecordScope &operator=(const RecordScope &) = delete;
+
+      ~RecordScope()
+      {
+        record_begin_slot() = previous_;
+      }
+
+    private:
+      std::size_t previous_;
+    };
+
+    /**
+     * @brief Trim errors appended after `before` so they respect `policy`.
+     *
+     * Used for checks whose output cannot be cut short from the inside
+     * (ValidationResult-returning callables, cross-field checks):
+     * - AllErrors:          keep everything
+     * - FirstErrorPerField: drop errors for fields that already have one
+     *                       in the current record (see RecordScope)
+     * - FailFast:           keep only the first new error
+     */
+    inline void enforce_policy_tail(ValidationErrors &out, std::size_t before, ValidationPolicy policy)
+    {
+      auto &all = out.all_mut();
+      if (policy == ValidationPolicy::AllErrors || all.size() <= before + 1)
+      {
+        return;
+      }
+
+      if (policy == ValidationPolicy::FailFast)
+      {
+        all.erase(all.begin() + static_cast<std::ptrdiff_t>(before + 1), all.end());
+        return;
+      }
+
+      const std::size_t first = std::min(record_begin_slot(), before);
+      std::size_t kept = before;
+      for (std::size_t i = before; i < all.size(); ++i)
+      {
+        bool seen = false;
+        for (std::size_t j = first; j < kept && !seen; ++j)
+        {
+          seen = all[j].field == all[i].field;
+        }
+
+        if (!seen)
+        {
+          if (kept != i)
+          {
+            all[kept] = std::move(all[i]);
+          }
+          ++kept;
+        }
+      }
+      all.erase(all.begin() + static_cast<std::ptrdiff_t>(kept), all.end());
+    }
+
   } // namespace detail
 
   /**
@@ -138,7 +241,7 @@ namespace vix::validation
      * @brief Require a non-empty string.
      * @note Enabled only for std::string.
      */
-    FieldSpec &required(std::string message = "field is required")
+    FieldSpec &required(ErrorText message = ErrorText::literal("field is required"))
       requires std::is_same_v<FieldT, std::string>
     {
       return rule(rules::required(std::move(message)));
@@ -148,7 +251,7 @@ namespace vix::validation
      * @brief Enforce minimum string length.
      * @note Enabled only for std::string.
      */
-    FieldSpec &length_min(std::size_t n, std::string message = "length is below minimum")
+    FieldSpec &length_min(std::size_t n, ErrorText message = ErrorText::literal("length is below minimum"))
       requires std::is_same_v<FieldT, std::string>
     {
       return rule(rules::length_min(n, std::move(message)));
@@ -158,37 +261,200 @@ namespace vix::validation
      * @brief Enforce maximum string length.
      * @note Enabled only for std::string.
      */
-    FieldSpec &length_max(std::size_t n, std::string message = "length is above maximum")
+    FieldSpec &length_max(std::size_t n, ErrorText message = ErrorText::literal("length is above maximum"))
       requires std::is_same_v<FieldT, std::string>
     {
       return rule(rules::length_max(n, std::move(message)));
     }
 
+    /**
+     * @brief Every byte must belong to `set`.
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &charset(const CharSet &set, ErrorText message = ErrorText::literal("invalid character"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::charset(set, std::move(message)));
+    }
+
+    /**
+     * @brief Bytes must be ASCII (0x00-0x7F).
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &ascii(ErrorText message = ErrorText::literal("must be ASCII"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::ascii(std::move(message)));
+    }
+
+    /**
+     * @brief Bytes must be printable ASCII (0x20-0x7E).
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &printable(ErrorText message = ErrorText::literal("must be printable ASCII"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::printable(std::move(message)));
+    }
+
+    /**
+     * @brief Bytes must be ASCII letters or digits.
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &alnum(ErrorText message = ErrorText::literal("must be alphanumeric"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::alnum(std::move(message)));
+    }
+
+    /**
+     * @brief Bytes must be hexadecimal digits.
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &hex(ErrorText message = ErrorText::literal("must be hexadecimal"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::hex(std::move(message)));
+    }
+
+    /**
+     * @brief Standard base64 with padding.
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &base64(ErrorText message = ErrorText::literal("invalid base64"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::base64(std::move(message)));
+    }
+
+    /**
+     * @brief URL-safe base64, padding optional.
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &base64url(ErrorText message = ErrorText::literal("invalid base64url"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::base64url(std::move(message)));
+    }
+
+    /**
+     * @brief URL slug: [a-z0-9-], hyphens only between words.
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &slug(ErrorText message = ErrorText::literal("invalid slug"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::slug(std::move(message)));
+    }
+
+    /**
+     * @brief Match a regular expression, compiled here, once (see Pattern).
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &pattern(std::string_view source, ErrorText message = ErrorText::literal("invalid format"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::pattern(source, std::move(message)));
+    }
+
+    /**
+     * @brief Match an already compiled Pattern.
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &pattern(const Pattern &compiled, ErrorText message = ErrorText::literal("invalid format"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::pattern(compiled, std::move(message)));
+    }
+
+    /**
+     * @brief Require well-formed UTF-8 (meta "offset" locates the first bad byte).
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &utf8_valid(ErrorText message = ErrorText::literal("invalid UTF-8"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::utf8_valid(std::move(message)));
+    }
+
+    /**
+     * @brief Require at least n code points.
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &utf8_length_min(std::size_t n, ErrorText message = ErrorText::literal("length is below minimum"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::utf8_length_min(n, std::move(message)));
+    }
+
+    /**
+     * @brief Require at most n code points.
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &utf8_length_max(std::size_t n, ErrorText message = ErrorText::literal("length is above maximum"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::utf8_length_max(n, std::move(message)));
+    }
+
+    /**
+     * @brief Require a code point count within [min_length, max_length].
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &utf8_length_between(std::size_t min_length, std::size_t max_length,
+                                   ErrorText message = ErrorText::literal("length is out of range"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::utf8_length_between(min_length, max_length, std::move(message)));
+    }
+
     /**
      * @brief Validate email format.
      * @note Enabled only for std::string.
      */
-    FieldSpec &email(std::string message = "invalid email format")
+    FieldSpec &email(ErrorText message = ErrorText::literal("invalid email format"))
       requires std::is_same_v<FieldT, std::string>
     {
       return rule(rules::email(std::move(message)));
     }
 
     /**
-     * @brief Validate membership in a set of allowed string values.
+     * @brief Validate email format with an explicit mode (e.g. EmailMode::Strict).
      * @note Enabled only for std::string.
      */
-    FieldSpec &in_set(std::vector<std::string> allowed, std::string message = "value is not allowed")
+    FieldSpec &email(EmailMode mode, ErrorText message = ErrorText::literal("invalid email format"))
       requires std::is_same_v<FieldT, std::string>
+    {
+      return rule(rules::email(mode, std::move(message)));
+    }
+
+    /**
+     * @brief Validate membership in a set of allowed string values.
+     * @note Enabled for std::string and std::string_view.
+     */
+    FieldSpec &in_set(std::vector<std::string> allowed, ErrorText message = ErrorText::literal("value is not allowed"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
     {
       return rule(rules::in_set(std::move(allowed), std::move(message)));
     }
 
+    /**
+     * @brief Validate membership in values fixed at compile time:
+     * `.in_set_ct<"USD", "EUR">()`.
+     * @note Enabled for std::string and std::string_view.
+     */
+    template <FixedString... Values>
+    FieldSpec &in_set_ct(ErrorText message = ErrorText::literal("value is not allowed"))
+      requires std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>
+    {
+      return rule(rules::in_set_ct<Values...>(std::move(message)));
+    }
+
     /**
      * @brief Enforce a minimum numeric value.
      * @note Enabled only for arithmetic types.
      */
-    FieldSpec &min(FieldT v, std::string message = "value is below minimum")
+    FieldSpec &min(FieldT v, ErrorText message = ErrorText::literal("value is below minimum"))
       requires std::is_arithmetic_v<FieldT>
     {
       return rule(rules::min<FieldT>(v, std::move(message)));
@@ -198,7 +464,7 @@ namespace vix::validation
      * @brief Enforce a maximum numeric value.
      * @note Enabled only for arithmetic types.
      */
-    FieldSpec &max(FieldT v, std::string message = "value is above maximum")
+    FieldSpec &max(FieldT v, ErrorText message = ErrorText::literal("value is above maximum"))
       requires std::is_arithmetic_v<FieldT>
     {
       return rule(rules::max<FieldT>(v, std::move(message)));
@@ -208,7 +474,7 @@ namespace vix::validation
      * @brief Enforce a numeric range [a, b].
      * @note Enabled only for arithmetic types.
      */
-    FieldSpec &between(FieldT a, FieldT b, std::string message = "value is out of range")
+    FieldSpec &between(FieldT a, FieldT b, ErrorText message = ErrorText::literal("value is out of range"))
       requires std::is_arithmetic_v<FieldT>
     {
       return rule(rules::between<FieldT>(a, b, std::move(message)));
@@ -274,7 +540,7 @@ namespace vix::validation
     /**
      * @brief Enforce a minimum numeric value.
      */
-    ParsedSpec &min(ParsedT v, std::string message = "value is below minimum")
+    ParsedSpec &min(ParsedT v, ErrorText message = ErrorText::literal("value is below minimum"))
       requires std::is_arithmetic_v<ParsedT>
     {
       return rule(rules::min<ParsedT>(v, std::move(message)));
@@ -283,7 +549,7 @@ namespace vix::validation
     /**
      * @brief Enforce a maximum numeric value.
      */
-    ParsedSpec &max(ParsedT v, std::string message = "value is above maximum")
+    ParsedSpec &max(ParsedT v, ErrorText message = ErrorText::literal("value is above maximum"))
       requires std::is_arithmetic_v<ParsedT>
     {
       return rule(rules::max<ParsedT>(v, std::move(message)));
@@ -292,7 +558,7 @@ namespace vix::validation
     /**
      * @brief Enforce a numeric range [a, b].
      */
-    ParsedSpec &between(ParsedT a, ParsedT b, std::string message = "value is out of range")
+    ParsedSpec &between(ParsedT a, ParsedT b, ErrorText message = ErrorText::literal("value is out of range"))
       requires std::is_arithmetic_v<ParsedT>
     {
       return rule(rules::between<ParsedT>(a, b, std::move(message)));
@@ -304,7 +570,7 @@ namespace vix::validation
      * This message is attached to the field as a validation error if the input
      * cannot be parsed into ParsedT.
      */
-    ParsedSpec &parse_message(std::string msg)
+    ParsedSpec &parse_message(ErrorText msg)
     {
       parse_message_ = std::move(msg);
       return *this;
@@ -321,14 +587,69 @@ namespace vix::validation
     /**
      * @brief Access parse-failure message (read-only).
      */
-    [[nodiscard]] const std::string &parse_message() const
+    [[nodiscard]] const ErrorText &parse_message() const
     {
       return parse_message_;
     }
 
+    /**
+     * @brief Parse `input` once and run the rules in place, appending errors into `out`.
+     *
+     * A parse failure produces exactly one error (with parse_message());
+     * otherwise the stored rules run on the parsed value under `policy`.
+     * Nothing is copied from the spec.
+     *
+     * @return true if ok (no new errors were added), false otherwise.
+     */
+    bool apply_into(
+        std::string_view field,
+        std::string_view input,
+        ValidationErrors &out,
+        ValidationPolicy policy = ValidationPolicy::AllErrors) const
+    {
+      return value_into(field, input, out, policy).has_value();
+    }
+
+    /**
+     * @brief Like apply_into(), but hands back the parsed value.
+     *
+     * @return the parsed value if parsing succeeded and every rule passed,
+     *         std::nullopt otherwise.
+     */
+    [[nodiscard]] std::optional<ParsedT> value_into(
+        std::string_view field,
+        std::string_view input,
+        ValidationErrors &out,
+        ValidationPolicy policy = ValidationPolicy::AllErrors) const
+    {
+      auto parsed = vix::conversion::parse<ParsedT>(input);
+      if (!parsed)
+      {
+        out.add(conversion_error_to_validation(field, parsed.error(), parse_message_));
+        return std::nullopt;
+      }
+
+      const std::size_t before = out.size();
+      apply_rules_into<ParsedT>(field, parsed.value(), rules_, out, policy);
+      if (out.size() != before)
+      {
+        return std::nullopt;
+      }
+      return std::optional<ParsedT>(std::move(parsed.value()));
+    }
+
+    /**
+     * @brief Parse `input` and evaluate the rules as a predicate, without building errors.
+     */
+    [[nodiscard]] bool test(std::string_view input) const
+    {
+      auto parsed = vix::conversion::parse<ParsedT>(input);
+      return parsed && test_rules<ParsedT>(parsed.value(), rules_);
+    }
+
   private:
     std::vector<Rule<ParsedT>> rules_;
-    std::string parse_message_{"invalid value"};
+    ErrorText parse_message_{ErrorText::literal("invalid value")};
   };
 
   /**
@@ -342,6 +663,600 @@ namespace vix::validation
     return ParsedSpec<ParsedT>{};
   }
 
+  namespace detail
+  {
+    /**
+     * @brief Read a string-like member as std::string_view.
+     */
+    template <typename T, typename FieldT>
+    [[nodiscard]] inline std::string_view input_of(const T &obj, FieldT T::*member) noexcept
+    {
+      if constexpr (std::is_same_v<FieldT, std::string>)
+      {
+        return std::string_view(obj.*member);
+      }
+      else
+      {
+        return obj.*member;
+      }
+    }
+
+    /// @brief One address per type, so CleanTarget needs no RTTI.
+    template <typename Clean>
+    inline constexpr char clean_type_tag = 0;
+
+    /**
+     * @brief Type-checked pointer to the object receiving checked values
+     *        (see Schema::validate_into(obj, out, clean)).
+     */
+    class CleanTarget
+    {
+    public:
+      CleanTarget() noexcept = default;
+
+      template <typename Clean>
+      explicit CleanTarget(Clean &clean) noexcept
+          : type_(&clean_type_tag<Clean>), object_(&clean)
+      {
+      }
+
+      /**
+       * @brief The target as a Clean.
+       * @throws std::invalid_argument if the target is missing or of another
+       *         type than the one the output member belongs to; silently
+       *         skipping the write would report success with a default value.
+       */
+      template <typename Clean>
+      [[nodiscard]] Clean &as() const
+      {
+        if (!object_ || type_ != &clean_type_tag<Clean>)
+        {
+          throw std::invalid_argument(
+              "vix::validation::Schema: clean object type does not match the output member's class");
+        }
+        return *static_cast<Clean *>(object_);
+      }
+
+    private:
+      const char *type_{nullptr};
+      void *object_{nullptr};
+    };
+
+    /**
+     * @brief One registered Schema check.
+     *
+     * Each check has two entry points:
+     * - run():  append errors into a collector, honoring a ValidationPolicy
+     * - test(): pass/fail only, used by Schema::is_valid()
+     */
+    template <typename T>
+    struct SchemaCheck
+    {
+      virtual ~SchemaCheck() = default;
+
+      virtual void run(const T &obj, ValidationErrors &out, ValidationPolicy policy) const = 0;
+
+      /**
+       * @brief Like run(), and also store the checked value into `target`
+       * when the check was registered with an output member.
+       */
+      virtual void run_into(const T &obj, ValidationErrors &out, ValidationPolicy policy, CleanTarget) const
+      {
+        run(obj, out, policy);
+      }
+
+      [[nodiscard]] virtual bool test(const T &obj) const = 0;
+
+      /**
+       * @brief Block predicate used by validate_batch (SchemaBatch.hpp).
+       *
+       * Sets bit i of `failed` (zeroed by the caller) when objs[i] fails
+       * test(); n <= block_rows. Returns false when the check has no block
+       * form, in which case it is simply run for every record.
+       */
+      virtual bool test_block(const T *objs, std::size_t n, std::uint64_t *failed) const
+      {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          const bool bad = !test(objs[i]);
+          failed[i / 64] |= (static_cast<std::uint64_t>(bad) << (i % 64));
+        }
+        return true;
+      }
+
+      /// @brief Field name, for checks bound to a member (see MemberCheck).
+      [[nodiscard]] virtual const ErrorText *field_name() const noexcept
+      {
+        return nullptr;
+      }
+
+      /**
+       * @brief Store a JSON value into the checked member (see
+       * validate_json in SchemaJson.hpp). Returns the reason of a type
+       * mismatch, or nullptr (see detail::json_assign).
+       */
+      [[nodiscard]] virtual const char *json_assign(T &, const JsonValue &) const
+      {
+        return "type";
+      }
+    };
+
+    /**
+     * @brief FirstErrorPerField: true when the field of `check` already has
+     * an error in the current record (see RecordScope), so the check is
+     * skipped. Checks that are not bound to a member always run.
+     */
+    template <typename T>
+    [[nodiscard]] inline bool field_already_failed(
+        const SchemaCheck<T> &check,
+        const ValidationErrors &out,
+        ValidationPolicy policy) noexcept
+    {
+      const auto &all = out.all();
+      const std::size_t first = record_begin_slot();
+      if (policy != ValidationPolicy::FirstErrorPerField || all.size() <= first)
+      {
+        return false;
+      }
+
+      const ErrorText *name = check.field_name();
+      if (name == nullptr)
+      {
+        return false;
+      }
+
+      for (std::size_t i = first; i < all.size(); ++i)
+      {
+        if (all[i].field == name->view())
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /// @brief Records per block in validate_batch (SchemaBatch.hpp).
+    inline constexpr std::size_t block_rows = 256;
+
+    /**
+     * @brief Block test of one member: arithmetic fields are gathered into a
+     * contiguous buffer and handed to `fail_block(values, n, failed)`
+     * (rule-major, SIMD for range rules); other fields are tested record by
+     * record with `test(value)`.
+     */
+    template <typename T, typename FieldT, typename BlockFn, typename TestFn>
+    inline void fail_block_member(
+        const T *objs,
+        std::size_t n,
+        FieldT T::*member,
+        std::uint64_t *failed,
+        BlockFn &&fail_block,
+        TestFn &&test)
+    {
+      if constexpr (std::is_arithmetic_v<FieldT>)
+      {
+        std::array<FieldT, block_rows> values{};
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          values[i] = objs[i].*member;
+        }
+        fail_block(values.data(), n, failed);
+      }
+      else
+      {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          const bool bad = !test(objs[i].*member);
+          failed[i / 64] |= (static_cast<std::uint64_t>(bad) << (i % 64));
+        }
+      }
+    }
+
+    /**
+     * @brief Base of the checks bound to a member: owns the field name and
+     * the member pointer, and stores JSON values into the member.
+     */
+    template <typename T, typename FieldT>
+    struct MemberCheck : SchemaCheck<T>
+    {
+      MemberCheck(ErrorText n, FieldT T::*m)
+          : name(std::move(n)), member(m)
+      {
+      }
+
+      [[nodiscard]] const ErrorText *field_name() const noexcept final
+      {
+        return &name;
+      }
+
+      [[nodiscard]] const char *json_assign(T &obj, const JsonValue &value) const final
+      {
+        return validation::detail::json_assign(obj.*member, value);
+      }
+
+      ErrorText name;
+      FieldT T::*member;
+    };
+
+    /// @brief Schema::field(name, member, callable)
+    template <typename T, typename FieldT, typename Fn>
+    struct FieldCallableCheck final : MemberCheck<T, FieldT>
+    {
+      using MemberCheck<T, FieldT>::name;
+      using MemberCheck<T, FieldT>::member;
+
+      static_assert(std::is_invocable_v<const Fn &, std::string_view, const FieldT &>,
+                    "Schema::field: callable must be invocable as const (no `mutable` lambdas); "
+                    "a schema is shared by concurrent validations.");
+
+      using Ret = std::invoke_result_t<const Fn &, std::string_view, const FieldT &>;
+
+      static_assert(is_validation_result_v<Ret> || is_validator_builder_v<Ret, FieldT>,
+                    "Schema::field: callable must return ValidationResult or Validator<FieldT>.");
+
+      FieldCallableCheck(ErrorText n, FieldT T::*m, Fn f)
+          : MemberCheck<T, FieldT>(std::move(n), m), fn(std::move(f))
+      {
+      }
+
+      void run(const T &obj, ValidationErrors &out, ValidationPolicy policy) const override
+      {
+        const FieldNameScope scope(name);
+        const FieldT &value = obj.*member;
+
+        if constexpr (is_validation_result_v<Ret>)
+        {
+          const std::size_t before = out.size();
+          ValidationResult r = fn(name.view(), value);
+          out.merge(std::move(r.errors));
+          enforce_policy_tail(out, before, policy);
+        }
+        else
+        {
+          fn(name.view(), value).result_into(out, policy);
+        }
+      }
+
+      [[nodiscard]] bool test(const T &obj) const override
+      {
+        const FieldT &value = obj.*member;
+
+        if constexpr (is_validation_result_v<Ret>)
+        {
+          return fn(name.view(), value).ok();
+        }
+        else
+        {
+          return fn(name.view(), value).is_valid();
+        }
+      }
+
+      Fn fn;
+    };
+
+    /// @brief Schema::field(name, member, FieldSpec)
+    template <typename T, typename FieldT>
+    struct FieldSpecCheck final : MemberCheck<T, FieldT>
+    {
+      using MemberCheck<T, FieldT>::name;
+      using MemberCheck<T, FieldT>::member;
+
+      FieldSpecCheck(ErrorText n, FieldT T::*m, FieldSpec<FieldT> s)
+          : MemberCheck<T, FieldT>(std::move(n), m), spec(std::move(s))
+      {
+      }
+
+      void run(const T &obj, ValidationErrors &out, ValidationPolicy policy) const override
+      {
+        const FieldNameScope scope(name);
+        apply_rules_into<FieldT>(name.view(), obj.*member, spec.rules(), out, policy);
+      }
+
+      [[nodiscard]] bool test(const T &obj) const override
+      {
+        return test_rules<FieldT>(obj.*member, spec.rules());
+      }
+
+      bool test_block(const T *objs, std::size_t n, std::uint64_t *failed) const override
+      {
+        fail_block_member(
+            objs, n, member, failed,
+            [this](const FieldT *values, std::size_t count, std::uint64_t *bits)
+            { fail_block_rules<FieldT>(values, count, spec.rules(), bits); },
+            [this](const FieldT &value)
+            { return test_rules<FieldT>(value, spec.rules()); });
+        return true;
+      }
+
+      FieldSpec<FieldT> spec;
+    };
+
+    /// @brief Schema::field(name, member, StaticFieldSpec)
+    template <typename T, typename FieldT, typename... Rules>
+    struct StaticFieldCheck final : MemberCheck<T, FieldT>
+    {
+      using MemberCheck<T, FieldT>::name;
+      using MemberCheck<T, FieldT>::member;
+
+      StaticFieldCheck(ErrorText n, FieldT T::*m, StaticFieldSpec<FieldT, Rules...> s)
+          : MemberCheck<T, FieldT>(std::move(n), m), spec(std::move(s))
+      {
+      }
+
+      void run(const T &obj, ValidationErrors &out, ValidationPolicy policy) const override
+      {
+        const FieldNameScope scope(name);
+        spec.apply_into(name.view(), obj.*member, out, policy);
+      }
+
+      [[nodiscard]] bool test(const T &obj) const override
+      {
+        return spec.test(obj.*member);
+      }
+
+      bool test_block(const T *objs, std::size_t n, std::uint64_t *failed) const override
+      {
+        fail_block_member(
+            objs, n, member, failed,
+            [this](const FieldT *values, std::size_t count, std::uint64_t *bits)
+            { spec.fail_block(values, count, bits); },
+            [this](const FieldT &value)
+            { return spec.test(value); });
+        return true;
+      }
+
+      StaticFieldSpec<FieldT, Rules...> spec;
+    };
+
+    /// @brief Schema::parsed(name, member, callable)
+    template <typename T, typename ParsedT, typename FieldT, typename Fn>
+    struct ParsedCallableCheck final : MemberCheck<T, FieldT>
+    {
+      using MemberCheck<T, FieldT>::name;
+      using MemberCheck<T, FieldT>::member;
+
+      static_assert(std::is_invocable_v<const Fn &, std::string_view, std::string_view>,
+                    "Schema::parsed: callable must be invocable as const (no `mutable` lambdas); "
+                    "a schema is shared by concurrent validations.");
+
+      using Ret = std::invoke_result_t<const Fn &, std::string_view, std::string_view>;
+
+      static_assert(is_validation_result_v<Ret> || is_parsed_builder_v<Ret, ParsedT>,
+                    "Schema::parsed: callable must return ValidationResult or ParsedValidator<ParsedT>.");
+
+      ParsedCallableCheck(ErrorText n, FieldT T::*m, Fn f)
+          : MemberCheck<T, FieldT>(std::move(n), m), fn(std::move(f))
+      {
+      }
+
+      void run(const T &obj, ValidationErrors &out, ValidationPolicy policy) const override
+      {
+        const FieldNameScope scope(name);
+        const std::string_view input = input_of(obj, member);
+
+        if constexpr (is_validation_result_v<Ret>)
+        {
+          const std::size_t before = out.size();
+          ValidationResult r = fn(name.view(), input);
+          out.merge(std::move(r.errors));
+          enforce_policy_tail(out, before, policy);
+        }
+        else
+        {
+          (void)fn(name.view(), input).result_into(out, policy);
+        }
+      }
+
+      [[nodiscard]] bool test(const T &obj) const override
+      {
+        const std::string_view input = input_of(obj, member);
+
+        if constexpr (is_validation_result_v<Ret>)
+        {
+          return fn(name.view(), input).ok();
+        }
+        else
+        {
+          return fn(name.view(), input).is_valid();
+        }
+      }
+
+      Fn fn;
+    };
+
+    /// @brief Schema::parsed(name, member, ParsedSpec)
+    template <typename T, typename ParsedT, typename FieldT>
+    struct ParsedSpecCheck final : MemberCheck<T, FieldT>
+    {
+      using MemberCheck<T, FieldT>::name;
+      using MemberCheck<T, FieldT>::member;
+
+      ParsedSpecCheck(ErrorText n, FieldT T::*m, ParsedSpec<ParsedT> s)
+          : MemberCheck<T, FieldT>(std::move(n), m), spec(std::move(s))
+      {
+      }
+
+      void run(const T &obj, ValidationErrors &out, ValidationPolicy policy) const override
+      {
+        const FieldNameScope scope(name);
+        (void)spec.apply_into(name.view(), input_of(obj, member), out, policy);
+      }
+
+      [[nodiscard]] bool test(const T &obj) const override
+      {
+        return spec.test(input_of(obj, member));
+      }
+
+      ParsedSpec<ParsedT> spec;
+    };
+
+    /// @brief Schema::field(name, member, FieldSpec, &Clean::member)
+    template <typename T, typename FieldT, typename Clean, typename OutT>
+    struct FieldSpecIntoCheck final : MemberCheck<T, FieldT>
+    {
+      using MemberCheck<T, FieldT>::name;
+      using MemberCheck<T, FieldT>::member;
+
+      FieldSpecIntoCheck(ErrorText n, FieldT T::*m, FieldSpec<FieldT> s, OutT Clean::*t)
+          : MemberCheck<T, FieldT>(std::move(n), m), spec(std::move(s)), target(t)
+      {
+      }
+
+      void run(const T &obj, ValidationErrors &out, ValidationPolicy policy) const override
+      {
+        const FieldNameScope scope(name);
+        apply_rules_into<FieldT>(name.view(), obj.*member, spec.rules(), out, policy);
+      }
+
+      void run_into(const T &obj, ValidationErrors &out, ValidationPolicy policy, CleanTarget clean) const override
+      {
+        Clean &dst = clean.as<Clean>();
+        const std::size_t before = out.size();
+        run(obj, out, policy);
+
+        if (out.size() == before)
+        {
+          dst.*target = static_cast<OutT>(obj.*member);
+        }
+      }
+
+      [[nodiscard]] bool test(const T &obj) const override
+      {
+        return test_rules<FieldT>(obj.*member, spec.rules());
+      }
+
+      bool test_block(const T *objs, std::size_t n, std::uint64_t *failed) const override
+      {
+        fail_block_member(
+            objs, n, member, failed,
+            [this](const FieldT *values, std::size_t count, std::uint64_t *bits)
+            { fail_block_rules<FieldT>(values, count, spec.rules(), bits); },
+            [this](const FieldT &value)
+            { return test_rules<FieldT>(value, spec.rules()); });
+        return true;
+      }
+
+      FieldSpec<FieldT> spec;
+      OutT Clean::*target;
+    };
+
+    /// @brief Schema::parsed(name, member, ParsedSpec, &Clean::member)
+    template <typename T, typename ParsedT, typename FieldT, typename Clean>
+    struct ParsedSpecIntoCheck final : MemberCheck<T, FieldT>
+    {
+      using MemberCheck<T, FieldT>::name;
+      using MemberCheck<T, FieldT>::member;
+
+      ParsedSpecIntoCheck(ErrorText n, FieldT T::*m, ParsedSpec<ParsedT> s, ParsedT Clean::*t)
+          : MemberCheck<T, FieldT>(std::move(n), m), spec(std::move(s)), target(t)
+      {
+      }
+
+      void run(const T &obj, ValidationErrors &out, ValidationPolicy policy) const override
+      {
+        const FieldNameScope scope(name);
+        (void)spec.apply_into(name.view(), input_of(obj, member), out, policy);
+      }
+
+      void run_into(const T &obj, ValidationErrors &out, ValidationPolicy policy, CleanTarget clean) const override
+      {
+        Clean &dst = clean.as<Clean>();
+        const FieldNameScope scope(name);
+        std::optional<ParsedT> value = spec.value_into(name.view(), input_of(obj, member), out, policy);
+
+        if (value)
+        {
+          dst.*target = std::move(*value);
+        }
+      }
+
+      [[nodiscard]] bool test(const T &obj) const override
+      {
+        return spec.test(input_of(obj, member));
+      }
+
+      ParsedSpec<ParsedT> spec;
+      ParsedT Clean::*target;
+    };
+
+    /// @brief Schema::check(callable)
+    template <typename T, typename Fn>
+    struct ObjectCheck final : SchemaCheck<T>
+    {
+      static constexpr bool with_errors = std::is_invocable_v<const Fn &, const T &, ValidationErrors &>;
+
+      static_assert(with_errors || std::is_invocable_v<const Fn &, const T &>,
+                    "Schema::check: callable must be invocable as const (no `mutable` lambdas); "
+                    "a schema is shared by concurrent validations.");
+
+      explicit ObjectCheck(Fn f)
+          : fn(std::move(f))
+      {
+      }
+
+      void run(const T &obj, ValidationErrors &out, ValidationPolicy policy) const override
+      {
+        const std::size_t before = out.size();
+
+        if constexpr (with_errors)
+        {
+          fn(obj, out);
+        }
+        else
+        {
+          ValidationResult r = fn(obj);
+          out.merge(std::move(r.errors));
+        }
+
+        enforce_policy_tail(out, before, policy);
+      }
+
+      [[nodiscard]] bool test(const T &obj) const override
+      {
+        if constexpr (with_errors)
+        {
+          ValidationErrors scratch;
+          fn(obj, scratch);
+          return scratch.empty();
+        }
+        else
+        {
+          return fn(obj).ok();
+        }
+      }
+
+      /// Cross-field checks have no block form: validate_batch runs them
+      /// per record, after the field checks were block-tested.
+      bool test_block(const T *, std::size_t, std::uint64_t *) const override
+      {
+        return false;
+      }
+
+      Fn fn;
+    };
+
+    /**
+     * @brief Field names of a Schema, built on the first validate_json()
+     * (SchemaJson.hpp) and cached with the checks.
+     *
+     * Checks registered under the same name form one group; `group_of[c]`
+     * is the group of check c, or StringSet::npos for `check()` entries.
+     */
+    struct JsonIndex
+    {
+      std::once_flag once;
+      StringSet names;
+      std::vector<std::size_t> group_of;
+      std::vector<std::vector<std::size_t>> groups;
+    };
+
+    /// @brief Batch validation driver, defined in SchemaBatch.hpp.
+    struct SchemaBlocks;
+
+    /// @brief JSON binding driver, defined in SchemaJson.hpp.
+    struct SchemaJson;
+  } // namespace detail
+
   /**
    * @class Schema
    * @brief Declarative validator for a type T.
@@ -353,9 +1268,17 @@ namespace vix::validation
    * - a parsed field (`Schema::parsed`)
    * - the whole object (`Schema::check`) for cross-field constraints
    *
-   * The schema itself is cheap to copy and easy to construct,
-   * but in typical usage it is cached by higher-level wrappers such as
-   * `BaseModel<T>` or `Form<T>`.
+   * Checks are immutable once registered and shared between copies, so the
+   * schema is cheap to copy. In typical usage it is cached by higher-level
+   * wrappers such as `BaseModel<T>` or `Form<T>`.
+   *
+   * Thread safety: once built, a Schema may be used by any number of
+   * threads at once (validate, validate_into, is_valid, validate_json
+   * from SchemaJson.hpp and validate_batch from SchemaBatch.hpp).
+   * Registered callables and rules must be invocable as const; a `mutable`
+   * lambda is rejected at compile time. State a check needs across calls
+   * must therefore be synchronized by the caller (e.g. an atomic counter
+   * captured by reference) or kept per thread (`thread_local`).
    *
    * @tparam T Type being validated.
    */
@@ -363,9 +1286,6 @@ namespace vix::validation
   class Schema
   {
   public:
-    /// @brief A validation check that can append errors into `ValidationErrors`.
-    using CheckFn = std::function<void(const T &, ValidationErrors &)>;
-
     Schema() = default;
 
     /**
@@ -379,37 +1299,11 @@ namespace vix::validation
      * a fluent validation style.
      */
     template <typename FieldT, typename F>
-    Schema &field(std::string field_name, FieldT T::*member, F &&fn)
+    Schema &field(ErrorText field_name, FieldT T::*member, F &&fn)
     {
       using Fn = detail::remove_cvref_t<F>;
-
-      checks_.push_back(
-          [name = std::move(field_name),
-           member,
-           fn2 = Fn(std::forward<F>(fn))](const T &obj, ValidationErrors &out) mutable
-          {
-            const FieldT &value = obj.*member;
-
-            using Ret = std::invoke_result_t<Fn &, std::string_view, const FieldT &>;
-
-            if constexpr (detail::is_validation_result_v<Ret>)
-            {
-              ValidationResult r = fn2(name, value);
-              out.merge(r.errors);
-            }
-            else if constexpr (detail::is_validator_builder_v<Ret, FieldT>)
-            {
-              ValidationResult r = fn2(name, value).result();
-              out.merge(r.errors);
-            }
-            else
-            {
-              static_assert(detail::dependent_false_v<FieldT>,
-                            "Schema::field: callable must return ValidationResult or Validator<FieldT>.");
-            }
-          });
-
-      return *this;
+      return add_check<detail::FieldCallableCheck<T, FieldT, Fn>>(
+          std::move(field_name), member, Fn(std::forward<F>(fn)));
     }
 
     /**
@@ -419,18 +1313,34 @@ namespace vix::validation
      * it avoids lambdas while staying explicit.
      */
     template <typename FieldT>
-    Schema &field(std::string field_name, FieldT T::*member, FieldSpec<FieldT> spec)
+    Schema &field(ErrorText field_name, FieldT T::*member, FieldSpec<FieldT> spec)
     {
-      checks_.push_back(
-          [name = std::move(field_name),
-           member,
-           rules = std::move(spec)](const T &obj, ValidationErrors &out) mutable
-          {
-            const FieldT &value = obj.*member;
-            apply_rules_into<FieldT>(name, value, rules.rules(), out);
-          });
+      return add_check<detail::FieldSpecCheck<T, FieldT>>(
+          std::move(field_name), member, std::move(spec));
+    }
 
-      return *this;
+    /**
+     * @brief Register a field validation using a FieldSpec whose value is
+     * copied into `target` by `validate_into(obj, out, clean)` when it passes.
+     */
+    template <typename FieldT, typename Clean, typename OutT>
+    Schema &field(ErrorText field_name, FieldT T::*member, FieldSpec<FieldT> spec, OutT Clean::*target)
+    {
+      return add_check<detail::FieldSpecIntoCheck<T, FieldT, Clean, OutT>>(
+          std::move(field_name), member, std::move(spec), target);
+    }
+
+    /**
+     * @brief Register a typed field validation using a StaticFieldSpec.
+     *
+     * Rules are stored by value and called directly (no std::function per
+     * rule), which lets the compiler inline the whole field pipeline.
+     */
+    template <typename FieldT, typename... Rules>
+    Schema &field(ErrorText field_name, FieldT T::*member, StaticFieldSpec<FieldT, Rules...> spec)
+    {
+      return add_check<detail::StaticFieldCheck<T, FieldT, Rules...>>(
+          std::move(field_name), member, std::move(spec));
     }
 
     /**
@@ -443,46 +1353,12 @@ namespace vix::validation
      *     -> ValidationResult OR ParsedValidator<ParsedT>
      */
     template <typename ParsedT, typename FieldT, typename F>
-    Schema &parsed(std::string field_name, FieldT T::*member, F &&fn)
+    Schema &parsed(ErrorText field_name, FieldT T::*member, F &&fn)
       requires(std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>)
     {
       using Fn = detail::remove_cvref_t<F>;
-
-      checks_.push_back(
-          [name = std::move(field_name),
-           member,
-           fn2 = Fn(std::forward<F>(fn))](const T &obj, ValidationErrors &out) mutable
-          {
-            std::string_view input;
-            if constexpr (std::is_same_v<FieldT, std::string>)
-            {
-              input = std::string_view(obj.*member);
-            }
-            else
-            {
-              input = (obj.*member);
-            }
-
-            using Ret = std::invoke_result_t<Fn &, std::string_view, std::string_view>;
-
-            if constexpr (detail::is_validation_result_v<Ret>)
-            {
-              ValidationResult r = fn2(name, input);
-              out.merge(r.errors);
-            }
-            else if constexpr (detail::is_parsed_builder_v<Ret, ParsedT>)
-            {
-              ValidationResult r = fn2(name, input).result();
-              out.merge(r.errors);
-            }
-            else
-            {
-              static_assert(detail::dependent_false_v<FieldT>,
-                            "Schema::parsed: callable must return ValidationResult or ParsedValidator<ParsedT>.");
-            }
-          });
-
-      return *this;
+      return add_check<detail::ParsedCallableCheck<T, ParsedT, FieldT, Fn>>(
+          std::move(field_name), member, Fn(std::forward<F>(fn)));
     }
 
     /**
@@ -491,33 +1367,26 @@ namespace vix::validation
      * FieldT must be std::string or std::string_view.
      */
     template <typename ParsedT, typename FieldT>
-    Schema &parsed(std::string field_name, FieldT T::*member, ParsedSpec<ParsedT> spec)
+    Schema &parsed(ErrorText field_name, FieldT T::*member, ParsedSpec<ParsedT> spec)
       requires(std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>)
     {
-      checks_.push_back(
-          [name = std::move(field_name),
-           member,
-           rules = std::move(spec)](const T &obj, ValidationErrors &out) mutable
-          {
-            std::string_view input;
-            if constexpr (std::is_same_v<FieldT, std::string>)
-            {
-              input = std::string_view(obj.*member);
-            }
-            else
-            {
-              input = (obj.*member);
-            }
-
-            ParsedValidator<ParsedT> v(name, input);
-            for (const auto &r : rules.rules())
-            {
-              v.rule(r);
-            }
-            (void)v.result_into(out, rules.parse_message());
-          });
+      return add_check<detail::ParsedSpecCheck<T, ParsedT, FieldT>>(
+          std::move(field_name), member, std::move(spec));
+    }
 
-      return *this;
+    /**
+     * @brief Register a parsed field validation whose parsed value is stored
+     * into `target` by `validate_into(obj, out, clean)`.
+     *
+     * The input is parsed once; the value that passed the rules is moved
+     * into `clean.*target`, so a Form's cleaned_type never re-parses it.
+     */
+    template <typename ParsedT, typename FieldT, typename Clean>
+    Schema &parsed(ErrorText field_name, FieldT T::*member, ParsedSpec<ParsedT> spec, ParsedT Clean::*target)
+      requires(std::is_same_v<FieldT, std::string> || std::is_same_v<FieldT, std::string_view>)
+    {
+      return add_check<detail::ParsedSpecIntoCheck<T, ParsedT, FieldT, Clean>>(
+          std::move(field_name), member, std::move(spec), target);
     }
 
     /**
@@ -537,57 +1406,176 @@ namespace vix::validation
     {
       using Fn = detail::remove_cvref_t<F>;
 
-      checks_.push_back(
-          [fn2 = Fn(std::forward<F>(fn))](const T &obj, ValidationErrors &out) mutable
-          {
-            if constexpr (std::is_invocable_v<Fn &, const T &, ValidationErrors &>)
-            {
-              using Ret = std::invoke_result_t<Fn &, const T &, ValidationErrors &>;
-              static_assert(detail::is_check_void_v<Ret, T>,
-                            "Schema::check: (const T&, ValidationErrors&) callable must return void.");
-              fn2(obj, out);
-            }
-            else if constexpr (std::is_invocable_v<Fn &, const T &>)
-            {
-              using Ret = std::invoke_result_t<Fn &, const T &>;
-              static_assert(detail::is_validation_result_v<Ret>,
-                            "Schema::check: (const T&) callable must return ValidationResult.");
-              ValidationResult r = fn2(obj);
-              out.merge(r.errors);
-            }
-            else
-            {
-              static_assert(detail::dependent_false_v<Fn>,
-                            "Schema::check: expected (const T&, ValidationErrors&)->void or (const T&)->ValidationResult.");
-            }
-          });
+      if constexpr (std::is_invocable_v<Fn &, const T &, ValidationErrors &>)
+      {
+        using Ret = std::invoke_result_t<Fn &, const T &, ValidationErrors &>;
+        static_assert(detail::is_check_void_v<Ret, T>,
+                      "Schema::check: (const T&, ValidationErrors&) callable must return void.");
+      }
+      else if constexpr (std::is_invocable_v<Fn &, const T &>)
+      {
+        using Ret = std::invoke_result_t<Fn &, const T &>;
+        static_assert(detail::is_validation_result_v<Ret>,
+                      "Schema::check: (const T&) callable must return ValidationResult.");
+      }
+      else
+      {
+        static_assert(detail::dependent_false_v<Fn>,
+                      "Schema::check: expected (const T&, ValidationErrors&)->void or (const T&)->ValidationResult.");
+      }
 
-      return *this;
+      return add_check<detail::ObjectCheck<T, Fn>>(Fn(std::forward<F>(fn)));
     }
 
     /**
      * @brief Execute all checks and return accumulated errors.
      *
      * This function never throws. It returns a `ValidationResult` which
-     * contains all errors produced by the schema.
+     * contains the errors produced by the schema under `policy`:
+     * - AllErrors (default): every check and every rule runs
+     * - FirstErrorPerField:  at most one error per field
+     * - FailFast:            stops at the first error
      */
-    [[nodiscard]] ValidationResult validate(const T &obj) const
+    [[nodiscard]] ValidationResult validate(
+        const T &obj,
+        ValidationPolicy policy = ValidationPolicy::AllErrors) const
     {
       ValidationErrors out;
+      validate_into(obj, out, policy);
+      return ValidationResult{std::move(out)};
+    }
+
+    /**
+     * @brief Execute all checks and append errors into an existing container.
+     *
+     * Under FailFast, the run stops as soon as `out` receives a new error.
+     */
+    void validate_into(
+        const T &obj,
+        ValidationErrors &out,
+        ValidationPolicy policy = ValidationPolicy::AllErrors) const
+    {
+      const std::size_t before = out.size();
+      const detail::RecordScope record(before);
 
       for (const auto &check : checks_)
       {
-        if (check)
+        if (detail::field_already_failed(*check, out, policy))
         {
-          check(obj, out);
+          continue;
+        }
+
+        check->run(obj, out, policy);
+
+        if ((policy == ValidationPolicy::FailFast && out.size() != before) || out.full())
+        {
+          return;
         }
       }
+    }
 
-      return ValidationResult{std::move(out)};
+    /**
+     * @brief Execute all checks, and store checked values into `clean`.
+     *
+     * Entries registered with an output member (`field(..., spec, &Clean::m)`,
+     * `parsed(..., spec, &Clean::m)`) write their value into `clean` when it
+     * passes, reusing the value parsed during validation. Other entries only
+     * validate. Errors and policy behave exactly as in validate_into(obj, out).
+     *
+     * @throws std::invalid_argument if an entry's output member belongs to
+     *         another class than Clean.
+     */
+    template <typename Clean>
+      requires(!std::is_same_v<Clean, ValidationPolicy>)
+    void validate_into(
+        const T &obj,
+        ValidationErrors &out,
+        Clean &clean,
+        ValidationPolicy policy = ValidationPolicy::AllErrors) const
+    {
+      const detail::CleanTarget target(clean);
+      const std::size_t before = out.size();
+      const detail::RecordScope record(before);
+
+      for (const auto &check : checks_)
+      {
+        if (detail::field_already_failed(*check, out, policy))
+        {
+          continue;
+        }
+
+        check->run_into(obj, out, policy, target);
+
+        if ((policy == ValidationPolicy::FailFast && out.size() != before) || out.full())
+        {
+          return;
+        }
+      }
+    }
+
+    /**
+     * @brief Execute all checks and stream errors into any ErrorSink.
+     *
+     * No intermediate error vector is built for rules and FieldSpec /
+     * StaticFieldSpec / ParsedSpec entries; errors go straight to `sink`.
+     * The run stops early when the sink reports `full()`.
+     */
+    template <ErrorSink S>
+      requires(!std::is_same_v<S, ValidationErrors>)
+    void validate_into(
+        const T &obj,
+        S &sink,
+        ValidationPolicy policy = ValidationPolicy::AllErrors) const
+    {
+      if (policy == ValidationPolicy::AllErrors)
+      {
+        ValidationErrors stream{ErrorSinkRef(sink)};
+        validate_into(obj, stream, policy);
+        return;
+      }
+
+      detail::PolicySink<S> filtered(sink, policy);
+      ValidationErrors stream{ErrorSinkRef(filtered)};
+      validate_into(obj, stream, policy);
+    }
+
+    /**
+     * @brief Pass/fail validation that never builds a ValidationError.
+     *
+     * Stops at the first failing check. For schemas made of FieldSpec,
+     * ParsedSpec and StaticFieldSpec entries with built-in rules, this
+     * performs no heap allocation, whether the object is valid or not.
+     *
+     * Callables that return ValidationResult, and `check()` callables, can
+     * only answer by producing errors; they are still evaluated correctly
+     * but may allocate when they fail.
+     */
+    [[nodiscard]] bool is_valid(const T &obj) const
+    {
+      for (const auto &check : checks_)
+      {
+        if (!check->test(obj))
+        {
+          return false;
+        }
+      }
+      return true;
     }
 
   private:
-    std::vector<CheckFn> checks_;
+    friend struct detail::SchemaBlocks;
+    friend struct detail::SchemaJson;
+
+    template <typename Check, typename... Args>
+    Schema &add_check(Args &&...args)
+    {
+      checks_.push_back(std::make_shared<const Check>(std::forward<Args>(args)...));
+      json_ = std::make_shared<detail::JsonIndex>();
+      return *this;
+    }
+
+    std::vector<std::shared_ptr<const detail::SchemaCheck<T>>> checks_;
+    std::shared_ptr<detail::JsonIndex> json_;
   };
 
   /**
@@ -0,0 +1,170 @@
+/**
+ *
+ *  @file SchemaBatch.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_SCHEMA_BATCH_HPP
+#define VIX_VALIDATION_SCHEMA_BATCH_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <vix/validation/Batch.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/ValidationErrors.hpp>
+#include <vix/validation/ValidationPolicy.hpp>
+
+/**
+ * Parallel validation of record spans.
+ *
+ * Opt-in: this header starts std::thread workers, so a target including it
+ * must link a thread library (CMake: `Threads::Threads`). Schema.hpp alone
+ * does not need one.
+ */
+
+namespace vix::validation
+{
+
+  namespace detail
+  {
+    /**
+     * @brief Reads the checks of a Schema block by block (friend of Schema).
+     */
+    struct SchemaBlocks
+    {
+      /**
+       * @brief Columnar validation of records [first, last) (see validate_batch).
+       */
+      template <typename T>
+      static void run(
+          const Schema<T> &schema,
+          const T *items,
+          std::size_t first,
+          std::size_t last,
+          BatchChunk &chunk,
+          ValidationPolicy policy)
+      {
+        const auto &checks = schema.checks_;
+        constexpr std::size_t words = block_rows / 64;
+        const std::size_t count = checks.size();
+
+        std::vector<std::uint64_t> failed(count * words);
+        std::vector<unsigned char> blocked(count);
+
+        for (std::size_t block = first; block < last; block += block_rows)
+        {
+          const std::size_t n = std::min(block_rows, last - block);
+          std::fill(failed.begin(), failed.end(), 0);
+
+          // Pass 1: field by field over the whole block.
+          bool per_record = false;
+          std::array<std::uint64_t, words> any{};
+          for (std::size_t c = 0; c < count; ++c)
+          {
+            std::uint64_t *bits = failed.data() + c * words;
+            blocked[c] = checks[c]->test_block(items + block, n, bits) ? 1 : 0;
+            per_record = per_record || !blocked[c];
+            for (std::size_t w = 0; w < words; ++w)
+            {
+              any[w] |= bits[w];
+            }
+          }
+
+          // Pass 2: per record, run only the checks that failed (and the
+          // ones without a block form), in registration order. Records that
+          // passed every block test are skipped outright.
+          for (std::size_t r = 0; r < n; ++r)
+          {
+            if (!per_record && !((any[r / 64] >> (r % 64)) & 1u))
+            {
+              continue;
+            }
+
+            const std::size_t before = chunk.errors.size();
+            const RecordScope record(before);
+
+            for (std::size_t c = 0; c < count; ++c)
+            {
+              if ((blocked[c] && !((failed[c * words + r / 64] >> (r % 64)) & 1u)) ||
+                  field_already_failed(*checks[c], chunk.errors, policy))
+              {
+                continue;
+              }
+
+              checks[c]->run(items[block + r], chunk.errors, policy);
+
+              if (policy == ValidationPolicy::FailFast && chunk.errors.size() != before)
+              {
+                break;
+              }
+            }
+
+            chunk.close_record(block + r, before);
+          }
+        }
+      }
+    };
+  } // namespace detail
+
+  /**
+   * @brief Validate a span of records in parallel.
+   *
+   * Records are split into chunks of `options.grain` and spread over
+   * `options.threads` workers (the calling thread included); idle workers
+   * steal chunks from busy ones. The result is identical to validating
+   * each record in order with Schema::validate_into(): same failing
+   * indices, same errors, same order, whatever the thread count.
+   *
+   * With `options.columnar` (the default), each chunk is processed in
+   * blocks of detail::block_rows records, field by field: every field
+   * check is first evaluated over the whole block (arithmetic members are
+   * gathered into a contiguous buffer, so range rules run as SIMD
+   * kernels), then errors are built only for the records and checks that
+   * failed. Cross-field `check()` entries run last, per record.
+   *
+   * The schema and the records must not be modified during the call.
+   *
+   * Example:
+   *   auto r = validate_batch(User::schema(), users, {.threads = 8});
+   */
+  template <typename T>
+  [[nodiscard]] BatchResult validate_batch(
+      const Schema<T> &schema,
+      std::span<const std::type_identity_t<T>> items,
+      BatchOptions options = {})
+  {
+    const ValidationPolicy policy = options.policy;
+
+    if (!options.columnar)
+    {
+      return run_batch(
+          items.size(),
+          options,
+          [&schema, items, policy](std::size_t i, ValidationErrors &out)
+          { schema.validate_into(items[i], out, policy); });
+    }
+
+    return run_batch_ranges(
+        items.size(),
+        options,
+        [&schema, items, policy](std::size_t first, std::size_t last, detail::BatchChunk &chunk)
+        { detail::SchemaBlocks::run(schema, items.data(), first, last, chunk, policy); });
+  }
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_SCHEMA_BATCH_HPP
@@ -0,0 +1,284 @@
+/**
+ *
+ *  @file SchemaJson.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_SCHEMA_JSON_HPP
+#define VIX_VALIDATION_SCHEMA_JSON_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/Json.hpp>
+#include <vix/validation/Rules.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/StringSet.hpp>
+#include <vix/validation/ValidationErrors.hpp>
+#include <vix/validation/ValidationPolicy.hpp>
+#include <vix/validation/ValidationResult.hpp>
+
+/**
+ * Binding of JSON request bodies through a Schema. Opt-in: Schema.hpp
+ * only knows how to store one JSON value into a member (MemberCheck);
+ * the reader and the name index live here.
+ */
+
+namespace vix::validation
+{
+
+  namespace detail
+  {
+    /**
+     * @brief Reads the checks and the name index of a Schema (friend of Schema).
+     */
+    struct SchemaJson
+    {
+      /// @brief See vix::validation::validate_json_into.
+      template <typename T>
+      static void validate_into(
+          const Schema<T> &schema,
+          std::string_view body,
+          T &obj,
+          ValidationErrors &out,
+          ValidationPolicy policy)
+      {
+        const auto &checks = schema.checks_;
+        const JsonIndex &index = index_of(schema);
+        const std::size_t before = out.size();
+        const RecordScope record(before);
+        const auto stop = [&]
+        { return (policy == ValidationPolicy::FailFast && out.size() != before) || out.full(); };
+
+        // One bit per field name; on the stack for up to 256 names.
+        const std::size_t words = (index.groups.size() + 63) / 64;
+        std::array<std::uint64_t, 4> small{};
+        std::vector<std::uint64_t> large(words > small.size() ? words : 0);
+        std::uint64_t *seen = large.empty() ? small.data() : large.data();
+        const auto was_seen = [seen](std::size_t group)
+        { return ((seen[group / 64] >> (group % 64)) & 1u) != 0; };
+
+        JsonReader in(body);
+        std::string_view key;
+        JsonValue value;
+
+        if (in.begin_object())
+        {
+          while (in.next_key(key))
+          {
+            const std::size_t group = index.names.find(key);
+            if (group == StringSet::npos)
+            {
+              if (!in.skip_value())
+              {
+                break;
+              }
+              continue;
+            }
+            if (was_seen(group))
+            {
+              in.fail_at("duplicate_key", in.key_offset());
+              break;
+            }
+            if (!in.read_value(value))
+            {
+              break;
+            }
+
+            seen[group / 64] |= std::uint64_t{1} << (group % 64);
+            run_group(schema, index.groups[group], obj, value, in.value_offset(), out, policy);
+            if (stop())
+            {
+              return;
+            }
+          }
+          (void)in.finish();
+        }
+
+        if (in.failed())
+        {
+          rules::detail::add_format_error("__json__", in.error(), in.error_offset(),
+                                          ErrorText::literal("invalid JSON"), out);
+          return;
+        }
+
+        for (std::size_t c = 0; c < checks.size(); ++c)
+        {
+          const std::size_t group = index.group_of[c];
+          if ((group != StringSet::npos && was_seen(group)) ||
+              field_already_failed(*checks[c], out, policy))
+          {
+            continue;
+          }
+
+          checks[c]->run(obj, out, policy);
+          if (stop())
+          {
+            return;
+          }
+        }
+      }
+
+    private:
+      /**
+       * @brief Store one JSON value through each check of its group, and run
+       * the checks. A type mismatch is reported once and ends the group.
+       */
+      template <typename T>
+      static void run_group(
+          const Schema<T> &schema,
+          const std::vector<std::size_t> &group,
+          T &obj,
+          const JsonValue &value,
+          std::size_t offset,
+          ValidationErrors &out,
+          ValidationPolicy policy)
+      {
+        const std::size_t before = out.size();
+
+        for (const std::size_t c : group)
+        {
+          const SchemaCheck<T> &check = *schema.checks_[c];
+          if (const char *reason = check.json_assign(obj, value))
+          {
+            const FieldNameScope scope(*check.field_name());
+            rules::detail::add_format_error(check.field_name()->view(), reason, offset,
+                                            ErrorText::literal("invalid value type"), out);
+            return;
+          }
+
+          if (field_already_failed(check, out, policy))
+          {
+            continue;
+          }
+
+          check.run(obj, out, policy);
+          if (policy == ValidationPolicy::FailFast && out.size() != before)
+          {
+            return;
+          }
+        }
+      }
+
+      /**
+       * @brief Name index of the checks, built once per set of checks and
+       * shared by copies of the schema.
+       */
+      template <typename T>
+      [[nodiscard]] static const JsonIndex &index_of(const Schema<T> &schema)
+      {
+        static const JsonIndex empty{};
+        if (!schema.json_)
+        {
+          return empty;
+        }
+
+        JsonIndex &index = *schema.json_;
+        std::call_once(index.once, [&schema, &index]
+                       { build_index(schema, index); });
+        return index;
+      }
+
+      template <typename T>
+      static void build_index(const Schema<T> &schema, JsonIndex &index)
+      {
+        const auto &checks = schema.checks_;
+        std::vector<std::string_view> names;
+        for (const auto &check : checks)
+        {
+          const ErrorText *name = check->field_name();
+          if (name && std::find(names.begin(), names.end(), name->view()) == names.end())
+          {
+            names.push_back(name->view());
+          }
+        }
+
+        index.names = StringSet(names);
+        index.groups.resize(index.names.size());
+        index.group_of.reserve(checks.size());
+        for (std::size_t c = 0; c < checks.size(); ++c)
+        {
+          const ErrorText *name = checks[c]->field_name();
+          const std::size_t group = name ? index.names.find(name->view()) : StringSet::npos;
+          index.group_of.push_back(group);
+          if (group != StringSet::npos)
+          {
+            index.groups[group].push_back(c);
+          }
+        }
+      }
+    };
+  } // namespace detail
+
+  /**
+   * @brief Bind a JSON object into `obj`, validating each member as soon
+   * as it has been read.
+   *
+   * No document is built: the body is read with a JsonReader, object
+   * members are matched to registered fields by name, and each value is
+   * stored into its member (see detail::json_assign) before the checks
+   * registered under that name run. Members without a field are skipped.
+   * Fields absent from the body, then `check()` entries, run after the
+   * closing brace, in registration order; errors thus follow the order
+   * of the body rather than the order of registration.
+   *
+   * Under FailFast, reading stops at the first error: a large body is
+   * rejected right after its first invalid member. Reading also stops
+   * when `out` is full.
+   *
+   * Malformed JSON is a Format error on field "__json__" and ends the
+   * run; a duplicate member is reported the same way (reason
+   * "duplicate_key"). A value of the wrong type for its member is a
+   * Format error on the field (reason "type", "out_of_range" or
+   * "escaped_view"), and that field's checks are skipped. Meta "offset"
+   * is a byte offset into `body`.
+   *
+   * std::string_view members view `body`, which must outlive them.
+   */
+  template <typename T>
+  inline void validate_json_into(
+      const Schema<T> &schema,
+      std::string_view body,
+      T &obj,
+      ValidationErrors &out,
+      ValidationPolicy policy = ValidationPolicy::AllErrors)
+  {
+    detail::SchemaJson::validate_into(schema, body, obj, out, policy);
+  }
+
+  /**
+   * @brief Bind a JSON object into `obj` and validate it
+   * (see validate_json_into).
+   *
+   * Example:
+   *   auto r = validate_json(User::schema(), body, user);
+   */
+  template <typename T>
+  [[nodiscard]] inline ValidationResult validate_json(
+      const Schema<T> &schema,
+      std::string_view body,
+      T &obj,
+      ValidationPolicy policy = ValidationPolicy::AllErrors)
+  {
+    ValidationErrors out;
+    validate_json_into(schema, body, obj, out, policy);
+    return ValidationResult{std::move(out)};
+  }
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_SCHEMA_JSON_HPP
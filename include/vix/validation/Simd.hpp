@@ -0,0 +1,80 @@
+/**
+ *
+ *  @file Simd.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_SIMD_HPP
+#define VIX_VALIDATION_SIMD_HPP
+
+#include <cstdint>
+
+/**
+ * x86 SIMD kernels are compiled per function with a target attribute, so the
+ * library needs no global -mavx2 flag; the running CPU picks the path.
+ * Define VIX_VALIDATION_NO_SIMD to force the scalar kernels everywhere.
+ */
+#if !defined(VIX_VALIDATION_NO_SIMD) && \
+    (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && defined(__SSE2__)
+#define VIX_VALIDATION_X86_SIMD 1
+#define VIX_VALIDATION_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#else
+#define VIX_VALIDATION_X86_SIMD 0
+#endif
+
+namespace vix::validation
+{
+
+  /**
+   * @brief Instruction set used by the vectorized kernels.
+   *
+   * Levels are ordered: a CPU supporting a level supports all lower ones.
+   */
+  enum class SimdLevel : std::uint8_t
+  {
+    Scalar = 0,
+    SSE2,
+    AVX2
+  };
+
+  /**
+   * @brief Best level supported by the running CPU (detected once).
+   */
+  [[nodiscard]] inline SimdLevel detected_simd_level() noexcept
+  {
+#if VIX_VALIDATION_X86_SIMD
+    static const SimdLevel level = []
+    {
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : SimdLevel::SSE2;
+    }();
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+  }
+
+  /**
+   * @brief Clamp a requested level to what the CPU supports.
+   *
+   * Kernels accept an explicit level so tests can compare every path on the
+   * same input; asking for more than the CPU has falls back safely.
+   */
+  [[nodiscard]] inline SimdLevel usable_simd_level(SimdLevel requested) noexcept
+  {
+    const SimdLevel best = detected_simd_level();
+    return requested < best ? requested : best;
+  }
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_SIMD_HPP
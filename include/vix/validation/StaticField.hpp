@@ -0,0 +1,149 @@
+/**
+ *
+ *  @file StaticField.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_STATIC_FIELD_HPP
+#define VIX_VALIDATION_STATIC_FIELD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <vix/validation/Rules.hpp>
+#include <vix/validation/ValidationErrors.hpp>
+#include <vix/validation/ValidationPolicy.hpp>
+
+namespace vix::validation
+{
+
+  /**
+   * @class StaticFieldSpec
+   * @brief Compile-time rule pipeline for a typed field.
+   *
+   * Unlike FieldSpec, which stores type-erased `Rule<FieldT>` values,
+   * StaticFieldSpec keeps its rules by value in a `std::tuple`. Every rule
+   * call is a direct call on a known type, so the compiler can inline the
+   * whole pipeline into the schema check.
+   *
+   * Any callable with the Rule signature can be used, including the
+   * built-in rule objects returned by `rules::min`, `rules::email`, ...
+   *
+   * @code
+   * .field("age", &User::age,
+   *        vix::validation::static_field<int>(
+   *          vix::validation::rules::min(18),
+   *          vix::validation::rules::max(120)))
+   * @endcode
+   *
+   * @tparam FieldT The field type.
+   * @tparam Rules  Rule object types, stored by value.
+   */
+  template <typename FieldT, typename... Rules>
+  class StaticFieldSpec
+  {
+    static_assert((std::is_invocable_v<const Rules &, std::string_view, const FieldT &, ValidationErrors &> && ...),
+                  "StaticFieldSpec: every rule must be callable as "
+                  "(std::string_view, const FieldT&, ValidationErrors&).");
+
+  public:
+    using field_type = FieldT;
+
+    explicit StaticFieldSpec(Rules... rules)
+        : rules_(std::move(rules)...)
+    {
+    }
+
+    /**
+     * @brief Run the rules in declaration order, appending errors into `out`.
+     *
+     * With a policy other than AllErrors, the pipeline stops at the first
+     * rule that reports an error.
+     */
+    void apply_into(
+        std::string_view field,
+        const FieldT &value,
+        ValidationErrors &out,
+        ValidationPolicy policy = ValidationPolicy::AllErrors) const
+    {
+      const std::size_t before = out.size();
+
+      std::apply(
+          [&](const auto &...rule)
+          {
+            // && short-circuits the fold once the policy is met.
+            (void)((rule(field, value, out),
+                    !detail::policy_stops_field(policy, out.size() - before) && !out.full()) &&
+                   ...);
+          },
+          rules_);
+    }
+
+    /**
+     * @brief Evaluate the rules as a predicate, without building errors.
+     *
+     * Stops at the first failing rule.
+     */
+    [[nodiscard]] bool test(const FieldT &value) const
+    {
+      return std::apply(
+          [&](const auto &...rule)
+          {
+            return (detail::test_rule(rule, value) && ...);
+          },
+          rules_);
+    }
+
+    /**
+     * @brief Block form of test(): set bit i of `failed` when values[i]
+     * fails any rule.
+     */
+    void fail_block(const FieldT *values, std::size_t n, std::uint64_t *failed) const
+    {
+      std::apply(
+          [&](const auto &...rule)
+          {
+            (detail::fail_block_rule(rule, values, n, failed), ...);
+          },
+          rules_);
+    }
+
+    /**
+     * @brief Access the stored rules (read-only).
+     */
+    [[nodiscard]] const std::tuple<Rules...> &rules() const noexcept
+    {
+      return rules_;
+    }
+
+  private:
+    std::tuple<Rules...> rules_;
+  };
+
+  /**
+   * @brief Helper to create a StaticFieldSpec<FieldT, Rules...>.
+   *
+   * @tparam FieldT Field type (must be given explicitly).
+   */
+  template <typename FieldT, typename... Rules>
+  [[nodiscard]] inline StaticFieldSpec<FieldT, std::decay_t<Rules>...>
+  static_field(Rules &&...rules)
+  {
+    return StaticFieldSpec<FieldT, std::decay_t<Rules>...>(std::forward<Rules>(rules)...);
+  }
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_STATIC_FIELD_HPP
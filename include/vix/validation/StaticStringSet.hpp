@@ -0,0 +1,384 @@
+/**
+ *
+ *  @file StaticStringSet.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_STATIC_STRING_SET_HPP
+#define VIX_VALIDATION_STATIC_STRING_SET_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace vix::validation
+{
+
+  /**
+   * @brief String literal usable as a template argument: `Set<"a", "b">`.
+   */
+  template <std::size_t N>
+  struct FixedString
+  {
+    char value[N]{};
+
+    constexpr FixedString(const char (&s)[N]) noexcept
+    {
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        value[i] = s[i];
+      }
+    }
+
+    [[nodiscard]] constexpr std::string_view view() const noexcept
+    {
+      return std::string_view(value, N - 1);
+    }
+  };
+
+  namespace detail
+  {
+    [[nodiscard]] constexpr std::uint64_t static_set_mix(std::uint64_t x) noexcept
+    {
+      x ^= x >> 32;
+      x *= 0xd6e8feb86659fd93ULL;
+      x ^= x >> 32;
+      return x;
+    }
+
+    /// @brief Little-endian load of `Width` bytes, usable in constant expressions.
+    template <std::size_t Width>
+    [[nodiscard]] constexpr std::uint64_t static_set_load(const char *p) noexcept
+    {
+      if (std::is_constant_evaluated())
+      {
+        std::uint64_t w = 0;
+        for (std::size_t i = 0; i < Width; ++i)
+        {
+          w |= std::uint64_t{static_cast<unsigned char>(p[i])} << (8 * i);
+        }
+        return w;
+      }
+
+      std::conditional_t<Width == 8, std::uint64_t, std::uint32_t> w;
+      std::memcpy(&w, p, Width);
+      return w;
+    }
+
+    /**
+     * @brief Two words that, together with the length, determine any
+     * string of up to 16 bytes: overlapping loads from both ends.
+     */
+    struct StaticSetEnds
+    {
+      std::uint64_t head{0};
+      std::uint64_t tail{0};
+    };
+
+    [[nodiscard]] constexpr StaticSetEnds static_set_ends(std::string_view s) noexcept
+    {
+      const char *p = s.data();
+      const std::size_t n = s.size();
+      if (n >= 8)
+      {
+        return {static_set_load<8>(p), static_set_load<8>(p + n - 8)};
+      }
+      if (n >= 4)
+      {
+        return {static_set_load<4>(p) | (static_set_load<4>(p + n - 4) << 32), 0};
+      }
+      if (n > 0)
+      {
+        return {std::uint64_t{static_cast<unsigned char>(p[0])} |
+                    (std::uint64_t{static_cast<unsigned char>(p[n / 2])} << 8) |
+                    (std::uint64_t{static_cast<unsigned char>(p[n - 1])} << 16),
+                0};
+      }
+      return {};
+    }
+
+    /**
+     * @brief Hash of the length and the end words: at most two loads,
+     * whatever the length. Used when it tells every key apart.
+     */
+    [[nodiscard]] constexpr std::uint64_t static_set_hash_ends(std::size_t size, StaticSetEnds e) noexcept
+    {
+      return static_set_mix((e.head * 0x9e3779b97f4a7c15ULL) ^ std::rotl(e.tail, 31) ^ size);
+    }
+
+    /// @brief FNV-1a over every byte, for keys the cheap hash cannot split.
+    [[nodiscard]] constexpr std::uint64_t static_set_hash_full(std::string_view s) noexcept
+    {
+      std::uint64_t h = 0xcbf29ce484222325ULL;
+      for (char c : s)
+      {
+        h ^= static_cast<unsigned char>(c);
+        h *= 0x100000001b3ULL;
+      }
+      return static_set_mix(h);
+    }
+  } // namespace detail
+
+  /**
+   * @class StaticStringSet
+   * @brief Set of string literals fixed at compile time.
+   *
+   * Up to four keys are compared directly. Larger sets get a
+   * hash-and-displace perfect hash computed by the compiler: a lookup is
+   * one hash, one displacement, one slot and one key comparison. The hash
+   * reads only the length and the first and last 8 bytes when that tells
+   * the keys apart, and every byte otherwise. The tables are constexpr
+   * data, so there is no heap use and nothing to build at startup.
+   * Duplicate keys are a compile error.
+   */
+  template <FixedString... Keys>
+  class StaticStringSet
+  {
+    static_assert(sizeof...(Keys) > 0, "StaticStringSet needs at least one value");
+
+  public:
+    [[nodiscard]] static constexpr std::size_t size() noexcept
+    {
+      return count;
+    }
+
+    [[nodiscard]] static constexpr bool contains(std::string_view value) noexcept
+    {
+      if (value.size() < min_size || value.size() > max_size)
+      {
+        return false;
+      }
+
+      if constexpr (count <= direct_max)
+      {
+        return ((value == Keys.view()) || ...);
+      }
+      else
+      {
+        const detail::StaticSetEnds e = detail::static_set_ends(value);
+        const std::uint64_t h = ends_distinct ? detail::static_set_hash_ends(value.size(), e)
+                                              : detail::static_set_hash_full(value);
+        const std::size_t index = table.slots[slot_of(h, table.seeds[bucket_of(h)])];
+        if (index >= count)
+        {
+          return false;
+        }
+
+        // Keys up to 16 bytes are fully covered by their two end words.
+        const Entry &k = entries[index];
+        return k.size == value.size() && k.ends.head == e.head && k.ends.tail == e.tail &&
+               (k.size <= 16 || keys[index].substr(8, k.size - 16) == value.substr(8, k.size - 16));
+      }
+    }
+
+  private:
+    static constexpr std::size_t count = sizeof...(Keys);
+    static constexpr std::size_t direct_max = 4;
+    static constexpr std::size_t slot_count = std::bit_ceil(2 * count);
+    static constexpr std::size_t bucket_count = std::bit_ceil((count + 1) / 2);
+
+    using Index = std::conditional_t<(count < 0xFF), std::uint8_t, std::uint16_t>;
+    static_assert(count < 0xFFFF, "StaticStringSet supports up to 65534 values");
+
+    static constexpr std::array<std::string_view, count> keys{Keys.view()...};
+
+    static constexpr std::size_t min_size = []
+    {
+      std::size_t m = keys[0].size();
+      for (std::string_view k : keys)
+      {
+        m = k.size() < m ? k.size() : m;
+      }
+      return m;
+    }();
+
+    static constexpr std::size_t max_size = []
+    {
+      std::size_t m = 0;
+      for (std::string_view k : keys)
+      {
+        m = k.size() > m ? k.size() : m;
+      }
+      return m;
+    }();
+
+    static constexpr bool unique = []
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        for (std::size_t j = i + 1; j < count; ++j)
+        {
+          if (keys[i] == keys[j])
+          {
+            return false;
+          }
+        }
+      }
+      return true;
+    }();
+    static_assert(unique, "StaticStringSet values must be distinct");
+
+    struct Entry
+    {
+      std::size_t size{0};
+      detail::StaticSetEnds ends{};
+    };
+
+    static constexpr std::array<Entry, count> entries = []
+    {
+      std::array<Entry, count> e{};
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        e[i] = Entry{keys[i].size(), detail::static_set_ends(keys[i])};
+      }
+      return e;
+    }();
+
+    [[nodiscard]] static constexpr std::uint64_t key_hash(std::size_t i, bool ends) noexcept
+    {
+      return ends ? detail::static_set_hash_ends(entries[i].size, entries[i].ends)
+                  : detail::static_set_hash_full(keys[i]);
+    }
+
+    /// @brief Whether the (length, head, tail) hash already tells every key apart.
+    static constexpr bool ends_distinct = []
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        for (std::size_t j = i + 1; j < count; ++j)
+        {
+          if (key_hash(i, true) == key_hash(j, true))
+          {
+            return false;
+          }
+        }
+      }
+      return true;
+    }();
+
+    [[nodiscard]] static constexpr std::size_t slot_of(std::uint64_t h, std::uint32_t seed) noexcept
+    {
+      return static_cast<std::size_t>(detail::static_set_mix(h ^ (seed * 0x9e3779b97f4a7c15ULL))) & (slot_count - 1);
+    }
+
+    [[nodiscard]] static constexpr std::size_t bucket_of(std::uint64_t h) noexcept
+    {
+      return static_cast<std::size_t>(h >> 32) & (bucket_count - 1);
+    }
+
+    struct Table
+    {
+      std::array<std::uint32_t, bucket_count> seeds{};
+      std::array<Index, slot_count> slots{};
+      bool ok{true};
+    };
+
+    /// @brief Place the largest buckets first, each with the first seed
+    /// that sends all its keys to free, distinct slots.
+    static constexpr Table build() noexcept
+    {
+      Table t;
+      for (auto &s : t.slots)
+      {
+        s = static_cast<Index>(count);
+      }
+      if constexpr (count <= direct_max)
+      {
+        return t;
+      }
+
+      std::array<std::uint64_t, count> hashes{};
+      std::array<std::size_t, bucket_count> sizes{};
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        hashes[i] = key_hash(i, ends_distinct);
+        ++sizes[bucket_of(hashes[i])];
+      }
+
+      std::array<std::size_t, bucket_count> order{};
+      for (std::size_t b = 0; b < bucket_count; ++b)
+      {
+        order[b] = b;
+      }
+      for (std::size_t i = 1; i < bucket_count; ++i)
+      {
+        for (std::size_t j = i; j > 0 && sizes[order[j - 1]] < sizes[order[j]]; --j)
+        {
+          const std::size_t tmp = order[j];
+          order[j] = order[j - 1];
+          order[j - 1] = tmp;
+        }
+      }
+
+      for (std::size_t b : order)
+      {
+        if (sizes[b] == 0)
+        {
+          break;
+        }
+
+        bool placed = false;
+        for (std::uint32_t seed = 0; seed < (1u << 16) && !placed; ++seed)
+        {
+          placed = true;
+          for (std::size_t i = 0; i < count && placed; ++i)
+          {
+            if (bucket_of(hashes[i]) != b)
+            {
+              continue;
+            }
+            const std::size_t s = slot_of(hashes[i], seed);
+            if (t.slots[s] != count)
+            {
+              placed = false;
+            }
+            else
+            {
+              t.slots[s] = static_cast<Index>(i);
+            }
+          }
+
+          if (!placed)
+          {
+            for (auto &s : t.slots)
+            {
+              if (s != count && bucket_of(hashes[s]) == b)
+              {
+                s = static_cast<Index>(count);
+              }
+            }
+          }
+          else
+          {
+            t.seeds[b] = seed;
+          }
+        }
+
+        if (!placed)
+        {
+          t.ok = false;
+          return t;
+        }
+      }
+      return t;
+    }
+
+    static constexpr Table table = build();
+    static_assert(table.ok, "StaticStringSet: no perfect hash found for these values");
+  };
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_STATIC_STRING_SET_HPP
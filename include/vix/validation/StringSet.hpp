@@ -0,0 +1,453 @@
+/**
+ *
+ *  @file StringSet.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_STRING_SET_HPP
+#define VIX_VALIDATION_STRING_SET_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vix::validation
+{
+
+  /**
+   * @class StringSet
+   * @brief Immutable set of strings, looked up by std::string_view.
+   *
+   * The layout is picked from the number of keys when the set is built:
+   *
+   * - Linear (up to linear_max keys): every key is compared at once on
+   *   (length, first 8 bytes) without branches; only a hit reads the rest.
+   * - Sorted (up to sorted_max keys): a flat array ordered by
+   *   (length, first 8 bytes, rest), searched by bisection.
+   * - PerfectHash (larger sets): a hash-and-displace table built once, so
+   *   a lookup is one hash, one slot and one key comparison.
+   *
+   * All keys live in one contiguous buffer. Values shorter than the
+   * shortest key or longer than the longest are rejected before any key
+   * is touched, so a huge input costs nothing to reject.
+   */
+  class StringSet
+  {
+  public:
+    enum class Layout : std::uint8_t
+    {
+      Linear,
+      Sorted,
+      PerfectHash
+    };
+
+    static constexpr std::size_t linear_max = 8;
+    static constexpr std::size_t sorted_max = 48;
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    StringSet() = default;
+
+    StringSet(std::initializer_list<std::string_view> keys)
+    {
+      build(keys);
+    }
+
+    /**
+     * @brief Build from any range of string-like keys; duplicates are dropped.
+     */
+    template <typename Range>
+      requires requires(const Range &r) { std::string_view(*std::begin(r)); }
+    explicit StringSet(const Range &keys)
+    {
+      build(keys);
+    }
+
+    [[nodiscard]] bool contains(std::string_view value) const noexcept
+    {
+      return find(value) != npos;
+    }
+
+    /**
+     * @brief Index of `value` in layout order (see key()), or npos.
+     */
+    [[nodiscard]] std::size_t find(std::string_view value) const noexcept
+    {
+      if (value.size() < min_size_ || value.size() > max_size_)
+      {
+        return npos;
+      }
+
+      switch (layout_)
+      {
+      case Layout::Linear:
+        return find_linear(value);
+      case Layout::Sorted:
+        return find_sorted(value);
+      case Layout::PerfectHash:
+        return find_hashed(value);
+      }
+      return npos;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return keys_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return keys_.empty(); }
+    [[nodiscard]] Layout layout() const noexcept { return layout_; }
+
+    /// @brief Key `i`, in layout order.
+    [[nodiscard]] std::string_view key(std::size_t i) const noexcept
+    {
+      return text(keys_[i]);
+    }
+
+  private:
+    struct Key
+    {
+      std::uint64_t head{0};
+      std::uint32_t offset{0};
+      std::uint32_t size{0};
+    };
+
+    static constexpr std::uint32_t empty_slot = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief The `n` (< 8) bytes at `p`, zero-padded, little-endian.
+     *
+     * Built from fixed-size loads that overlap, instead of a memcpy of
+     * variable size (a library call).
+     */
+    [[nodiscard]] static std::uint64_t load_partial(const char *p, std::size_t n) noexcept
+    {
+      if (n >= 4)
+      {
+        std::uint32_t lo;
+        std::uint32_t hi;
+        std::memcpy(&lo, p, 4);
+        std::memcpy(&hi, p + n - 4, 4);
+        return lo | (std::uint64_t{hi} << (8 * (n - 4)));
+      }
+      if (n > 0)
+      {
+        const auto b = [p](std::size_t i)
+        { return std::uint64_t{static_cast<unsigned char>(p[i])} << (8 * i); };
+        return b(0) | b(n / 2) | b(n - 1);
+      }
+      return 0;
+    }
+
+    /// @brief First (up to) 8 bytes, zero-padded.
+    [[nodiscard]] static std::uint64_t head_of(std::string_view s) noexcept
+    {
+      if (s.size() >= 8)
+      {
+        std::uint64_t h;
+        std::memcpy(&h, s.data(), 8);
+        return h;
+      }
+      return load_partial(s.data(), s.size());
+    }
+
+    [[nodiscard]] static std::uint64_t mix(std::uint64_t x) noexcept
+    {
+      x ^= x >> 32;
+      x *= 0xd6e8feb86659fd93ULL;
+      x ^= x >> 32;
+      x *= 0xd6e8feb86659fd93ULL;
+      x ^= x >> 32;
+      return x;
+    }
+
+    [[nodiscard]] static std::uint64_t hash_of(std::string_view s) noexcept
+    {
+      std::uint64_t h = 0x9e3779b97f4a7c15ULL ^ s.size();
+      std::size_t i = 0;
+      for (; i + 8 <= s.size(); i += 8)
+      {
+        std::uint64_t w;
+        std::memcpy(&w, s.data() + i, 8);
+        h = std::rotl(h ^ w, 29) * 0xbf58476d1ce4e5b9ULL;
+      }
+      if (i < s.size())
+      {
+        h = std::rotl(h ^ load_partial(s.data() + i, s.size() - i), 29) * 0xbf58476d1ce4e5b9ULL;
+      }
+      return mix(h);
+    }
+
+    [[nodiscard]] std::string_view text(const Key &k) const noexcept
+    {
+      return std::string_view(pool_.data() + k.offset, k.size);
+    }
+
+    /// @brief Bytes past the head; only called once length and head match.
+    [[nodiscard]] bool tail_equal(const Key &k, std::string_view value) const noexcept
+    {
+      return k.size <= 8 ||
+             std::memcmp(pool_.data() + k.offset + 8, value.data() + 8, k.size - 8) == 0;
+    }
+
+    /// @brief Three-way order on (length, head, tail).
+    [[nodiscard]] int compare(const Key &k, std::string_view value, std::uint64_t head) const noexcept
+    {
+      if (k.size != value.size())
+      {
+        return k.size < value.size() ? -1 : 1;
+      }
+      if (k.head != head)
+      {
+        return k.head < head ? -1 : 1;
+      }
+      return k.size <= 8 ? 0 : std::memcmp(pool_.data() + k.offset + 8, value.data() + 8, k.size - 8);
+    }
+
+    [[nodiscard]] std::size_t find_linear(std::string_view value) const noexcept
+    {
+      const std::uint64_t head = head_of(value);
+      const std::uint64_t size = value.size();
+
+      unsigned hits = 0;
+      for (std::size_t i = 0; i < keys_.size(); ++i)
+      {
+        hits |= static_cast<unsigned>((keys_[i].size == size) & (keys_[i].head == head)) << i;
+      }
+
+      for (; hits != 0; hits &= hits - 1)
+      {
+        const auto i = static_cast<std::size_t>(std::countr_zero(hits));
+        if (tail_equal(keys_[i], value))
+        {
+          return i;
+        }
+      }
+      return npos;
+    }
+
+    [[nodiscard]] std::size_t find_sorted(std::string_view value) const noexcept
+    {
+      const std::uint64_t head = head_of(value);
+      std::size_t lo = 0;
+      std::size_t hi = keys_.size();
+      while (lo < hi)
+      {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        const int c = compare(keys_[mid], value, head);
+        if (c == 0)
+        {
+          return mid;
+        }
+        if (c < 0)
+        {
+          lo = mid + 1;
+        }
+        else
+        {
+          hi = mid;
+        }
+      }
+      return npos;
+    }
+
+    [[nodiscard]] std::size_t slot_of(std::uint64_t h, std::uint32_t seed) const noexcept
+    {
+      return static_cast<std::size_t>(mix(h ^ (seed * 0x9e3779b97f4a7c15ULL))) & (slots_.size() - 1);
+    }
+
+    [[nodiscard]] std::size_t bucket_of(std::uint64_t h) const noexcept
+    {
+      return static_cast<std::size_t>(h >> 32) & (seeds_.size() - 1);
+    }
+
+    [[nodiscard]] std::size_t find_hashed(std::string_view value) const noexcept
+    {
+      const std::uint64_t h = hash_of(value);
+      const std::uint32_t index = slots_[slot_of(h, seeds_[bucket_of(h)])];
+      if (index == empty_slot)
+      {
+        return npos;
+      }
+
+      const Key &k = keys_[index];
+      return k.size == value.size() && k.head == head_of(value) && tail_equal(k, value) ? index : npos;
+    }
+
+    template <typename Range>
+    void build(const Range &range)
+    {
+      std::vector<std::string_view> input;
+      for (const auto &k : range)
+      {
+        input.emplace_back(k);
+      }
+      std::sort(input.begin(), input.end());
+      input.erase(std::unique(input.begin(), input.end()), input.end());
+
+      std::size_t bytes = 0;
+      for (std::string_view s : input)
+      {
+        bytes += s.size();
+      }
+      pool_.reserve(bytes);
+      keys_.reserve(input.size());
+      for (std::string_view s : input)
+      {
+        keys_.push_back(Key{head_of(s), static_cast<std::uint32_t>(pool_.size()),
+                            static_cast<std::uint32_t>(s.size())});
+        pool_.append(s);
+      }
+
+      if (keys_.empty())
+      {
+        min_size_ = 1;
+        max_size_ = 0;
+        return;
+      }
+
+      min_size_ = max_size_ = keys_.front().size;
+      for (const Key &k : keys_)
+      {
+        min_size_ = std::min<std::size_t>(min_size_, k.size);
+        max_size_ = std::max<std::size_t>(max_size_, k.size);
+      }
+
+      if (keys_.size() <= linear_max)
+      {
+        layout_ = Layout::Linear;
+        return;
+      }
+
+      std::sort(keys_.begin(), keys_.end(), [this](const Key &a, const Key &b)
+                { return compare(a, text(b), b.head) < 0; });
+
+      layout_ = Layout::Sorted;
+      if (keys_.size() > sorted_max)
+      {
+        build_perfect_hash();
+      }
+    }
+
+    /**
+     * @brief Hash and displace: place the largest buckets first, each with
+     * the first seed that sends all its keys to free, distinct slots.
+     *
+     * Falls back to the sorted layout if no table is found (only possible
+     * when two keys share a 64-bit hash).
+     */
+    void build_perfect_hash()
+    {
+      std::vector<std::uint64_t> hashes(keys_.size());
+      for (std::size_t i = 0; i < keys_.size(); ++i)
+      {
+        hashes[i] = hash_of(text(keys_[i]));
+      }
+
+      std::size_t slot_count = std::bit_ceil(keys_.size() + keys_.size() / 4);
+      for (int attempt = 0; attempt < 4; ++attempt, slot_count *= 2)
+      {
+        seeds_.assign(std::bit_ceil(std::max<std::size_t>(keys_.size() / 4, 1)), 0);
+        slots_.assign(slot_count, empty_slot);
+
+        std::vector<std::vector<std::uint32_t>> buckets(seeds_.size());
+        for (std::size_t i = 0; i < keys_.size(); ++i)
+        {
+          buckets[bucket_of(hashes[i])].push_back(static_cast<std::uint32_t>(i));
+        }
+
+        std::vector<std::uint32_t> order(buckets.size());
+        for (std::size_t b = 0; b < order.size(); ++b)
+        {
+          order[b] = static_cast<std::uint32_t>(b);
+        }
+        std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b)
+                         { return buckets[a].size() > buckets[b].size(); });
+
+        if (place_buckets(buckets, order, hashes))
+        {
+          layout_ = Layout::PerfectHash;
+          return;
+        }
+      }
+
+      seeds_.clear();
+      slots_.clear();
+    }
+
+    [[nodiscard]] bool place_buckets(const std::vector<std::vector<std::uint32_t>> &buckets,
+                                     const std::vector<std::uint32_t> &order,
+                                     const std::vector<std::uint64_t> &hashes)
+    {
+      constexpr std::uint32_t max_seed = 1u << 16;
+      std::vector<std::size_t> placed;
+
+      for (std::uint32_t b : order)
+      {
+        const auto &members = buckets[b];
+        if (members.empty())
+        {
+          break;
+        }
+
+        bool done = false;
+        for (std::uint32_t seed = 0; seed < max_seed && !done; ++seed)
+        {
+          placed.clear();
+          done = true;
+          for (std::uint32_t i : members)
+          {
+            const std::size_t s = slot_of(hashes[i], seed);
+            if (slots_[s] != empty_slot)
+            {
+              done = false;
+              break;
+            }
+            slots_[s] = i;
+            placed.push_back(s);
+          }
+
+          if (!done)
+          {
+            for (std::size_t s : placed)
+            {
+              slots_[s] = empty_slot;
+            }
+          }
+          else
+          {
+            seeds_[b] = seed;
+          }
+        }
+
+        if (!done)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    std::string pool_;
+    std::vector<Key> keys_;
+    std::vector<std::uint32_t> seeds_;
+    std::vector<std::uint32_t> slots_;
+    std::size_t min_size_{1};
+    std::size_t max_size_{0};
+    Layout layout_{Layout::Linear};
+  };
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_STRING_SET_HPP
@@ -0,0 +1,712 @@
+/**
+ *
+ *  @file TextKernels.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_TEXT_KERNELS_HPP
+#define VIX_VALIDATION_TEXT_KERNELS_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include <vix/validation/CharSet.hpp>
+#include <vix/validation/Simd.hpp>
+
+/**
+ * @brief Single-pass string kernels used by the built-in string rules.
+ *
+ * Each kernel reads its input once, front to back, and has a scalar and
+ * an SSE2 / AVX2 form selected from a SimdLevel, like Kernels.hpp.
+ */
+namespace vix::validation::kernels
+{
+
+  /**
+   * @brief Structural facts about an email candidate, from one sweep.
+   *
+   * `dot` is the first '.' after the first '@'. When `space` is true the
+   * sweep stopped early and the other members are unspecified.
+   */
+  struct EmailScan
+  {
+    bool space{false};
+    bool multiple_at{false};
+    std::size_t at{std::string_view::npos};
+    std::size_t dot{std::string_view::npos};
+  };
+
+  namespace detail
+  {
+    /// @brief Fold the '@' and '.' positions of one block into `scan`.
+    inline void email_fold(EmailScan &scan, std::size_t base, std::uint32_t at_bits, std::uint32_t dot_bits) noexcept
+    {
+      if (at_bits != 0)
+      {
+        if (scan.at == std::string_view::npos)
+        {
+          scan.at = base + static_cast<std::size_t>(std::countr_zero(at_bits));
+          at_bits &= at_bits - 1;
+        }
+        scan.multiple_at = scan.multiple_at || at_bits != 0;
+      }
+
+      if (scan.at != std::string_view::npos && scan.dot == std::string_view::npos && dot_bits != 0)
+      {
+        if (scan.at >= base)
+        {
+          // Keep only dots after the '@' found in this block.
+          const std::size_t shift = scan.at - base + 1;
+          dot_bits = shift >= 32 ? 0u : (dot_bits >> shift) << shift;
+        }
+        if (dot_bits != 0)
+        {
+          scan.dot = base + static_cast<std::size_t>(std::countr_zero(dot_bits));
+        }
+      }
+    }
+
+    inline void email_scan_scalar(std::string_view s, std::size_t begin, EmailScan &scan) noexcept
+    {
+      for (std::size_t i = begin; i < s.size(); ++i)
+      {
+        switch (s[i])
+        {
+        case ' ':
+          scan.space = true;
+          return;
+        case '@':
+          if (scan.at == std::string_view::npos)
+          {
+            scan.at = i;
+          }
+          else
+          {
+            scan.multiple_at = true;
+          }
+          break;
+        case '.':
+          if (scan.at != std::string_view::npos && scan.dot == std::string_view::npos)
+          {
+            scan.dot = i;
+          }
+          break;
+        default:
+          break;
+        }
+      }
+    }
+
+#if VIX_VALIDATION_X86_SIMD
+    /**
+     * @brief Process the 16 bytes at `base`, ignoring lanes outside `keep`
+     * (used for the final block, which overlaps bytes already scanned).
+     * Returns false once a space is found.
+     */
+    inline bool email_block_sse2(const char *p, std::size_t base, std::uint32_t keep, EmailScan &scan) noexcept
+    {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + base));
+      const auto sp = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(' '))));
+      if ((sp & keep) != 0)
+      {
+        scan.space = true;
+        return false;
+      }
+      email_fold(scan, base,
+                 static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('@')))) & keep,
+                 static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('.')))) & keep);
+      return true;
+    }
+
+    /// @brief Requires s.size() >= 16.
+    inline void email_scan_sse2(std::string_view s, EmailScan &scan) noexcept
+    {
+      const char *p = s.data();
+      const std::size_t n = s.size();
+      std::size_t i = 0;
+      for (; i + 16 <= n; i += 16)
+      {
+        if (!email_block_sse2(p, i, 0xFFFFu, scan))
+        {
+          return;
+        }
+      }
+      if (i < n)
+      {
+        (void)email_block_sse2(p, n - 16, (0xFFFFu << (i - (n - 16))) & 0xFFFFu, scan);
+      }
+    }
+
+    VIX_VALIDATION_TARGET_AVX2 inline bool
+    email_block_avx2(const char *p, std::size_t base, std::uint32_t keep, EmailScan &scan) noexcept
+    {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + base));
+      const auto sp = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '))));
+      if ((sp & keep) != 0)
+      {
+        scan.space = true;
+        return false;
+      }
+      email_fold(scan, base,
+                 static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('@')))) & keep,
+                 static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('.')))) & keep);
+      return true;
+    }
+
+    /// @brief Lanes of the 32 bytes at `p` equal to ' ', '@' or '.'.
+    VIX_VALIDATION_TARGET_AVX2 inline __m256i email_hits_avx2(const char *p) noexcept
+    {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+      return _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                                             _mm256_cmpeq_epi8(v, _mm256_set1_epi8('@'))),
+                             _mm256_cmpeq_epi8(v, _mm256_set1_epi8('.')));
+    }
+
+    /// @brief Requires s.size() >= 32.
+    VIX_VALIDATION_TARGET_AVX2 inline void email_scan_avx2(std::string_view s, EmailScan &scan) noexcept
+    {
+      const char *p = s.data();
+      const std::size_t n = s.size();
+      std::size_t i = 0;
+
+      // 128 bytes per step; steps holding none of ' ', '@', '.' (the long
+      // runs of an adversarial input) cost a single test.
+      for (; i + 128 <= n; i += 128)
+      {
+        const __m256i hits = _mm256_or_si256(
+            _mm256_or_si256(email_hits_avx2(p + i), email_hits_avx2(p + i + 32)),
+            _mm256_or_si256(email_hits_avx2(p + i + 64), email_hits_avx2(p + i + 96)));
+        if (_mm256_testz_si256(hits, hits))
+        {
+          continue;
+        }
+        for (std::size_t k = 0; k < 128; k += 32)
+        {
+          if (!email_block_avx2(p, i + k, 0xFFFFFFFFu, scan))
+          {
+            return;
+          }
+        }
+      }
+
+      for (; i + 32 <= n; i += 32)
+      {
+        if (!email_block_avx2(p, i, 0xFFFFFFFFu, scan))
+        {
+          return;
+        }
+      }
+      if (i < n)
+      {
+        (void)email_block_avx2(p, n - 32, 0xFFFFFFFFu << (i - (n - 32)), scan);
+      }
+    }
+#endif // VIX_VALIDATION_X86_SIMD
+  } // namespace detail
+
+  /**
+   * @brief Locate ' ', '@' and '.' in one pass (stops at the first space).
+   */
+  [[nodiscard]] inline EmailScan email_scan(std::string_view s, SimdLevel level = detected_simd_level()) noexcept
+  {
+    EmailScan scan;
+#if VIX_VALIDATION_X86_SIMD
+    if (s.size() >= 16)
+    {
+      level = usable_simd_level(level);
+      if (level == SimdLevel::AVX2 && s.size() >= 32)
+      {
+        detail::email_scan_avx2(s, scan);
+        return scan;
+      }
+      if (level != SimdLevel::Scalar)
+      {
+        detail::email_scan_sse2(s, scan);
+        return scan;
+      }
+    }
+#else
+    (void)level;
+#endif
+    detail::email_scan_scalar(s, 0, scan);
+    return scan;
+  }
+
+  /**
+   * @brief Result of a UTF-8 sweep.
+   *
+   * `error` is the byte offset of the first invalid sequence (npos when the
+   * input is valid) and `length` the number of code points before it.
+   */
+  struct Utf8Scan
+  {
+    std::size_t error{std::string_view::npos};
+    std::size_t length{0};
+
+    [[nodiscard]] bool valid() const noexcept
+    {
+      return error == std::string_view::npos;
+    }
+  };
+
+  namespace detail
+  {
+    /**
+     * @brief Decode the code point at `i` and advance past it.
+     * Returns false, leaving `i` on the offending lead byte, if invalid.
+     */
+    inline bool utf8_step(const unsigned char *p, std::size_t n, std::size_t &i) noexcept
+    {
+      const unsigned c = p[i];
+      if (c < 0x80)
+      {
+        ++i;
+        return true;
+      }
+
+      // Ranges from RFC 3629: no overlongs, surrogates or values > U+10FFFF.
+      std::size_t len = 0;
+      unsigned lo = 0x80;
+      unsigned hi = 0xBF;
+      if (c >= 0xC2 && c <= 0xDF)
+      {
+        len = 2;
+      }
+      else if (c >= 0xE0 && c <= 0xEF)
+      {
+        len = 3;
+        lo = c == 0xE0 ? 0xA0 : lo;
+        hi = c == 0xED ? 0x9F : hi;
+      }
+      else if (c >= 0xF0 && c <= 0xF4)
+      {
+        len = 4;
+        lo = c == 0xF0 ? 0x90 : lo;
+        hi = c == 0xF4 ? 0x8F : hi;
+      }
+      else
+      {
+        return false;
+      }
+
+      if (n - i < len || p[i + 1] < lo || p[i + 1] > hi)
+      {
+        return false;
+      }
+      for (std::size_t k = 2; k < len; ++k)
+      {
+        if ((p[i + k] & 0xC0) != 0x80)
+        {
+          return false;
+        }
+      }
+      i += len;
+      return true;
+    }
+
+    /**
+     * @brief Decode from `i` until `i >= stop`, counting code points.
+     * Returns false, leaving `i` on the invalid sequence, on error.
+     */
+    inline bool utf8_decode(const unsigned char *p, std::size_t n, std::size_t &i, std::size_t stop,
+                            std::size_t &count) noexcept
+    {
+      while (i < stop)
+      {
+        // ASCII runs, 8 bytes at a time.
+        if (n - i >= 8)
+        {
+          std::uint64_t w;
+          std::memcpy(&w, p + i, 8);
+          if ((w & 0x8080808080808080ULL) == 0)
+          {
+            i += 8;
+            count += 8;
+            continue;
+          }
+        }
+
+        if (!utf8_step(p, n, i))
+        {
+          return false;
+        }
+        ++count;
+      }
+      return true;
+    }
+
+    /// @brief Continue `scan` from `begin`, a code point boundary.
+    inline void utf8_scan_scalar(std::string_view s, std::size_t begin, Utf8Scan &scan) noexcept
+    {
+      const auto *p = reinterpret_cast<const unsigned char *>(s.data());
+      std::size_t i = begin;
+      if (!utf8_decode(p, s.size(), i, s.size(), scan.length))
+      {
+        scan.error = i;
+      }
+    }
+
+    /**
+     * @brief Step back from `i` to the lead byte of the code point that
+     * contains it, and uncount any lead byte stepped over.
+     */
+    inline std::size_t utf8_rewind(std::string_view s, std::size_t i, Utf8Scan &scan) noexcept
+    {
+      std::size_t j = i;
+      while (j > 0 && i - j < 3 && (static_cast<unsigned char>(s[j - 1]) & 0xC0) == 0x80)
+      {
+        --j;
+      }
+      if (j > 0 && (static_cast<unsigned char>(s[j - 1]) & 0xC0) == 0xC0)
+      {
+        --j;
+        --scan.length;
+      }
+      return j;
+    }
+
+#if VIX_VALIDATION_X86_SIMD
+    /**
+     * @brief SSE2 has no byte shuffle, so only pure ASCII blocks are
+     * vectorized; other blocks go through utf8_decode.
+     */
+    inline void utf8_scan_sse2(std::string_view s, Utf8Scan &scan) noexcept
+    {
+      const auto *p = reinterpret_cast<const unsigned char *>(s.data());
+      const std::size_t n = s.size();
+      std::size_t i = 0;
+      std::size_t count = 0;
+
+      while (n - i >= 16)
+      {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+        if (_mm_movemask_epi8(v) == 0)
+        {
+          i += 16;
+          count += 16;
+          continue;
+        }
+
+        if (!utf8_decode(p, n, i, i + 16, count))
+        {
+          scan.error = i;
+          scan.length = count;
+          return;
+        }
+      }
+
+      scan.length = count;
+      utf8_scan_scalar(s, i, scan);
+    }
+
+    /// @brief The 32 bytes ending `N` bytes before `input`'s first byte.
+    template <int N>
+    VIX_VALIDATION_TARGET_AVX2 inline __m256i utf8_prev_avx2(__m256i input, __m256i prev_input) noexcept
+    {
+      return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input, input, 0x21), 16 - N);
+    }
+
+    VIX_VALIDATION_TARGET_AVX2 inline __m256i utf8_lookup_avx2(__m256i nibbles, const std::uint8_t (&table)[16]) noexcept
+    {
+      const __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i *>(table));
+      return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(t), nibbles);
+    }
+
+    /**
+     * @brief Error lanes of a 32-byte block (Keiser & Lemire, "Validating
+     * UTF-8 In Less Than One Instruction Per Byte", 2021): three nibble
+     * lookups classify each (previous byte, byte) pair, and two saturating
+     * subtractions check where 3rd and 4th continuation bytes must be.
+     */
+    VIX_VALIDATION_TARGET_AVX2 inline __m256i utf8_errors_avx2(__m256i input, __m256i prev_input) noexcept
+    {
+      constexpr std::uint8_t too_short = 1 << 0;
+      constexpr std::uint8_t too_long = 1 << 1;
+      constexpr std::uint8_t overlong_3 = 1 << 2;
+      constexpr std::uint8_t too_large = 1 << 3;
+      constexpr std::uint8_t surrogate = 1 << 4;
+      constexpr std::uint8_t overlong_2 = 1 << 5;
+      constexpr std::uint8_t too_large_1000 = 1 << 6;
+      constexpr std::uint8_t overlong_4 = 1 << 6;
+      constexpr std::uint8_t two_conts = 1 << 7;
+      constexpr std::uint8_t carry = too_short | too_long | two_conts;
+
+      static constexpr std::uint8_t byte_1_high[16] = {
+          too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+          two_conts, two_conts, two_conts, two_conts,
+          too_short | overlong_2,
+          too_short,
+          too_short | overlong_3 | surrogate,
+          too_short | too_large | too_large_1000 | overlong_4};
+
+      static constexpr std::uint8_t byte_1_low[16] = {
+          carry | overlong_3 | overlong_2 | overlong_4,
+          carry | overlong_2,
+          carry,
+          carry,
+          carry | too_large,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000 | surrogate,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000};
+
+      static constexpr std::uint8_t byte_2_high[16] = {
+          too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+          too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+          too_long | overlong_2 | two_conts | overlong_3 | too_large,
+          too_long | overlong_2 | two_conts | surrogate | too_large,
+          too_long | overlong_2 | two_conts | surrogate | too_large,
+          too_short, too_short, too_short, too_short};
+
+      const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+      const __m256i prev1 = utf8_prev_avx2<1>(input, prev_input);
+
+      const __m256i special = _mm256_and_si256(
+          _mm256_and_si256(
+              utf8_lookup_avx2(_mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble), byte_1_high),
+              utf8_lookup_avx2(_mm256_and_si256(prev1, low_nibble), byte_1_low)),
+          utf8_lookup_avx2(_mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble), byte_2_high));
+
+      const __m256i third = _mm256_subs_epu8(utf8_prev_avx2<2>(input, prev_input), _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+      const __m256i fourth = _mm256_subs_epu8(utf8_prev_avx2<3>(input, prev_input), _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+      const __m256i must_23 = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+
+      return _mm256_xor_si256(must_23, special);
+    }
+
+    /// @brief Lanes holding a lead byte whose sequence runs past the block.
+    VIX_VALIDATION_TARGET_AVX2 inline __m256i utf8_incomplete_avx2(__m256i input) noexcept
+    {
+      const __m256i max = _mm256_setr_epi8(
+          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+          static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+      return _mm256_subs_epu8(input, max);
+    }
+
+    /**
+     * @brief Validate and count 32 bytes per step. Code points are counted
+     * as bytes that are not continuation bytes (signed > -65). On the first
+     * bad block, and for the final partial block, the scalar decoder takes
+     * over from the enclosing code point boundary, so the reported offset
+     * is exact.
+     */
+    VIX_VALIDATION_TARGET_AVX2 inline void utf8_scan_avx2(std::string_view s, Utf8Scan &scan) noexcept
+    {
+      const char *p = s.data();
+      const std::size_t n = s.size();
+      const __m256i not_continuation = _mm256_set1_epi8(-65);
+
+      __m256i prev_input = _mm256_setzero_si256();
+      __m256i prev_incomplete = _mm256_setzero_si256();
+      std::size_t count = 0;
+      std::size_t i = 0;
+
+      for (; n - i >= 32; i += 32)
+      {
+        // Two ASCII blocks at once: only a pending lead byte can fail.
+        if (n - i >= 64)
+        {
+          const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+          const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i + 32));
+          if (_mm256_movemask_epi8(_mm256_or_si256(a, b)) == 0 && _mm256_testz_si256(prev_incomplete, prev_incomplete))
+          {
+            prev_input = b;
+            count += 64;
+            i += 32;
+            continue;
+          }
+        }
+
+        const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+        __m256i error;
+        if (_mm256_movemask_epi8(input) == 0)
+        {
+          error = prev_incomplete;
+          prev_incomplete = _mm256_setzero_si256();
+          count += 32;
+        }
+        else
+        {
+          error = utf8_errors_avx2(input, prev_input);
+          prev_incomplete = utf8_incomplete_avx2(input);
+          count += static_cast<std::size_t>(std::popcount(
+              static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(input, not_continuation)))));
+        }
+
+        if (!_mm256_testz_si256(error, error))
+        {
+          // Uncount this block; the scalar pass re-reads it.
+          count -= static_cast<std::size_t>(std::popcount(
+              static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(input, not_continuation)))));
+          break;
+        }
+        prev_input = input;
+      }
+
+      scan.length = count;
+      utf8_scan_scalar(s, utf8_rewind(s, i, scan), scan);
+    }
+#endif // VIX_VALIDATION_X86_SIMD
+  } // namespace detail
+
+  /**
+   * @brief Validate UTF-8 and count code points in one pass.
+   */
+  [[nodiscard]] inline Utf8Scan utf8_scan(std::string_view s, SimdLevel level = detected_simd_level()) noexcept
+  {
+    Utf8Scan scan;
+#if VIX_VALIDATION_X86_SIMD
+    level = usable_simd_level(level);
+    if (level == SimdLevel::AVX2 && s.size() >= 32)
+    {
+      detail::utf8_scan_avx2(s, scan);
+      return scan;
+    }
+    if (level != SimdLevel::Scalar && s.size() >= 16)
+    {
+      detail::utf8_scan_sse2(s, scan);
+      return scan;
+    }
+#else
+    (void)level;
+#endif
+    detail::utf8_scan_scalar(s, 0, scan);
+    return scan;
+  }
+
+  namespace detail
+  {
+    inline std::size_t charset_find_scalar(std::string_view s, std::size_t begin, const CharSet &set) noexcept
+    {
+      const auto &t = set.table();
+      const auto *p = reinterpret_cast<const unsigned char *>(s.data());
+      const std::size_t n = s.size();
+      std::size_t i = begin;
+
+      // 8 lookups per step, one branch.
+      for (; n - i >= 8; i += 8)
+      {
+        const unsigned all = t[p[i]] & t[p[i + 1]] & t[p[i + 2]] & t[p[i + 3]] &
+                             t[p[i + 4]] & t[p[i + 5]] & t[p[i + 6]] & t[p[i + 7]];
+        if (all == 0)
+        {
+          break;
+        }
+      }
+      for (; i < n; ++i)
+      {
+        if (t[p[i]] == 0)
+        {
+          return i;
+        }
+      }
+      return std::string_view::npos;
+    }
+
+#if VIX_VALIDATION_X86_SIMD
+    /// @brief Lanes of `v` outside the set encoded by the nibble tables.
+    VIX_VALIDATION_TARGET_AVX2 inline std::uint32_t charset_misses_avx2(__m256i v, __m256i low, __m256i high) noexcept
+    {
+      const __m256i nibble = _mm256_set1_epi8(0x0F);
+      const __m256i hits = _mm256_and_si256(_mm256_shuffle_epi8(low, _mm256_and_si256(v, nibble)),
+                                            _mm256_shuffle_epi8(high, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble)));
+      return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hits, _mm256_setzero_si256())));
+    }
+
+    VIX_VALIDATION_TARGET_AVX2 inline std::uint32_t charset_misses_16(__m128i v, __m128i low, __m128i high) noexcept
+    {
+      const __m128i nibble = _mm_set1_epi8(0x0F);
+      const __m128i hits = _mm_and_si128(_mm_shuffle_epi8(low, _mm_and_si128(v, nibble)),
+                                         _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi16(v, 4), nibble)));
+      return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(hits, _mm_setzero_si128())));
+    }
+
+    /**
+     * @brief 32 bytes per step (16 for inputs under 32 bytes); the final
+     * block overlaps bytes already known to be members. Requires
+     * s.size() >= 16 and set.vectorizable().
+     */
+    VIX_VALIDATION_TARGET_AVX2 inline std::size_t charset_find_avx2(std::string_view s, const CharSet &set) noexcept
+    {
+      const char *p = s.data();
+      const std::size_t n = s.size();
+      const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(set.low_nibbles().data()));
+      const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(set.high_nibbles().data()));
+
+      if (n < 32)
+      {
+        std::uint32_t m = charset_misses_16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), low, high);
+        if (m != 0)
+        {
+          return static_cast<std::size_t>(std::countr_zero(m));
+        }
+        m = charset_misses_16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + n - 16)), low, high);
+        return m != 0 ? n - 16 + static_cast<std::size_t>(std::countr_zero(m)) : std::string_view::npos;
+      }
+
+      const __m256i low2 = _mm256_broadcastsi128_si256(low);
+      const __m256i high2 = _mm256_broadcastsi128_si256(high);
+      std::size_t i = 0;
+      for (; n - i >= 32; i += 32)
+      {
+        const std::uint32_t m = charset_misses_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)), low2, high2);
+        if (m != 0)
+        {
+          return i + static_cast<std::size_t>(std::countr_zero(m));
+        }
+      }
+      if (i < n)
+      {
+        const std::uint32_t m = charset_misses_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + n - 32)), low2, high2);
+        if (m != 0)
+        {
+          return n - 32 + static_cast<std::size_t>(std::countr_zero(m));
+        }
+      }
+      return std::string_view::npos;
+    }
+#endif // VIX_VALIDATION_X86_SIMD
+  } // namespace detail
+
+  /**
+   * @brief Offset of the first byte of `s` not in `set`, or npos.
+   *
+   * The vector path needs a byte shuffle, so it runs on AVX2 CPUs (16 or
+   * 32 bytes per step); other CPUs use the table, 8 bytes per step.
+   */
+  [[nodiscard]] inline std::size_t charset_find(std::string_view s, const CharSet &set,
+                                                SimdLevel level = detected_simd_level()) noexcept
+  {
+#if VIX_VALIDATION_X86_SIMD
+    if (s.size() >= 16 && set.vectorizable() && usable_simd_level(level) == SimdLevel::AVX2)
+    {
+      return detail::charset_find_avx2(s, set);
+    }
+#else
+    (void)level;
+#endif
+    return detail::charset_find_scalar(s, 0, set);
+  }
+
+} // namespace vix::validation::kernels
+
+#endif // VIX_VALIDATION_TEXT_KERNELS_HPP
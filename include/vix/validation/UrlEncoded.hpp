@@ -0,0 +1,494 @@
+/**
+ *
+ *  @file UrlEncoded.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_URL_ENCODED_HPP
+#define VIX_VALIDATION_URL_ENCODED_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/Simd.hpp>
+
+namespace vix::validation
+{
+
+  /**
+   * @class ScratchArena
+   * @brief Bump allocator for per-request text.
+   *
+   * Memory comes from blocks that never move, so views into earlier
+   * allocations stay valid while more are made. reset() keeps every block
+   * for the next request, so a steady workload stops allocating.
+   */
+  class ScratchArena
+  {
+  public:
+    static constexpr std::size_t block_size = 4096;
+
+    ScratchArena() = default;
+    ScratchArena(const ScratchArena &) = delete;
+    ScratchArena &operator=(const ScratchArena &) = delete;
+    ScratchArena(ScratchArena &&) noexcept = default;
+    ScratchArena &operator=(ScratchArena &&) noexcept = default;
+
+    /// @brief `n` uninitialized bytes.
+    [[nodiscard]] char *allocate(std::size_t n)
+    {
+      if (blocks_.empty() || blocks_[current_].size - used_ < n)
+      {
+        next_block(n);
+      }
+      char *p = blocks_[current_].data.get() + used_;
+      used_ += n;
+      return p;
+    }
+
+    /// @brief Copy of `s` owned by the arena.
+    [[nodiscard]] std::string_view store(std::string_view s)
+    {
+      if (s.empty())
+      {
+        return {};
+      }
+      char *p = allocate(s.size());
+      std::memcpy(p, s.data(), s.size());
+      return std::string_view(p, s.size());
+    }
+
+    /// @brief Forget every allocation; every block is kept for reuse.
+    void reset() noexcept
+    {
+      current_ = 0;
+      used_ = 0;
+    }
+
+  private:
+    struct Block
+    {
+      std::unique_ptr<char[]> data;
+      std::size_t size{0};
+    };
+
+    void next_block(std::size_t n)
+    {
+      // Reuse a later block kept by reset() when one is large enough.
+      for (std::size_t b = blocks_.empty() ? 0 : current_ + 1; b < blocks_.size(); ++b)
+      {
+        if (blocks_[b].size >= n)
+        {
+          current_ = b;
+          used_ = 0;
+          return;
+        }
+      }
+      const std::size_t size = n > block_size ? n : block_size;
+      blocks_.push_back(Block{std::unique_ptr<char[]>(new char[size]), size});
+      current_ = blocks_.size() - 1;
+      used_ = 0;
+    }
+
+    std::vector<Block> blocks_;
+    std::size_t current_{0};
+    std::size_t used_{0};
+  };
+
+  namespace detail
+  {
+    [[nodiscard]] inline int hex_digit(char c) noexcept
+    {
+      if (c >= '0' && c <= '9')
+        return c - '0';
+      if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+      if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+      return -1;
+    }
+
+    /**
+     * @brief Decode '+' and %XX from `in` into `out` (at least in.size()
+     * bytes). Returns the decoded size, or npos with `error` set to the
+     * offset of a malformed escape.
+     *
+     * Runs between escapes are found with memchr and copied by a loop the
+     * compiler vectorizes.
+     */
+    [[nodiscard]] inline std::size_t url_decode(std::string_view in, char *out, std::size_t &error) noexcept
+    {
+      const char *p = in.data();
+      const std::size_t size = in.size();
+      std::size_t n = 0;
+      std::size_t i = 0;
+      while (i < size)
+      {
+        const void *hit = std::memchr(p + i, '%', size - i);
+        const std::size_t run_end = hit ? static_cast<std::size_t>(static_cast<const char *>(hit) - p) : size;
+        for (std::size_t k = i; k < run_end; ++k)
+        {
+          out[n + k - i] = p[k] == '+' ? ' ' : p[k];
+        }
+        n += run_end - i;
+        i = run_end;
+        if (i == size)
+        {
+          break;
+        }
+
+        const int hi = size - i < 3 ? -1 : hex_digit(p[i + 1]);
+        const int lo = size - i < 3 ? -1 : hex_digit(p[i + 2]);
+        if (hi < 0 || lo < 0)
+        {
+          error = i;
+          return std::string_view::npos;
+        }
+        out[n++] = static_cast<char>(hi * 16 + lo);
+        i += 3;
+      }
+      return n;
+    }
+
+    /**
+     * @brief Positions of '&', '=' and of escapes ('%', '+') in up to 64
+     * bytes, one bit per byte.
+     */
+    struct UrlMasks
+    {
+      std::uint64_t amp{0};
+      std::uint64_t eq{0};
+      std::uint64_t esc{0};
+    };
+
+    [[nodiscard]] inline UrlMasks url_masks_scalar(const char *p, std::size_t n) noexcept
+    {
+      UrlMasks m;
+      for (std::size_t k = 0; k < n; ++k)
+      {
+        const char c = p[k];
+        m.amp |= std::uint64_t{c == '&'} << k;
+        m.eq |= std::uint64_t{c == '='} << k;
+        m.esc |= std::uint64_t{(c == '%') || (c == '+')} << k;
+      }
+      return m;
+    }
+
+#if VIX_VALIDATION_X86_SIMD
+    [[nodiscard]] inline UrlMasks url_masks_sse2(const char *p) noexcept
+    {
+      UrlMasks m;
+      for (unsigned k = 0; k < 4; ++k)
+      {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16 * k));
+        const auto bits = [v](char c)
+        {
+          return std::uint64_t{static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(c))))};
+        };
+        m.amp |= bits('&') << (16 * k);
+        m.eq |= bits('=') << (16 * k);
+        m.esc |= (bits('%') | bits('+')) << (16 * k);
+      }
+      return m;
+    }
+
+    VIX_VALIDATION_TARGET_AVX2 inline UrlMasks url_masks_avx2(const char *p) noexcept
+    {
+      UrlMasks m;
+      for (unsigned k = 0; k < 2; ++k)
+      {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 32 * k));
+        const auto bits = [v](char c) VIX_VALIDATION_TARGET_AVX2
+        {
+          return std::uint64_t{static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(c))))};
+        };
+        m.amp |= bits('&') << (32 * k);
+        m.eq |= bits('=') << (32 * k);
+        m.esc |= (bits('%') | bits('+')) << (32 * k);
+      }
+      return m;
+    }
+#endif // VIX_VALIDATION_X86_SIMD
+
+    [[nodiscard]] inline UrlMasks url_masks(const char *p, std::size_t n, SimdLevel level) noexcept
+    {
+#if VIX_VALIDATION_X86_SIMD
+      if (level != SimdLevel::Scalar)
+      {
+        // A short block is padded with zero bytes, which match nothing.
+        alignas(32) char tail[64] = {};
+        if (n < 64)
+        {
+          std::memcpy(tail, p, n);
+          p = tail;
+        }
+        return level == SimdLevel::AVX2 ? url_masks_avx2(p) : url_masks_sse2(p);
+      }
+#else
+      (void)level;
+#endif
+      return url_masks_scalar(p, n);
+    }
+
+    /// @brief Bits [0, k) of a 64-bit mask, k in [0, 64].
+    [[nodiscard]] constexpr std::uint64_t url_bits_below(std::size_t k) noexcept
+    {
+      return k >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << k) - 1;
+    }
+  } // namespace detail
+
+  /**
+   * @class UrlEncodedParser
+   * @brief Incremental application/x-www-form-urlencoded tokenizer.
+   *
+   * The body is read once, 64 bytes at a time: SIMD compares mark every
+   * '&', '=', '%' and '+', and the pairs are cut from those bit masks
+   * rather than by branching on each byte. Each `key=value` pair goes to a sink
+   * `bool(std::string_view key, std::string_view value)`; a false return
+   * stops parsing. Keys and values without escapes are views of the input.
+   * Only parts with '%' or '+' are decoded, into the parser's ScratchArena.
+   *
+   * Input may arrive in chunks through feed(), then finish(). A pair that
+   * straddles chunks is assembled in the arena. Views into a chunk are
+   * valid only while that chunk is alive. Empty pairs (`a=1&&b=2`) are
+   * skipped, and a pair without '=' has an empty value.
+   */
+  class UrlEncodedParser
+  {
+  public:
+    UrlEncodedParser() = default;
+
+    /// @brief Force a scan level (tests compare every path).
+    explicit UrlEncodedParser(SimdLevel level) noexcept
+        : level_(usable_simd_level(level))
+    {
+    }
+
+    /**
+     * @brief Parse the next chunk; pairs it completes are delivered now.
+     * @return false once parsing failed or the sink stopped it.
+     */
+    template <typename Sink>
+    bool feed(std::string_view chunk, Sink &&sink)
+    {
+      return run(chunk, sink, false);
+    }
+
+    /// @brief Deliver the last pair. Returns false on failure.
+    template <typename Sink>
+    bool finish(Sink &&sink)
+    {
+      return run({}, sink, true);
+    }
+
+    /// @brief Whole body at once: feed() then finish(), without copying the last pair.
+    template <typename Sink>
+    bool parse(std::string_view body, Sink &&sink)
+    {
+      return run(body, sink, true);
+    }
+
+    /// @brief Offset in the whole body of a malformed escape, or npos.
+    [[nodiscard]] std::size_t error_offset() const noexcept
+    {
+      return error_;
+    }
+
+    [[nodiscard]] bool failed() const noexcept
+    {
+      return stopped_;
+    }
+
+    /// @brief Ready for the next body; arena memory is kept.
+    void reset() noexcept
+    {
+      arena_.reset();
+      carry_.clear();
+      carrying_ = false;
+      consumed_ = 0;
+      error_ = std::string_view::npos;
+      stopped_ = false;
+    }
+
+    [[nodiscard]] ScratchArena &arena() noexcept
+    {
+      return arena_;
+    }
+
+  private:
+    template <typename Sink>
+    bool run(std::string_view chunk, Sink &sink, bool last)
+    {
+      if (stopped_)
+      {
+        return false;
+      }
+
+      std::size_t begin = 0;
+      if (carrying_)
+      {
+        // Complete the pair left open by the previous chunk.
+        const std::size_t amp = chunk.find('&');
+        if (amp == std::string_view::npos && !last)
+        {
+          carry_.append(chunk);
+          consumed_ += chunk.size();
+          return true;
+        }
+
+        const std::size_t end = amp == std::string_view::npos ? chunk.size() : amp;
+        carry_.append(chunk.substr(0, end));
+        const std::size_t start = consumed_ - (carry_.size() - end);
+        const bool ok = emit(arena_.store(carry_), start, sink);
+        carry_.clear();
+        carrying_ = false;
+        if (!ok)
+        {
+          return false;
+        }
+        if (amp == std::string_view::npos)
+        {
+          consumed_ += chunk.size();
+          return true;
+        }
+        begin = amp + 1;
+      }
+
+      // Scan 64 bytes at a time: masks of '&', '=' and escapes, then one
+      // step per pair instead of one branch per byte.
+      std::size_t piece = begin;
+      std::size_t eq = std::string_view::npos; // relative to piece
+      bool escaped_key = false;
+      bool escaped_value = false;
+
+      for (std::size_t base = begin; base < chunk.size(); base += 64)
+      {
+        const std::size_t len = chunk.size() - base < 64 ? chunk.size() - base : 64;
+        const detail::UrlMasks m = detail::url_masks(chunk.data() + base, len, level_);
+        std::uint64_t amps = m.amp;
+        std::size_t cur = 0;
+        for (;;)
+        {
+          const std::size_t stop = amps ? static_cast<std::size_t>(std::countr_zero(amps)) : len;
+          const std::uint64_t range = detail::url_bits_below(stop) & ~detail::url_bits_below(cur);
+          if (eq == std::string_view::npos && (m.eq & range) != 0)
+          {
+            eq = base + static_cast<std::size_t>(std::countr_zero(m.eq & range)) - piece;
+          }
+
+          std::uint64_t key_bits = range;
+          if (eq != std::string_view::npos)
+          {
+            key_bits = piece + eq < base ? 0 : range & detail::url_bits_below(piece + eq - base);
+          }
+          escaped_key = escaped_key || (m.esc & key_bits) != 0;
+          escaped_value = escaped_value || (m.esc & range & ~key_bits) != 0;
+
+          if (amps == 0)
+          {
+            break;
+          }
+          if (!emit_split(chunk.substr(piece, base + stop - piece), eq, escaped_key, escaped_value,
+                          consumed_ + piece, sink))
+          {
+            return false;
+          }
+          piece = base + stop + 1;
+          eq = std::string_view::npos;
+          escaped_key = escaped_value = false;
+          amps &= amps - 1;
+          cur = stop + 1;
+        }
+      }
+
+      const std::string_view rest = chunk.substr(piece);
+      if (last)
+      {
+        consumed_ += chunk.size();
+        return emit_split(rest, eq, escaped_key, escaped_value, consumed_ - rest.size(), sink);
+      }
+
+      carry_.assign(rest);
+      carrying_ = !rest.empty();
+      consumed_ += chunk.size();
+      return true;
+    }
+
+    /// @brief Pair assembled from several chunks: classify, then deliver.
+    template <typename Sink>
+    bool emit(std::string_view pair, std::size_t offset, Sink &sink)
+    {
+      const std::size_t eq = pair.find('=');
+      const std::string_view key = pair.substr(0, eq);
+      const std::string_view value = eq == std::string_view::npos ? std::string_view{} : pair.substr(eq + 1);
+      return emit_split(pair, eq, key.find_first_of("%+") != std::string_view::npos,
+                        value.find_first_of("%+") != std::string_view::npos, offset, sink);
+    }
+
+    template <typename Sink>
+    bool emit_split(std::string_view pair, std::size_t eq, bool escaped_key, bool escaped_value,
+                    std::size_t offset, Sink &sink)
+    {
+      if (pair.empty())
+      {
+        return true;
+      }
+
+      std::string_view key = pair.substr(0, eq);
+      std::string_view value = eq == std::string_view::npos ? std::string_view{} : pair.substr(eq + 1);
+      if ((escaped_key && !decode(key, offset)) ||
+          (escaped_value && !decode(value, offset + eq + 1)))
+      {
+        stopped_ = true;
+        return false;
+      }
+
+      if (!static_cast<bool>(sink(key, value)))
+      {
+        stopped_ = true;
+        return false;
+      }
+      return true;
+    }
+
+    [[nodiscard]] bool decode(std::string_view &text, std::size_t offset)
+    {
+      char *out = arena_.allocate(text.size());
+      std::size_t bad = 0;
+      const std::size_t n = detail::url_decode(text, out, bad);
+      if (n == std::string_view::npos)
+      {
+        error_ = offset + bad;
+        return false;
+      }
+      text = std::string_view(out, n);
+      return true;
+    }
+
+    SimdLevel level_{detected_simd_level()};
+    ScratchArena arena_;
+    std::string carry_;
+    bool carrying_{false};
+    bool stopped_{false};
+    std::size_t consumed_{0};
+    std::size_t error_{std::string_view::npos};
+  };
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_URL_ENCODED_HPP
@@ -15,21 +15,53 @@
 #ifndef VIX_VALIDATION_VALIDATE_HPP
 #define VIX_VALIDATION_VALIDATE_HPP
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <vix/validation/ErrorSink.hpp>
 #include <vix/validation/Rule.hpp>
 #include <vix/validation/Rules.hpp>
 #include <vix/validation/ValidationErrors.hpp>
+#include <vix/validation/ValidationPolicy.hpp>
 #include <vix/validation/ValidationResult.hpp>
 
 namespace vix::validation
 {
 
+  namespace detail
+  {
+    /**
+     * @brief Rule wrapper used by `rule_if` on a chained builder.
+     */
+    template <typename R>
+    struct RuleIf
+    {
+      bool enabled;
+      R rule;
+
+      template <typename V>
+      void operator()(std::string_view field, const V &value, ValidationErrors &out) const
+      {
+        if (enabled)
+        {
+          rule(field, value, out);
+        }
+      }
+
+      template <typename V>
+      [[nodiscard]] bool test(const V &value) const
+      {
+        return !enabled || test_rule(rule, value);
+      }
+    };
+  } // namespace detail
+
   /**
    * @brief Fluent validation builder for a single field/value.
    *
@@ -38,106 +70,559 @@ namespace vix::validation
    *                .min(18)
    *                .max(120)
    *                .result();
+   *
+   * Chaining on a temporary (the usual `validate(f, v).a().b()` form)
+   * stores every rule by value in the builder type itself: the chain above
+   * is a `Validator<int, rules::Min<int>, rules::Max<int>>` living on the
+   * stack, with no allocation and no type-erased call.
+   *
+   * Calling a rule method on a named (lvalue) Validator appends a
+   * type-erased `Rule<T>` instead, as before. Both kinds can be mixed on
+   * one builder; rules always run in the order they were added. A chained
+   * builder also converts to the plain `Validator<T>` when that type is
+   * spelled out.
+   *
+   * @tparam T     Value type.
+   * @tparam Rules Rule objects accumulated by chaining.
    */
-  template <typename T>
+  template <typename T, typename... Rules>
   class Validator
   {
+    template <typename, typename...>
+    friend class Validator;
+
   public:
+    using value_type = T;
+
     Validator(std::string_view field, const T &value)
+      requires(sizeof...(Rules) == 0)
         : field_(field), value_(value)
     {
     }
 
-    Validator &rule(Rule<T> r)
+    /**
+     * @brief Turn a chained builder back into the type-erased Validator<T>.
+     */
+    template <typename... Others>
+      requires(sizeof...(Rules) == 0 && sizeof...(Others) > 0)
+    Validator(Validator<T, Others...> &&other)
+        : field_(other.field_), value_(other.value_)
+    {
+      rules_.reserve(sizeof...(Others) + other.rules_.size());
+
+      // Keep registration order: erased rules go before the chained rule
+      // that was added after them (see slots_).
+      std::size_t next = 0;
+      const auto take_erased = [&](std::size_t slot)
+      {
+        for (; next < other.rules_.size() && other.slot_of(next) <= slot; ++next)
+        {
+          rules_.push_back(std::move(other.rules_[next]));
+        }
+      };
+
+      std::apply(
+          [&](Others &...rules)
+          {
+            std::size_t slot = 0;
+            ((take_erased(slot++), rules_.push_back(Rule<T>(std::move(rules)))), ...);
+          },
+          other.inline_);
+      take_erased(sizeof...(Others));
+    }
+
+    template <typename R>
+    [[nodiscard]] Validator<T, Rules..., std::decay_t<R>> rule(R &&r) &&
     {
+      static_assert(std::is_invocable_v<const std::decay_t<R> &, std::string_view, const T &, ValidationErrors &>,
+                    "Validator::rule: rule must be callable as (std::string_view, const T&, ValidationErrors&).");
+
+      if constexpr (sizeof...(Rules) == 0)
+      {
+        // Rules added so far precede every chained rule.
+        slots_.assign(rules_.size(), 0);
+      }
+
+      return Validator<T, Rules..., std::decay_t<R>>(
+          field_, value_,
+          std::tuple_cat(std::move(inline_), std::tuple<std::decay_t<R>>(std::forward<R>(r))),
+          std::move(rules_),
+          std::move(slots_));
+    }
+
+    Validator &rule(Rule<T> r) &
+    {
+      if constexpr (sizeof...(Rules) > 0)
+      {
+        slots_.push_back(sizeof...(Rules));
+      }
       rules_.push_back(std::move(r));
       return *this;
     }
 
-    Validator &rule_if(bool enabled, Rule<T> r)
+    template <typename R>
+    [[nodiscard]] auto rule_if(bool enabled, R &&r) &&
+    {
+      return std::move(*this).rule(detail::RuleIf<std::decay_t<R>>{enabled, std::forward<R>(r)});
+    }
+
+    Validator &rule_if(bool enabled, Rule<T> r) &
     {
       if (enabled)
       {
-        rules_.push_back(std::move(r));
+        rule(std::move(r));
       }
       return *this;
     }
 
-    Validator &required(std::string message = "field is required")
+    [[nodiscard]] auto required(ErrorText message = ErrorText::literal("field is required")) &&
+      requires std::is_same_v<T, std::string>
+    {
+      return std::move(*this).rule(rules::required(std::move(message)));
+    }
+
+    Validator &required(ErrorText message = ErrorText::literal("field is required")) &
       requires std::is_same_v<T, std::string>
     {
-      return rule(rules::required(std::move(message)));
+      return rule(Rule<T>(rules::required(std::move(message))));
     }
 
-    Validator &required_sv(std::string message = "field is required")
+    [[nodiscard]] auto required_sv(ErrorText message = ErrorText::literal("field is required")) &&
       requires std::is_same_v<T, std::string_view>
     {
-      return rule(rules::required_sv(std::move(message)));
+      return std::move(*this).rule(rules::required_sv(std::move(message)));
+    }
+
+    Validator &required_sv(ErrorText message = ErrorText::literal("field is required")) &
+      requires std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::required_sv(std::move(message))));
+    }
+
+    template <typename U>
+    [[nodiscard]] auto required(ErrorText message = ErrorText::literal("field is required")) &&
+      requires std::is_same_v<T, std::optional<U>>
+    {
+      return std::move(*this).rule(rules::required<U>(std::move(message)));
     }
 
     template <typename U>
-    Validator &required(std::string message = "field is required")
+    Validator &required(ErrorText message = ErrorText::literal("field is required")) &
       requires std::is_same_v<T, std::optional<U>>
     {
-      return rule(rules::required(std::move(message)));
+      return rule(Rule<T>(rules::required<U>(std::move(message))));
     }
 
-    Validator &min(T min_value, std::string message = "value is below minimum")
+    [[nodiscard]] auto min(T min_value, ErrorText message = ErrorText::literal("value is below minimum")) &&
       requires std::is_arithmetic_v<T>
     {
-      return rule(rules::min<T>(min_value, std::move(message)));
+      return std::move(*this).rule(rules::min<T>(min_value, std::move(message)));
     }
 
-    Validator &max(T max_value, std::string message = "value is above maximum")
+    Validator &min(T min_value, ErrorText message = ErrorText::literal("value is below minimum")) &
       requires std::is_arithmetic_v<T>
     {
-      return rule(rules::max<T>(max_value, std::move(message)));
+      return rule(Rule<T>(rules::min<T>(min_value, std::move(message))));
     }
 
-    Validator &between(T min_value, T max_value, std::string message = "value is out of range")
+    [[nodiscard]] auto max(T max_value, ErrorText message = ErrorText::literal("value is above maximum")) &&
       requires std::is_arithmetic_v<T>
     {
-      return rule(rules::between<T>(min_value, max_value, std::move(message)));
+      return std::move(*this).rule(rules::max<T>(max_value, std::move(message)));
     }
 
-    Validator &length_min(std::size_t n, std::string message = "length is below minimum")
+    Validator &max(T max_value, ErrorText message = ErrorText::literal("value is above maximum")) &
+      requires std::is_arithmetic_v<T>
+    {
+      return rule(Rule<T>(rules::max<T>(max_value, std::move(message))));
+    }
+
+    [[nodiscard]] auto between(T min_value, T max_value, ErrorText message = ErrorText::literal("value is out of range")) &&
+      requires std::is_arithmetic_v<T>
+    {
+      return std::move(*this).rule(rules::between<T>(min_value, max_value, std::move(message)));
+    }
+
+    Validator &between(T min_value, T max_value, ErrorText message = ErrorText::literal("value is out of range")) &
+      requires std::is_arithmetic_v<T>
+    {
+      return rule(Rule<T>(rules::between<T>(min_value, max_value, std::move(message))));
+    }
+
+    [[nodiscard]] auto length_min(std::size_t n, ErrorText message = ErrorText::literal("length is below minimum")) &&
       requires std::is_same_v<T, std::string>
     {
-      return rule(rules::length_min(n, std::move(message)));
+      return std::move(*this).rule(rules::length_min(n, std::move(message)));
     }
 
-    Validator &length_max(std::size_t n, std::string message = "length is above maximum")
+    Validator &length_min(std::size_t n, ErrorText message = ErrorText::literal("length is below minimum")) &
       requires std::is_same_v<T, std::string>
     {
-      return rule(rules::length_max(n, std::move(message)));
+      return rule(Rule<T>(rules::length_min(n, std::move(message))));
     }
 
-    Validator &email(std::string message = "invalid email format")
+    [[nodiscard]] auto length_max(std::size_t n, ErrorText message = ErrorText::literal("length is above maximum")) &&
       requires std::is_same_v<T, std::string>
     {
-      return rule(rules::email(std::move(message)));
+      return std::move(*this).rule(rules::length_max(n, std::move(message)));
     }
 
-    Validator &in_set(std::vector<std::string> allowed, std::string message = "value is not allowed")
+    Validator &length_max(std::size_t n, ErrorText message = ErrorText::literal("length is above maximum")) &
       requires std::is_same_v<T, std::string>
     {
-      return rule(rules::in_set(std::move(allowed), std::move(message)));
+      return rule(Rule<T>(rules::length_max(n, std::move(message))));
+    }
+
+    [[nodiscard]] auto charset(const CharSet &set, ErrorText message = ErrorText::literal("invalid character")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::charset(set, std::move(message)));
+    }
+
+    Validator &charset(const CharSet &set, ErrorText message = ErrorText::literal("invalid character")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::charset(set, std::move(message))));
+    }
+
+    [[nodiscard]] auto ascii(ErrorText message = ErrorText::literal("must be ASCII")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::ascii(std::move(message)));
+    }
+
+    Validator &ascii(ErrorText message = ErrorText::literal("must be ASCII")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::ascii(std::move(message))));
+    }
+
+    [[nodiscard]] auto printable(ErrorText message = ErrorText::literal("must be printable ASCII")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::printable(std::move(message)));
+    }
+
+    Validator &printable(ErrorText message = ErrorText::literal("must be printable ASCII")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::printable(std::move(message))));
+    }
+
+    [[nodiscard]] auto alnum(ErrorText message = ErrorText::literal("must be alphanumeric")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::alnum(std::move(message)));
+    }
+
+    Validator &alnum(ErrorText message = ErrorText::literal("must be alphanumeric")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::alnum(std::move(message))));
+    }
+
+    [[nodiscard]] auto hex(ErrorText message = ErrorText::literal("must be hexadecimal")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::hex(std::move(message)));
+    }
+
+    Validator &hex(ErrorText message = ErrorText::literal("must be hexadecimal")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::hex(std::move(message))));
+    }
+
+    [[nodiscard]] auto base64(ErrorText message = ErrorText::literal("invalid base64")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::base64(std::move(message)));
+    }
+
+    Validator &base64(ErrorText message = ErrorText::literal("invalid base64")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::base64(std::move(message))));
+    }
+
+    [[nodiscard]] auto base64url(ErrorText message = ErrorText::literal("invalid base64url")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::base64url(std::move(message)));
     }
 
-    [[nodiscard]] ValidationResult result() const
+    Validator &base64url(ErrorText message = ErrorText::literal("invalid base64url")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
     {
-      return apply_rules<T>(field_, value_, rules_);
+      return rule(Rule<T>(rules::base64url(std::move(message))));
     }
 
-    void result_into(ValidationErrors &out) const
+    [[nodiscard]] auto slug(ErrorText message = ErrorText::literal("invalid slug")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
     {
-      apply_rules_into<T>(field_, value_, rules_, out);
+      return std::move(*this).rule(rules::slug(std::move(message)));
+    }
+
+    Validator &slug(ErrorText message = ErrorText::literal("invalid slug")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::slug(std::move(message))));
+    }
+
+    /**
+     * @brief Match a regular expression, compiled by this call.
+     *
+     * A Validator is usually rebuilt for every value (Schema::field
+     * lambdas), so this overload compiles `source` each time. On hot paths,
+     * compile a Pattern once and use pattern(const Pattern&).
+     */
+    [[nodiscard]] auto pattern(std::string_view source, ErrorText message = ErrorText::literal("invalid format")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::pattern(source, std::move(message)));
+    }
+
+    Validator &pattern(std::string_view source, ErrorText message = ErrorText::literal("invalid format")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::pattern(source, std::move(message))));
+    }
+
+    /// @brief Match an already compiled Pattern (shares it, no compilation).
+    [[nodiscard]] auto pattern(const Pattern &compiled, ErrorText message = ErrorText::literal("invalid format")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::pattern(compiled, std::move(message)));
+    }
+
+    Validator &pattern(const Pattern &compiled, ErrorText message = ErrorText::literal("invalid format")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::pattern(compiled, std::move(message))));
+    }
+
+    [[nodiscard]] auto utf8_valid(ErrorText message = ErrorText::literal("invalid UTF-8")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::utf8_valid(std::move(message)));
+    }
+
+    Validator &utf8_valid(ErrorText message = ErrorText::literal("invalid UTF-8")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::utf8_valid(std::move(message))));
+    }
+
+    [[nodiscard]] auto utf8_length_min(std::size_t n, ErrorText message = ErrorText::literal("length is below minimum")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::utf8_length_min(n, std::move(message)));
+    }
+
+    Validator &utf8_length_min(std::size_t n, ErrorText message = ErrorText::literal("length is below minimum")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::utf8_length_min(n, std::move(message))));
+    }
+
+    [[nodiscard]] auto utf8_length_max(std::size_t n, ErrorText message = ErrorText::literal("length is above maximum")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::utf8_length_max(n, std::move(message)));
+    }
+
+    Validator &utf8_length_max(std::size_t n, ErrorText message = ErrorText::literal("length is above maximum")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::utf8_length_max(n, std::move(message))));
+    }
+
+    [[nodiscard]] auto utf8_length_between(std::size_t min_length, std::size_t max_length, ErrorText message = ErrorText::literal("length is out of range")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::utf8_length_between(min_length, max_length, std::move(message)));
+    }
+
+    Validator &utf8_length_between(std::size_t min_length, std::size_t max_length, ErrorText message = ErrorText::literal("length is out of range")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::utf8_length_between(min_length, max_length, std::move(message))));
+    }
+
+    [[nodiscard]] auto email(ErrorText message = ErrorText::literal("invalid email format")) &&
+      requires std::is_same_v<T, std::string>
+    {
+      return std::move(*this).rule(rules::email(std::move(message)));
+    }
+
+    Validator &email(ErrorText message = ErrorText::literal("invalid email format")) &
+      requires std::is_same_v<T, std::string>
+    {
+      return rule(Rule<T>(rules::email(std::move(message))));
+    }
+
+    [[nodiscard]] auto email(EmailMode mode, ErrorText message = ErrorText::literal("invalid email format")) &&
+      requires std::is_same_v<T, std::string>
+    {
+      return std::move(*this).rule(rules::email(mode, std::move(message)));
+    }
+
+    Validator &email(EmailMode mode, ErrorText message = ErrorText::literal("invalid email format")) &
+      requires std::is_same_v<T, std::string>
+    {
+      return rule(Rule<T>(rules::email(mode, std::move(message))));
+    }
+
+    [[nodiscard]] auto in_set(std::vector<std::string> allowed, ErrorText message = ErrorText::literal("value is not allowed")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::in_set(std::move(allowed), std::move(message)));
+    }
+
+    Validator &in_set(std::vector<std::string> allowed, ErrorText message = ErrorText::literal("value is not allowed")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::in_set(std::move(allowed), std::move(message))));
+    }
+
+    template <FixedString... Values>
+    [[nodiscard]] auto in_set_ct(ErrorText message = ErrorText::literal("value is not allowed")) &&
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return std::move(*this).rule(rules::in_set_ct<Values...>(std::move(message)));
+    }
+
+    template <FixedString... Values>
+    Validator &in_set_ct(ErrorText message = ErrorText::literal("value is not allowed")) &
+      requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+    {
+      return rule(Rule<T>(rules::in_set_ct<Values...>(std::move(message))));
+    }
+
+    /**
+     * @brief Execute the rules and return a standalone ValidationResult.
+     *
+     * @param policy AllErrors (default) runs every rule; any other policy
+     *               stops at the first failing rule.
+     */
+    [[nodiscard]] ValidationResult result(ValidationPolicy policy = ValidationPolicy::AllErrors) const
+    {
+      ValidationErrors out;
+      result_into(out, policy);
+      return ValidationResult{std::move(out)};
+    }
+
+    /**
+     * @brief Execute the rules and append errors into an existing container.
+     */
+    void result_into(ValidationErrors &out, ValidationPolicy policy = ValidationPolicy::AllErrors) const
+    {
+      const std::size_t before = out.size();
+      const auto go_on = [&]
+      { return !detail::policy_stops_field(policy, out.size() - before) && !out.full(); };
+
+      if (rules_.empty())
+      {
+        std::apply(
+            [&](const Rules &...rule)
+            {
+              (void)((rule(field_, value_, out), go_on()) && ...);
+            },
+            inline_);
+        return;
+      }
+
+      if constexpr (sizeof...(Rules) == 0)
+      {
+        apply_rules_into<T>(field_, value_, rules_, out, policy);
+      }
+      else
+      {
+        // Mixed builder: run each erased rule right before the chained
+        // rule that was added after it.
+        std::size_t next = 0;
+        const auto run_erased = [&](std::size_t slot)
+        {
+          for (; next < rules_.size() && slot_of(next) <= slot; ++next)
+          {
+            if (rules_[next])
+            {
+              rules_[next](field_, value_, out);
+              if (!go_on())
+              {
+                return false;
+              }
+            }
+          }
+          return true;
+        };
+
+        std::apply(
+            [&](const Rules &...rule)
+            {
+              std::size_t slot = 0;
+              (void)((run_erased(slot++) && (rule(field_, value_, out), go_on())) && ...);
+            },
+            inline_);
+
+        if (go_on())
+        {
+          (void)run_erased(sizeof...(Rules));
+        }
+      }
+    }
+
+    /**
+     * @brief Execute the rules and stream errors into any ErrorSink.
+     */
+    template <ErrorSink S>
+      requires(!std::is_same_v<S, ValidationErrors>)
+    void result_into(S &sink, ValidationPolicy policy = ValidationPolicy::AllErrors) const
+    {
+      ValidationErrors stream{ErrorSinkRef(sink)};
+      result_into(stream, policy);
+    }
+
+    /**
+     * @brief Evaluate the rules as a predicate, without building errors.
+     */
+    [[nodiscard]] bool is_valid() const
+    {
+      const bool inline_ok = std::apply(
+          [&](const Rules &...rule)
+          {
+            return (detail::test_rule(rule, value_) && ...);
+          },
+          inline_);
+
+      return inline_ok && test_rules<T>(value_, rules_);
     }
 
   private:
+    Validator(std::string_view field,
+              const T &value,
+              std::tuple<Rules...> &&inline_rules,
+              std::vector<Rule<T>> &&rules,
+              std::vector<std::size_t> &&slots)
+        : field_(field),
+          value_(value),
+          inline_(std::move(inline_rules)),
+          rules_(std::move(rules)),
+          slots_(std::move(slots))
+    {
+    }
+
+    /// @brief Number of chained rules added before rules_[i].
+    [[nodiscard]] std::size_t slot_of(std::size_t i) const noexcept
+    {
+      return i < slots_.size() ? slots_[i] : 0;
+    }
+
     std::string_view field_;
     const T &value_;
+    std::tuple<Rules...> inline_;
     std::vector<Rule<T>> rules_;
+    std::vector<std::size_t> slots_; ///< empty while no rule is chained
   };
 
   /**
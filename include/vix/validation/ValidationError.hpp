@@ -15,10 +15,18 @@
 #ifndef VIX_VALIDATION_VALIDATION_ERROR_HPP
 #define VIX_VALIDATION_VALIDATION_ERROR_HPP
 
+#if defined(VIX_VALIDATION_TRACK_ERROR_COPIES)
+#include <atomic>
+#include <cstddef>
+#endif
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <cstdint>
+#include <utility>
+
+#include <vix/validation/ErrorMeta.hpp>
+#include <vix/validation/ErrorText.hpp>
 
 namespace vix::validation
 {
@@ -42,32 +50,54 @@ namespace vix::validation
     Custom
   };
 
+#if defined(VIX_VALIDATION_TRACK_ERROR_COPIES)
+  namespace detail
+  {
+    /**
+     * @brief Number of ValidationError copies (construction or assignment).
+     *
+     * Only available when VIX_VALIDATION_TRACK_ERROR_COPIES is defined;
+     * tests use it to catch accidental deep copies on hot paths.
+     */
+    inline std::atomic<std::size_t> &error_copy_count() noexcept
+    {
+      static std::atomic<std::size_t> count{0};
+      return count;
+    }
+  } // namespace detail
+#endif
+
   /**
    * @brief Single validation error.
    *
    * Represents a semantic, user-facing validation failure.
    * Typically used for HTTP 400 responses, form errors, or API diagnostics.
+   *
+   * The record is compact: `field` and `message` are ErrorText (borrowed
+   * literals or shared reference-counted text) and `meta` keeps up to
+   * three entries inline, so errors from built-in rules are cheap to
+   * create and to copy.
    */
   struct ValidationError
   {
     /// Field name (e.g. "email", "age")
-    std::string field;
+    ErrorText field;
 
     /// Semantic error code
     ValidationErrorCode code{ValidationErrorCode::Custom};
 
     /// Human-readable message (not localized yet)
-    std::string message;
+    ErrorText message;
 
     /// Optional metadata (min, max, expected values, etc.)
-    std::unordered_map<std::string, std::string> meta;
+    ErrorMeta meta;
 
     ValidationError() = default;
 
     ValidationError(
-        std::string f,
+        ErrorText f,
         ValidationErrorCode c,
-        std::string msg)
+        ErrorText msg)
         : field(std::move(f)),
           code(c),
           message(std::move(msg))
@@ -75,16 +105,52 @@ namespace vix::validation
     }
 
     ValidationError(
-        std::string f,
+        ErrorText f,
         ValidationErrorCode c,
-        std::string msg,
-        std::unordered_map<std::string, std::string> m)
+        ErrorText msg,
+        ErrorMeta m)
         : field(std::move(f)),
           code(c),
           message(std::move(msg)),
           meta(std::move(m))
     {
     }
+
+    ValidationError(
+        ErrorText f,
+        ValidationErrorCode c,
+        ErrorText msg,
+        const std::unordered_map<std::string, std::string> &m)
+        : field(std::move(f)),
+          code(c),
+          message(std::move(msg)),
+          meta(ErrorMeta::from_map(m))
+    {
+    }
+
+#if defined(VIX_VALIDATION_TRACK_ERROR_COPIES)
+    ValidationError(const ValidationError &other)
+        : field(other.field),
+          code(other.code),
+          message(other.message),
+          meta(other.meta)
+    {
+      detail::error_copy_count().fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ValidationError &operator=(const ValidationError &other)
+    {
+      field = other.field;
+      code = other.code;
+      message = other.message;
+      meta = other.meta;
+      detail::error_copy_count().fetch_add(1, std::memory_order_relaxed);
+      return *this;
+    }
+
+    ValidationError(ValidationError &&) noexcept = default;
+    ValidationError &operator=(ValidationError &&) noexcept = default;
+#endif
   };
 
   /**
@@ -16,11 +16,13 @@
 #define VIX_VALIDATION_VALIDATION_ERRORS_HPP
 
 #include <cstddef>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <vix/validation/ErrorSink.hpp>
 #include <vix/validation/ValidationError.hpp>
 
 namespace vix::validation
@@ -34,6 +36,12 @@ namespace vix::validation
    * - HTTP 400 responses
    * - forms and client validation feedback
    * - logging and diagnostics
+   *
+   * A ValidationErrors can also be a streaming front-end for any ErrorSink:
+   * constructed from an ErrorSinkRef, it forwards every added error to the
+   * sink instead of storing it. Rules, Validator and Schema write through
+   * it unchanged; `size()` then counts forwarded errors and `all()` stays
+   * empty.
    */
   class ValidationErrors
   {
@@ -44,12 +52,24 @@ namespace vix::validation
 
     ValidationErrors() = default;
 
+    /// @brief Streaming mode: forward errors to `sink` instead of storing them.
+    explicit ValidationErrors(ErrorSinkRef sink) noexcept
+        : sink_(sink)
+    {
+    }
+
     // Observers
-    [[nodiscard]] bool empty() const noexcept { return errors_.empty(); }
-    [[nodiscard]] std::size_t size() const noexcept { return errors_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] std::size_t size() const noexcept { return errors_.size() + streamed_; }
 
     /// @brief True if there are no errors.
-    [[nodiscard]] bool ok() const noexcept { return errors_.empty(); }
+    [[nodiscard]] bool ok() const noexcept { return empty(); }
+
+    /// @brief True if errors are forwarded to a sink.
+    [[nodiscard]] bool is_streaming() const noexcept { return sink_.has_value(); }
+
+    /// @brief True if the sink asked to stop receiving errors.
+    [[nodiscard]] bool full() const noexcept { return sink_ && sink_->full(); }
 
     [[nodiscard]] const container_type &all() const noexcept { return errors_; }
     [[nodiscard]] container_type &all_mut() noexcept { return errors_; }
@@ -63,24 +83,55 @@ namespace vix::validation
     // Modifiers
     void add(ValidationError error)
     {
+      if (sink_)
+      {
+        forward(std::move(error));
+        return;
+      }
       errors_.push_back(std::move(error));
     }
 
-    void add(std::string field, ValidationErrorCode code, std::string message)
+    void add(ErrorText field, ValidationErrorCode code, ErrorText message)
     {
+      if (sink_)
+      {
+        forward(ValidationError(std::move(field), code, std::move(message)));
+        return;
+      }
       errors_.emplace_back(std::move(field), code, std::move(message));
     }
 
-    void add(std::string field,
+    void add(ErrorText field,
              ValidationErrorCode code,
-             std::string message,
-             std::unordered_map<std::string, std::string> meta)
+             ErrorText message,
+             ErrorMeta meta)
     {
+      if (sink_)
+      {
+        forward(ValidationError(std::move(field), code, std::move(message), std::move(meta)));
+        return;
+      }
       errors_.emplace_back(std::move(field), code, std::move(message), std::move(meta));
     }
 
+    void add(ErrorText field,
+             ValidationErrorCode code,
+             ErrorText message,
+             const std::unordered_map<std::string, std::string> &meta)
+    {
+      add(ValidationError(std::move(field), code, std::move(message), meta));
+    }
+
     void merge(const ValidationErrors &other)
     {
+      if (sink_)
+      {
+        for (const ValidationError &e : other.errors_)
+        {
+          forward(ValidationError(e));
+        }
+        return;
+      }
       errors_.insert(errors_.end(), other.errors_.begin(), other.errors_.end());
     }
 
@@ -91,15 +142,29 @@ namespace vix::validation
         return;
       }
 
-      errors_.insert(
-          errors_.end(),
-          std::make_move_iterator(other.errors_.begin()),
-          std::make_move_iterator(other.errors_.end()));
+      if (sink_)
+      {
+        for (ValidationError &e : other.errors_)
+        {
+          forward(std::move(e));
+        }
+      }
+      else
+      {
+        errors_.insert(
+            errors_.end(),
+            std::make_move_iterator(other.errors_.begin()),
+            std::make_move_iterator(other.errors_.end()));
+      }
 
       other.errors_.clear();
     }
 
-    void clear() noexcept { errors_.clear(); }
+    void clear() noexcept
+    {
+      errors_.clear();
+      streamed_ = 0;
+    }
 
     // Iteration
     iterator begin() noexcept { return errors_.begin(); }
@@ -112,7 +177,15 @@ namespace vix::validation
     const_iterator cend() const noexcept { return errors_.cend(); }
 
   private:
+    void forward(ValidationError &&error)
+    {
+      sink_->add(std::move(error));
+      ++streamed_;
+    }
+
     container_type errors_;
+    std::optional<ErrorSinkRef> sink_;
+    std::size_t streamed_{0};
   };
 
 } // namespace vix::validation
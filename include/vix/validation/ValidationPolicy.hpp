@@ -0,0 +1,78 @@
+/**
+ *
+ *  @file ValidationPolicy.hpp
+ *  @author Gaspard Kirira
+ *
+ *  Copyright 2025, Gaspard Kirira.
+ *  All rights reserved.
+ *  https://github.com/vixcpp/vix
+ *
+ *  Use of this source code is governed by a MIT license
+ *  that can be found in the License file.
+ *
+ *  Vix.cpp
+ */
+#ifndef VIX_VALIDATION_VALIDATION_POLICY_HPP
+#define VIX_VALIDATION_VALIDATION_POLICY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace vix::validation
+{
+
+  /**
+   * @brief How much work a validation run is allowed to do once errors appear.
+   *
+   * - AllErrors:          run every rule and every check, collect everything
+   * - FirstErrorPerField: stop a field at its first error, across every
+   *                       schema entry registered under its name
+   * - FailFast:           stop the whole run at the first error
+   *
+   * The cheaper policies are meant for hostile or high-volume traffic where
+   * a yes/no answer (or one message per field) is all the caller needs.
+   */
+  enum class ValidationPolicy : std::uint8_t
+  {
+    AllErrors = 0,
+    FirstErrorPerField,
+    FailFast
+  };
+
+  /**
+   * @brief Convert ValidationPolicy to a stable string identifier.
+   */
+  [[nodiscard]] inline std::string_view
+  to_string(ValidationPolicy policy) noexcept
+  {
+    switch (policy)
+    {
+    case ValidationPolicy::AllErrors:
+      return "all_errors";
+    case ValidationPolicy::FirstErrorPerField:
+      return "first_error_per_field";
+    case ValidationPolicy::FailFast:
+      return "fail_fast";
+    default:
+      return "unknown";
+    }
+  }
+
+  namespace detail
+  {
+    /**
+     * @brief True when a rule list must stop after `added` new errors.
+     *
+     * Both FirstErrorPerField and FailFast stop a field at its first error;
+     * FailFast additionally stops the enclosing schema (handled by Schema).
+     */
+    [[nodiscard]] constexpr bool policy_stops_field(ValidationPolicy policy, std::size_t added) noexcept
+    {
+      return policy != ValidationPolicy::AllErrors && added != 0;
+    }
+  } // namespace detail
+
+} // namespace vix::validation
+
+#endif // VIX_VALIDATION_VALIDATION_POLICY_HPP
@@ -78,18 +78,18 @@ namespace vix::validation
     }
 
     void add(
-        std::string field,
+        ErrorText field,
         ValidationErrorCode code,
-        std::string message)
+        ErrorText message)
     {
       errors.add(std::move(field), code, std::move(message));
     }
 
     void add(
-        std::string field,
+        ErrorText field,
         ValidationErrorCode code,
-        std::string message,
-        std::unordered_map<std::string, std::string> meta)
+        ErrorText message,
+        ErrorMeta meta)
     {
       errors.add(
           std::move(field),
@@ -98,6 +98,15 @@ namespace vix::validation
           std::move(meta));
     }
 
+    void add(
+        ErrorText field,
+        ValidationErrorCode code,
+        ErrorText message,
+        const std::unordered_map<std::string, std::string> &meta)
+    {
+      errors.add(std::move(field), code, std::move(message), meta);
+    }
+
     void clear() noexcept
     {
       errors.clear();
@@ -25,14 +25,33 @@
 #define VIX_VALIDATION_VALIDATION_HPP
 
 #include <vix/validation/BaseModel.hpp>
+#include <vix/validation/CharSet.hpp>
+#include <vix/validation/Column.hpp>
+#include <vix/validation/ErrorMeta.hpp>
+#include <vix/validation/ErrorSink.hpp>
+#include <vix/validation/ErrorText.hpp>
 #include <vix/validation/Form.hpp>
+#include <vix/validation/Json.hpp>
+#include <vix/validation/JsonValue.hpp>
+#include <vix/validation/Kernels.hpp>
+#include <vix/validation/MetaValue.hpp>
+#include <vix/validation/Multipart.hpp>
+#include <vix/validation/Pattern.hpp>
 #include <vix/validation/Pipe.hpp>
 #include <vix/validation/Rule.hpp>
 #include <vix/validation/Rules.hpp>
 #include <vix/validation/Schema.hpp>
+#include <vix/validation/SchemaJson.hpp>
+#include <vix/validation/Simd.hpp>
+#include <vix/validation/StaticField.hpp>
+#include <vix/validation/StaticStringSet.hpp>
+#include <vix/validation/StringSet.hpp>
+#include <vix/validation/TextKernels.hpp>
+#include <vix/validation/UrlEncoded.hpp>
 #include <vix/validation/Validate.hpp>
 #include <vix/validation/ValidationError.hpp>
 #include <vix/validation/ValidationErrors.hpp>
+#include <vix/validation/ValidationPolicy.hpp>
 #include <vix/validation/ValidationResult.hpp>
 
 #endif // VIX_VALIDATION_VALIDATION_HPP
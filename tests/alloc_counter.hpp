@@ -0,0 +1,46 @@
+#ifndef VIX_VALIDATION_TESTS_ALLOC_COUNTER_HPP
+#define VIX_VALIDATION_TESTS_ALLOC_COUNTER_HPP
+
+// ------------------------------------------------------------
+// Global allocation counter
+// ------------------------------------------------------------
+// Replaces the global operator new/delete of the executable, so it must
+// be included from exactly one translation unit (the test or benchmark
+// source that owns main()).
+// ------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC flags malloc/free inside replaced global new/delete once inlined.
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace
+{
+  std::size_t g_allocations = 0;
+
+  /// @brief Number of operator new calls made while running `fn()`.
+  template <typename Fn>
+  std::size_t allocations_during(Fn &&fn)
+  {
+    const std::size_t before = g_allocations;
+    fn();
+    return g_allocations - before;
+  }
+} // namespace
+
+void *operator new(std::size_t n)
+{
+  ++g_allocations;
+  if (void *p = std::malloc(n ? n : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+#endif // VIX_VALIDATION_TESTS_ALLOC_COUNTER_HPP
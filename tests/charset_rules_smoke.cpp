@@ -0,0 +1,190 @@
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <vix/validation/CharSet.hpp>
+#include <vix/validation/Rules.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/TextKernels.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  std::size_t naive_find(std::string_view s, const CharSet &set)
+  {
+    for (std::size_t i = 0; i < s.size(); ++i)
+    {
+      if (!set.contains(static_cast<unsigned char>(s[i])))
+      {
+        return i;
+      }
+    }
+    return std::string_view::npos;
+  }
+
+  void check_nibbles(const CharSet &set)
+  {
+    if (!set.vectorizable())
+    {
+      return;
+    }
+    for (unsigned b = 0; b < 256; ++b)
+    {
+      [[maybe_unused]] const bool hit = (set.low_nibbles()[b & 15] & set.high_nibbles()[b >> 4]) != 0;
+      assert(hit == set.contains(static_cast<unsigned char>(b)));
+    }
+  }
+
+  void check_find(std::string_view s, const CharSet &set)
+  {
+    [[maybe_unused]] const std::size_t want = naive_find(s, set);
+    for ([[maybe_unused]] SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2})
+    {
+      assert(kernels::charset_find(s, set, level) == want);
+    }
+  }
+} // namespace
+
+int main()
+{
+  // -------------------------
+  // nibble tables agree with the byte table
+  // -------------------------
+  {
+    static_assert(charsets::alnum.contains('z') && !charsets::alnum.contains('-'));
+    static_assert(charsets::hex.vectorizable() && charsets::base64.vectorizable());
+
+    for (const CharSet *set : {&charsets::ascii, &charsets::printable, &charsets::alnum, &charsets::hex,
+                               &charsets::base64, &charsets::base64url, &charsets::slug})
+    {
+      check_nibbles(*set);
+      check_nibbles(~*set);
+    }
+
+    std::mt19937 rng(7);
+    for (int round = 0; round < 200; ++round)
+    {
+      std::string members;
+      const unsigned limit = round % 2 ? 128u : 256u;
+      for (unsigned b = 0; b < limit; ++b)
+      {
+        if (rng() % 3 == 0)
+        {
+          members += static_cast<char>(b);
+        }
+      }
+      const CharSet set(members);
+      if (limit == 128)
+      {
+        assert(set.vectorizable());
+      }
+      check_nibbles(set);
+    }
+  }
+
+  // -------------------------
+  // charset_find: every level, every length, bad byte anywhere
+  // -------------------------
+  {
+    std::mt19937 rng(11);
+    const std::string_view alphabet = "0123456789abcdefABCDEF";
+    for (const CharSet *set : {&charsets::hex, &charsets::alnum, &charsets::printable})
+    {
+      for (std::size_t n = 0; n < 100; ++n)
+      {
+        std::string s;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          s += alphabet[rng() % alphabet.size()];
+        }
+        check_find(s, *set);
+        for (std::size_t bad = 0; bad < n; ++bad)
+        {
+          std::string t = s;
+          t[bad] = static_cast<char>(rng() % 2 ? '\x80' : '~');
+          t[(bad + n / 2) % n] = ' ';
+          check_find(t, *set);
+        }
+      }
+    }
+  }
+
+  // -------------------------
+  // rules and their reasons
+  // -------------------------
+  {
+    const std::string token = "9f86d081884c7d659a2feaa0c55ad015a3bf4f1b2b0b822cd15d6c15b0f00a08";
+    assert(validate("sha256", token).hex().length_min(64).result().ok());
+
+    auto bad_hex = validate("sha256", std::string("9f86d0g1")).hex().result();
+    assert(bad_hex.errors.size() == 1);
+    assert(bad_hex.errors.all()[0].code == ValidationErrorCode::Format);
+    assert(bad_hex.errors.all()[0].meta.at("offset").as_uint() == 6);
+
+    assert(rules::alnum().test("abcXYZ019"));
+    assert(!rules::alnum().test("abc_"));
+    assert(rules::printable().test("Bearer abc.def~"));
+    assert(!rules::printable().test("tab\there"));
+    assert(rules::ascii().test("plain"));
+    assert(!rules::ascii().test("caf\xC3\xA9"));
+    assert(rules::charset(CharSet("01")).test("0110"));
+
+    // base64
+    const auto b64 = rules::base64();
+    assert(b64.test(""));
+    assert(b64.test("TWFu"));
+    assert(b64.test("TWE="));
+    assert(b64.test("TQ=="));
+    assert(b64.test("a+/b"));
+    assert(!b64.test("TQ="));
+    assert(!b64.test("T==="));
+    assert(!b64.test("TWFuT"));
+    assert(!b64.test("a-_b"));
+    assert(!b64.test("TQ=a"));
+
+    ValidationErrors out;
+    b64("blob", "TW=u", out);
+    assert(out.all()[0].meta.at("reason") == "invalid_char");
+    assert(out.all()[0].meta.at("offset").as_uint() == 3);
+
+    // base64url
+    const auto b64u = rules::base64url();
+    assert(b64u.test("a-_b"));
+    assert(b64u.test("TQ"));
+    assert(b64u.test("TQ=="));
+    assert(!b64u.test("TQ="));
+    assert(!b64u.test("TWFuT"));
+    assert(!b64u.test("a+/b"));
+
+    // slug
+    const auto slug = rules::slug();
+    assert(slug.test("hello-world-2"));
+    assert(!slug.test("Hello"));
+    assert(!slug.test("-hello"));
+    assert(!slug.test("hello-"));
+
+    out.clear();
+    slug("slug", "hello--world", out);
+    assert(out.all()[0].meta.at("reason") == "hyphen");
+    assert(out.all()[0].meta.at("offset").as_uint() == 5);
+
+    struct Request
+    {
+      std::string api_key;
+      std::string_view path;
+    };
+    const auto s = schema<Request>()
+                       .field("api_key", &Request::api_key, field<std::string>().base64url().length_min(16))
+                       .field("path", &Request::path, field<std::string_view>().slug());
+    assert(s.validate(Request{"dGhpcy1pcy1hLWtleQ", "my-post"}).ok());
+    assert(s.validate(Request{"dGhpcy1pcy1hLWtleQ!", "My Post"}).errors.size() == 2);
+  }
+
+  std::cout << "charset_rules_smoke: OK\n";
+  return 0;
+}
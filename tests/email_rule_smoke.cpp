@@ -0,0 +1,140 @@
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <vix/validation/Rules.hpp>
+#include <vix/validation/TextKernels.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  // The original multi-scan implementation, kept as the reference.
+  const char *reference_reason(std::string_view value)
+  {
+    if (value.empty())
+      return "empty";
+    if (value.find(' ') != std::string_view::npos)
+      return "space";
+    const auto at = value.find('@');
+    if (at == std::string_view::npos || at == 0)
+      return "missing_at";
+    if (value.find('@', at + 1) != std::string_view::npos)
+      return "multiple_at";
+    const auto dot = value.find('.', at + 1);
+    if (dot == std::string_view::npos || dot == at + 1 || dot == value.size() - 1)
+      return "missing_dot";
+    return nullptr;
+  }
+
+  [[maybe_unused]] bool same(const char *a, const char *b)
+  {
+    return (a == nullptr && b == nullptr) || (a && b && std::strcmp(a, b) == 0);
+  }
+
+  [[maybe_unused]] const char *strict(std::string_view v)
+  {
+    return rules::detail::email_strict_reason(v);
+  }
+} // namespace
+
+int main()
+{
+  // Basic mode: same reasons as the multi-scan version, on every SIMD path.
+  {
+    std::mt19937 rng(1234);
+    const char alphabet[] = "ab.@ -x";
+    std::uniform_int_distribution<std::size_t> pick(0, sizeof(alphabet) - 2);
+    std::uniform_int_distribution<std::size_t> length(0, 90);
+    std::uniform_int_distribution<int> rare(0, 9);
+
+    for (int n = 0; n < 20000; ++n)
+    {
+      std::string s(length(rng), 'a');
+      for (auto &c : s)
+      {
+        // Mostly letters so that '@' / '.' / ' ' land at varied offsets.
+        c = rare(rng) < 8 ? 'a' : alphabet[pick(rng)];
+      }
+
+      [[maybe_unused]] const char *expected = reference_reason(s);
+      assert(same(rules::detail::email_reason(s), expected));
+
+      for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2})
+      {
+        const auto scan = kernels::email_scan(s, level);
+        [[maybe_unused]] const auto ref = kernels::email_scan(s, SimdLevel::Scalar);
+        assert(scan.space == ref.space);
+        if (!scan.space)
+        {
+          assert(scan.at == ref.at);
+          assert(scan.multiple_at == ref.multiple_at);
+          assert(scan.dot == ref.dot);
+        }
+      }
+    }
+  }
+
+  // '@' and '.' around vector boundaries.
+  for (std::size_t pad = 0; pad < 70; ++pad)
+  {
+    const std::string local(pad + 1, 'u');
+    assert(rules::detail::email_reason(local + "@example.com") == nullptr);
+    assert(same(rules::detail::email_reason(local + "@.com"), "missing_dot"));
+    assert(same(rules::detail::email_reason(local + "@example.com@x"), "multiple_at"));
+    assert(same(rules::detail::email_reason(local + ".x@examplecom"), "missing_dot"));
+    assert(same(rules::detail::email_reason(local + "@example.com "), "space"));
+  }
+
+  // Long adversarial input: still rejected, in one pass.
+  {
+    std::string big(1 << 20, '@');
+    assert(same(rules::detail::email_reason(big), "missing_at"));
+    big[0] = 'a';
+    assert(same(rules::detail::email_reason(big), "multiple_at"));
+  }
+
+  // Strict mode.
+  {
+    assert(strict("john.doe+tag@mail.example.com") == nullptr);
+    assert(strict("o'brien@example.co.uk") == nullptr);
+    assert(same(strict(""), "empty"));
+    assert(same(strict("a b@example.com"), "space"));
+    assert(same(strict("a@b@example.com"), "multiple_at"));
+    assert(same(strict("a@example"), "missing_dot"));
+    assert(same(strict("a(b)@example.com"), "local_char"));
+    assert(same(strict(".a@example.com"), "local_dot"));
+    assert(same(strict("a.@example.com"), "local_dot"));
+    assert(same(strict("a..b@example.com"), "local_dot"));
+    assert(same(strict("a@exa_mple.com"), "domain_char"));
+    assert(same(strict("a@-example.com"), "domain_label"));
+    assert(same(strict("a@example-.com"), "domain_label"));
+    assert(same(strict("a@example..com"), "domain_label"));
+    assert(same(strict("a@example.com."), "domain_label"));
+    assert(same(strict("a@example.com-"), "domain_label"));
+    assert(same(strict(std::string(65, 'a') + "@example.com"), "local_length"));
+    assert(same(strict("a@" + std::string(64, 'b') + ".com"), "domain_label"));
+    assert(same(strict("a@" + std::string(250, 'b') + ".com"), "too_long"));
+
+    // Basic mode accepts what strict mode rejects on character classes.
+    assert(rules::detail::email_reason("a(b)@example.com") == nullptr);
+  }
+
+  // Through the rule object and the builders.
+  {
+    const auto r = validate("email", std::string("a..b@example.com")).email(EmailMode::Strict).result();
+    assert(!r.ok());
+    assert(r.errors[0].meta.at("reason") == "local_dot");
+
+    assert(validate("email", std::string("a..b@example.com")).email().result().ok());
+    assert(rules::email(EmailMode::Strict).test("ok@example.com"));
+  }
+
+  std::cout << "email_rule_smoke: OK\n";
+  return 0;
+}
@@ -0,0 +1,138 @@
+#define VIX_VALIDATION_TRACK_ERROR_COPIES 1
+
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <vix/validation/Form.hpp>
+#include <vix/validation/Pipe.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+
+struct Signup
+{
+  std::string email;
+  std::string password;
+  std::string age;
+  std::string zip;
+
+  static bool set(Signup &out, std::string_view key, std::string_view value)
+  {
+    if (key == "email")
+      out.email.assign(value);
+    else if (key == "password")
+      out.password.assign(value);
+    else if (key == "age")
+      out.age.assign(value);
+    else if (key == "zip")
+      out.zip.assign(value);
+    else
+      return false;
+    return true;
+  }
+
+  static Schema<Signup> schema()
+  {
+    return vix::validation::schema<Signup>()
+        // Callable returning a Validator builder
+        .field("email", &Signup::email,
+               [](std::string_view f, const std::string &v)
+               {
+                 return validate(f, v).required().email();
+               })
+        // Callable returning a ValidationResult
+        .field("password", &Signup::password,
+               [](std::string_view f, const std::string &v)
+               {
+                 return validate(f, v).required().length_min(8).result();
+               })
+        // Parsed callable returning a ParsedValidator builder
+        .parsed<int>("age", &Signup::age,
+                     [](std::string_view f, std::string_view in)
+                     {
+                       return validate_parsed<int>(f, in).between(18, 120);
+                     })
+        // Parsed callable returning a ValidationResult
+        .parsed<int>("zip", &Signup::zip,
+                     [](std::string_view f, std::string_view in)
+                     {
+                       return validate_parsed<int>(f, in).min(1000).result();
+                     })
+        // Object check returning a ValidationResult
+        .check([](const Signup &s)
+               {
+                 ValidationResult r;
+                 if (s.password == s.email)
+                   r.add("password", ValidationErrorCode::Custom, "password equals email");
+                 return r; });
+  }
+};
+
+struct SignupForm
+{
+  Signup data;
+
+  static bool set(SignupForm &out, std::string_view key, std::string_view value)
+  {
+    return Signup::set(out.data, key, value);
+  }
+
+  static Schema<SignupForm> schema()
+  {
+    return vix::validation::schema<SignupForm>()
+        .check([](const SignupForm &f)
+               { return Signup::schema().validate(f.data); });
+  }
+};
+
+static std::size_t copies() { return detail::error_copy_count().load(); }
+
+int main()
+{
+  const auto s = Signup::schema();
+  const Signup bad{"", "", "10", "12"};
+
+  for (ValidationPolicy policy : {ValidationPolicy::AllErrors,
+                                  ValidationPolicy::FirstErrorPerField,
+                                  ValidationPolicy::FailFast})
+  {
+    [[maybe_unused]] const std::size_t before = copies();
+    const ValidationResult r = s.validate(bad, policy);
+    assert(!r.ok());
+    assert(copies() == before);
+  }
+
+  {
+    [[maybe_unused]] const std::size_t before = copies();
+    const ValidationResult r = s.validate(bad);
+    assert(r.errors.size() == 7);
+    assert(copies() == before);
+  }
+
+  {
+    using Input = std::vector<std::pair<std::string_view, std::string_view>>;
+    const Input in{{"email", "nope"}, {"password", "nope"}, {"age", "7"}, {"zip", "1"}};
+
+    [[maybe_unused]] const std::size_t before = copies();
+    auto res = Form<SignupForm>::validate(in);
+    assert(!res);
+    assert(res.errors().size() == 5);
+    assert(copies() == before);
+  }
+
+  // The counter itself works.
+  {
+    const ValidationError e{"x", ValidationErrorCode::Custom, "m"};
+    [[maybe_unused]] const std::size_t before = copies();
+    const ValidationError copy = e;
+    assert(copies() == before + 1);
+    (void)copy;
+  }
+
+  std::cout << "[validation] error copy tests passed\n";
+  return 0;
+}
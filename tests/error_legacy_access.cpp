@@ -0,0 +1,79 @@
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <vix/validation/ValidationErrors.hpp>
+
+using namespace vix::validation;
+
+// Error fields used to be std::string; code written against that API must
+// keep compiling and behave the same.
+
+static std::size_t length_of(const std::string &s)
+{
+  return s.size();
+}
+
+int main()
+{
+  ValidationErrors errs;
+  errs.add(ValidationError{"email", ValidationErrorCode::Format, "invalid email"});
+  const ValidationError &e = errs.all()[0];
+
+  {
+    std::string field = e.field;
+    assert(field == "email");
+
+    const std::string &message = e.message;
+    assert(message == "invalid email");
+
+    const std::size_t lengths = length_of(e.field) + length_of(e.message);
+    assert(lengths == 5 + 13);
+    (void)lengths;
+  }
+
+  {
+    std::string line;
+    line = e.field;
+    line += ": ";
+    line += e.message;
+    assert(line == "email: invalid email");
+  }
+
+  {
+    const bool same = e.field == std::string("email") && !e.message.empty();
+    assert(same);
+    (void)same;
+  }
+
+  // Meta used to be std::unordered_map<std::string, std::string>.
+  {
+    ValidationError err{"age", ValidationErrorCode::Min, "too small"};
+    err.meta["min"] = "18";
+    err.meta["got"] = 3;
+    err.meta["min"] = "21";
+    assert(err.meta.size() == 2);
+
+    const std::string min = err.meta.at("min");
+    assert(min == "21");
+
+    const auto [it, inserted] = err.meta.emplace("got", "ignored");
+    assert(!inserted && it->second == "3");
+    (void)it;
+    (void)inserted;
+
+    std::size_t total = 0;
+    for (const auto &[k, v] : err.meta)
+    {
+      const std::string key = k;
+      const std::string value = v;
+      total += key.size() + value.size();
+    }
+    assert(total == 3 + 2 + 3 + 1);
+    (void)total;
+  }
+
+  std::cout << "error_legacy_access: OK\n";
+  return 0;
+}
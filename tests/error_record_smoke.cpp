@@ -0,0 +1,131 @@
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+
+struct Item
+{
+  std::string sku;
+  int qty{0};
+};
+
+int main()
+{
+  // -------------------------
+  // ErrorText: borrowed literals, shared copies, string-like API
+  // -------------------------
+  {
+    const ErrorText lit = ErrorText::literal("hello");
+    assert(!lit.is_shared());
+    assert(lit == "hello");
+    assert(lit.size() == 5);
+
+    const std::string dynamic = "world";
+    const ErrorText owned(dynamic);
+    assert(owned.is_shared());
+    assert(owned == dynamic);
+    assert(owned.data() != dynamic.data());
+
+    const ErrorText copy = owned;
+    assert(copy.data() == owned.data());
+    assert(copy.str() == "world");
+
+    const ErrorText empty;
+    assert(empty.empty());
+    assert(empty == "");
+  }
+
+  // -------------------------
+  // Compact record
+  // -------------------------
+  static_assert(sizeof(ErrorText) == 16);
+  static_assert(sizeof(ValidationError) <= 160);
+
+  // -------------------------
+  // Built-in rules borrow messages and share schema field names
+  // -------------------------
+  {
+    const auto s = schema<Item>()
+                       .field("sku", &Item::sku, field<std::string>().required().length_min(3))
+                       .field("qty", &Item::qty, field<int>().min(1).max(10));
+
+    const auto r1 = s.validate(Item{"", 0});
+    const auto r2 = s.validate(Item{"", 50});
+    assert(r1.errors.size() == 3);
+    assert(r2.errors.size() == 3);
+
+    [[maybe_unused]] const ValidationError &a = r1.errors[0];
+    [[maybe_unused]] const ValidationError &b = r2.errors[0];
+    assert(a.field == "sku");
+    assert(a.field.data() == b.field.data());
+    assert(!a.message.is_shared());
+    assert(a.message == "field is required");
+
+    const ValidationError &q = r1.errors[2];
+    assert(q.code == ValidationErrorCode::Min);
+    assert(q.meta.size() == 2);
+    assert(q.meta.count("min") == 1);
+    assert(q.meta.at("min") == "1");
+    assert(q.meta.at("got") == "0");
+    assert(!q.meta.contains("max"));
+
+    const auto legacy = q.meta.to_map();
+    assert(legacy.size() == 2);
+    assert(legacy.at("got") == "0");
+  }
+
+  // -------------------------
+  // Custom messages are copied once per rule, then shared by every error
+  // -------------------------
+  {
+    auto spec = field<int>().min(18, std::string("too young"));
+    ValidationErrors out;
+    apply_rules_into<int>("age", 3, spec.rules(), out);
+    apply_rules_into<int>("age", 4, spec.rules(), out);
+    assert(out.size() == 2);
+    assert(out[0].message == "too young");
+    assert(out[0].message.data() == out[1].message.data());
+  }
+
+  // -------------------------
+  // Legacy construction paths and meta spill
+  // -------------------------
+  {
+    ValidationErrors out;
+    out.add({"email", ValidationErrorCode::Required, "email is required"});
+    out.add("age", ValidationErrorCode::Custom, "bad", {{"a", "1"}, {"b", "2"}});
+
+    ErrorMeta meta;
+    meta.set(ErrorText::literal("k1"), "1");
+    meta.set(ErrorText::literal("k2"), "2");
+    meta.set(ErrorText::literal("k3"), "3");
+    meta.set(ErrorText::literal("k4"), "4");
+    meta.set(ErrorText::literal("k2"), "two");
+    assert(meta.size() == 4);
+    out.add("misc", ValidationErrorCode::Custom, "many", meta);
+
+    assert(out[0].field == "email");
+    assert(out[1].meta.at("b") == "2");
+
+    const ErrorMeta copy = out[2].meta;
+    assert(copy.at("k2") == "two");
+    assert(copy.at("k4") == "4");
+
+    std::size_t n = 0;
+    for ([[maybe_unused]] const auto &kv : copy)
+    {
+      assert(!kv.first.empty());
+      ++n;
+    }
+    assert(n == 4);
+  }
+
+  std::cout << "OK\n";
+  return 0;
+}
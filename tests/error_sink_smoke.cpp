@@ -0,0 +1,140 @@
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <vix/validation/ErrorSink.hpp>
+#include <vix/validation/Pipe.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+
+struct Signup
+{
+  std::string email;
+  std::string password;
+  std::string age;
+
+  static Schema<Signup> schema()
+  {
+    return vix::validation::schema<Signup>()
+        .field("email", &Signup::email,
+               field<std::string>().required().email().length_min(5))
+        .field("password", &Signup::password,
+               [](std::string_view f, const std::string &v)
+               {
+                 return validate(f, v).required().length_min(8);
+               })
+        .parsed<int>("age", &Signup::age, parsed<int>().between(18, 120))
+        .check([](const Signup &s, ValidationErrors &errors)
+               {
+                 if (s.password == s.email)
+                 {
+                   errors.add("password", ValidationErrorCode::Custom, "password equals email");
+                   errors.add("email", ValidationErrorCode::Custom, "email equals password");
+                 } });
+  }
+};
+
+int main()
+{
+  const auto s = Signup::schema();
+  const Signup bad{"", "", "10"};
+
+  // -------------------------
+  // CountingSink matches the vector results under every policy
+  // -------------------------
+  for (ValidationPolicy policy : {ValidationPolicy::AllErrors,
+                                  ValidationPolicy::FirstErrorPerField,
+                                  ValidationPolicy::FailFast})
+  {
+    CountingSink counter;
+    s.validate_into(bad, counter, policy);
+    assert(counter.count == s.validate(bad, policy).errors.size());
+  }
+
+  // -------------------------
+  // FirstNSink stops the run early
+  // -------------------------
+  {
+    FirstNSink first(2);
+    s.validate_into(bad, first);
+    assert(first.full());
+    assert(first.errors().size() == 2);
+    assert(first.errors()[0].field == "email");
+    assert(first.errors()[0].code == ValidationErrorCode::Required);
+  }
+
+  // -------------------------
+  // FieldMaskSink
+  // -------------------------
+  {
+    FieldMaskSink mask{"email", "password", "age"};
+    s.validate_into(Signup{"a@b.co", "long-enough", "10"}, mask);
+    assert(mask.mask() == 0b100);
+    assert(mask.failed("age"));
+    assert(!mask.failed("email"));
+    assert(!mask.other());
+
+    FieldMaskSink partial{"email"};
+    s.validate_into(bad, partial);
+    assert(partial.mask() == 1);
+    assert(partial.other());
+  }
+
+  // -------------------------
+  // CallbackSink serializes straight into a buffer
+  // -------------------------
+  {
+    std::string body;
+    CallbackSink writer([&](const ValidationError &e)
+                        {
+                          if (!body.empty())
+                            body += ',';
+                          body += '"';
+                          body += e.field.view();
+                          body += "\":\"";
+                          body += to_string(e.code);
+                          body += '"'; });
+
+    s.validate_into(bad, writer, ValidationPolicy::FirstErrorPerField);
+    assert(body == R"("email":"required","password":"required","age":"between")");
+  }
+
+  // -------------------------
+  // Validator and ParsedValidator stream too
+  // -------------------------
+  {
+    CountingSink counter;
+    validate("name", std::string()).required().length_min(3).result_into(counter);
+    assert(counter.count == 2);
+
+    FirstNSink first(1);
+    [[maybe_unused]] const bool ok = validate_parsed<int>("age", "abc").between(1, 2).result_into(first);
+    assert(!ok);
+    assert(first.errors().size() == 1);
+    assert(first.errors()[0].meta.contains("conversion_code"));
+  }
+
+  // -------------------------
+  // ValidationErrors as a streaming front-end
+  // -------------------------
+  {
+    CountingSink counter;
+    ValidationErrors stream{ErrorSinkRef(counter)};
+    stream.add("x", ValidationErrorCode::Custom, "bad");
+
+    ValidationErrors stored;
+    stored.add("y", ValidationErrorCode::Custom, "bad");
+    stream.merge(stored);
+
+    assert(stream.is_streaming());
+    assert(stream.size() == 2);
+    assert(stream.all().empty());
+    assert(counter.count == 2);
+  }
+
+  std::cout << "[validation] error sink tests passed\n";
+  return 0;
+}
@@ -0,0 +1,168 @@
+#include <cassert>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/Form.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+using Input = std::vector<std::pair<std::string_view, std::string_view>>;
+
+namespace
+{
+  struct RegisterForm
+  {
+    std::string email;
+    std::string password;
+    std::optional<std::string> nickname;
+    std::string_view locale;
+
+    static FormFields<RegisterForm> fields()
+    {
+      return {{"email", &RegisterForm::email},
+              {"password", &RegisterForm::password},
+              {"nickname", &RegisterForm::nickname},
+              {"locale", &RegisterForm::locale}};
+    }
+
+    static Schema<RegisterForm> schema()
+    {
+      return vix::validation::schema<RegisterForm>()
+          .field("email", &RegisterForm::email, field<std::string>().required().email())
+          .field("password", &RegisterForm::password, field<std::string>().length_min(8));
+    }
+  };
+
+  struct LenientForm
+  {
+    std::string name;
+
+    static FormFields<LenientForm> fields()
+    {
+      return FormFields<LenientForm>{{"name", &LenientForm::name}}.ignore_unknown();
+    }
+
+    static Schema<LenientForm> schema()
+    {
+      return vix::validation::schema<LenientForm>()
+          .field("name", &LenientForm::name, field<std::string>().required());
+    }
+  };
+
+#define ONBOARDING_FIELDS(X) \
+  X(f00) X(f01) X(f02) X(f03) X(f04) X(f05) X(f06) X(f07) X(f08) X(f09) \
+  X(f10) X(f11) X(f12) X(f13) X(f14) X(f15) X(f16) X(f17) X(f18) X(f19) \
+  X(f20) X(f21) X(f22) X(f23) X(f24) X(f25) X(f26) X(f27) X(f28) X(f29) \
+  X(f30) X(f31) X(f32) X(f33) X(f34) X(f35) X(f36) X(f37) X(f38) X(f39) \
+  X(f40) X(f41) X(f42) X(f43) X(f44) X(f45) X(f46) X(f47) X(f48) X(f49) \
+  X(f50) X(f51) X(f52) X(f53) X(f54) X(f55) X(f56) X(f57) X(f58) X(f59)
+
+  struct OnboardingForm
+  {
+#define DECLARE(name) std::string name;
+    ONBOARDING_FIELDS(DECLARE)
+#undef DECLARE
+
+    static FormFields<OnboardingForm> fields()
+    {
+#define ENTRY(name) {#name, &OnboardingForm::name},
+      return {ONBOARDING_FIELDS(ENTRY)};
+#undef ENTRY
+    }
+
+    static Schema<OnboardingForm> schema()
+    {
+      return vix::validation::schema<OnboardingForm>()
+          .field("f59", &OnboardingForm::f59, field<std::string>().required());
+    }
+  };
+} // namespace
+
+int main()
+{
+  // -------------------------
+  // declarative binding through Form
+  // -------------------------
+  {
+    const Input in = {{"email", "ada@example.com"},
+                      {"password", "short"},
+                      {"password", "correct horse"},
+                      {"locale", "fr-FR"}};
+    auto r = Form<RegisterForm>::validate(in);
+    assert(r);
+    assert(r.value().email == "ada@example.com");
+    assert(r.value().password == "correct horse"); // last value wins
+    assert(!r.value().nickname.has_value());
+    assert(r.value().locale == "fr-FR");
+
+    auto bad = Form<RegisterForm>::validate_kv({{"email", "nope"}, {"nickname", ""}, {"password", "12345678"}});
+    assert(!bad);
+    assert(bad.errors().size() == 1);
+    assert(bad.errors().all()[0].field == "email");
+
+    auto unknown = Form<RegisterForm>::validate_kv({{"email", "ada@example.com"}, {"admin", "1"}});
+    assert(!unknown);
+    assert(unknown.errors().size() == 1);
+    assert(unknown.errors().all()[0].field == "__form__");
+    assert(!Form<RegisterForm>::is_valid(Input{{"admin", "1"}}));
+
+    auto lenient = Form<LenientForm>::validate_kv({{"csrf", "x"}, {"name", "Ada"}, {"submit", ""}});
+    assert(lenient && lenient.value().name == "Ada");
+  }
+
+  // -------------------------
+  // table construction
+  // -------------------------
+  {
+    const FormFields<RegisterForm> &fields = RegisterForm::fields();
+    assert(fields.size() == 4);
+    assert(fields.find("nickname") != nullptr);
+    assert(fields.find("nick") == nullptr);
+
+    [[maybe_unused]] bool threw = false;
+    try
+    {
+      FormFields<RegisterForm> dup{{"email", &RegisterForm::email}, {"email", &RegisterForm::password}};
+    }
+    catch (const std::invalid_argument &)
+    {
+      threw = true;
+    }
+    assert(threw);
+  }
+
+  // -------------------------
+  // 60-field form: every key lands in its own member
+  // -------------------------
+  {
+    std::vector<std::string> keys;
+#define KEY(name) keys.push_back(#name);
+    ONBOARDING_FIELDS(KEY)
+#undef KEY
+
+    std::vector<std::string> values;
+    Input in;
+    for (const std::string &k : keys)
+    {
+      values.push_back("value-of-" + k);
+    }
+    for (std::size_t i = keys.size(); i-- > 0;)
+    {
+      in.emplace_back(keys[i], values[i]);
+    }
+
+    auto r = Form<OnboardingForm>::validate(in);
+    assert(r);
+#define CHECK(name) assert(r.value().name == "value-of-" #name);
+    ONBOARDING_FIELDS(CHECK)
+#undef CHECK
+  }
+
+  std::cout << "form_fields_bind: OK\n";
+  return 0;
+}
@@ -0,0 +1,361 @@
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <vix/validation/Form.hpp>
+#include <vix/validation/Multipart.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  struct Part
+  {
+    std::string name;
+    std::string filename; // empty: text part
+    std::string type;
+    std::string body;
+  };
+
+  std::string build(const std::vector<Part> &parts, std::string_view boundary)
+  {
+    std::string out;
+    for (const Part &p : parts)
+    {
+      out += "--" + std::string(boundary) + "\r\n";
+      out += "Content-Disposition: form-data; name=\"" + p.name + "\"";
+      if (!p.filename.empty())
+      {
+        out += "; filename=\"" + p.filename + "\"";
+      }
+      out += "\r\n";
+      if (!p.type.empty())
+      {
+        out += "Content-Type: " + p.type + "\r\n";
+      }
+      out += "\r\n" + p.body + "\r\n";
+    }
+    out += "--" + std::string(boundary) + "--\r\n";
+    return out;
+  }
+
+  // Parts seen by the parser, file pieces concatenated.
+  struct Collector
+  {
+    std::vector<Part> parts;
+    bool open = false;
+
+    bool operator()(const MultipartPart &part, std::string_view bytes)
+    {
+      if (!open)
+      {
+        parts.push_back(Part{std::string(part.name), std::string(part.filename), std::string(part.content_type), {}});
+        open = part.file;
+      }
+      parts.back().body.append(bytes);
+      if (part.complete)
+      {
+        open = false;
+      }
+      return true;
+    }
+  };
+
+  std::vector<Part> parse_in_chunks([[maybe_unused]] std::string_view body, std::string_view boundary,
+                                    const std::vector<std::size_t> &cuts, MultipartLimits limits = {})
+  {
+    MultipartParser parser(boundary, std::move(limits));
+    Collector c;
+    [[maybe_unused]] std::size_t at = 0;
+    for (std::size_t cut : cuts)
+    {
+      assert(parser.feed(body.substr(at, cut - at), c));
+      at = cut;
+    }
+    assert(parser.feed(body.substr(at), c));
+    assert(parser.finish());
+    return c.parts;
+  }
+
+  void same(const std::vector<Part> &got, [[maybe_unused]] const std::vector<Part> &want)
+  {
+    assert(got.size() == want.size());
+    for (std::size_t i = 0; i < got.size(); ++i)
+    {
+      assert(got[i].name == want[i].name);
+      assert(got[i].filename == want[i].filename);
+      assert(got[i].type == want[i].type);
+      assert(got[i].body == want[i].body);
+    }
+  }
+
+  struct Fail
+  {
+    const char *reason;
+    std::size_t offset;
+    std::string part;
+    std::size_t failed_chunk;
+  };
+
+  Fail parse_failure(std::string_view body, std::string_view boundary, MultipartLimits limits, std::size_t chunk)
+  {
+    MultipartParser parser(boundary, std::move(limits));
+    Collector c;
+    std::size_t index = 0;
+    for (std::size_t at = 0; at < body.size(); at += chunk, ++index)
+    {
+      if (!parser.feed(body.substr(at, chunk), c))
+      {
+        assert(!parser.feed("more", c));
+        return Fail{parser.error(), parser.error_offset(), std::string(parser.error_part()), index};
+      }
+    }
+    assert(!parser.finish());
+    return Fail{parser.error(), parser.error_offset(), std::string(parser.error_part()), index};
+  }
+
+  struct UploadForm
+  {
+    std::string title;
+    std::string_view tag;
+    std::string avatar_name;
+    std::string avatar;
+
+    static FormFields<UploadForm> fields()
+    {
+      return {{"title", &UploadForm::title}, {"tag", &UploadForm::tag}};
+    }
+
+    static bool file(UploadForm &out, const MultipartPart &part, std::string_view bytes)
+    {
+      if (part.name != "avatar")
+      {
+        return false;
+      }
+      out.avatar_name = part.filename;
+      out.avatar.append(bytes);
+      return true;
+    }
+
+    static Schema<UploadForm> schema()
+    {
+      return vix::validation::schema<UploadForm>()
+          .field("title", &UploadForm::title, field<std::string>().required().length_max(20));
+    }
+  };
+} // namespace
+
+int main()
+{
+  const std::string boundary = "----vixBoundary7MA4YWxk";
+
+  // -------------------------
+  // every chunking gives the same parts
+  // -------------------------
+  {
+    std::string binary;
+    for (int i = 0; i < 600; ++i)
+    {
+      binary += static_cast<char>(i * 7);
+    }
+    binary += "\r\n--" + boundary.substr(0, 10) + "\r\n\r\n--" + boundary.substr(0, boundary.size() - 1) + "x"; // near misses
+    binary += "\r";
+
+    const std::vector<Part> parts = {
+        {"title", "", "", "Holiday photos"},
+        {"empty", "", "", ""},
+        {"avatar", "me.png", "image/png", binary},
+        {"note", "", "text/plain; charset=utf-8", "line one\r\nline two\r\n-- not a delimiter"},
+        {"blank", "", "", ""},
+    };
+    const std::string body = build(parts, boundary);
+
+    same(parse_in_chunks(body, boundary, {}), parts);
+    for (std::size_t step = 1; step <= 64; ++step)
+    {
+      std::vector<std::size_t> cuts;
+      for (std::size_t at = step; at < body.size(); at += step)
+      {
+        cuts.push_back(at);
+      }
+      same(parse_in_chunks(body, boundary, cuts), parts);
+    }
+
+    std::mt19937 rng(3);
+    for (int round = 0; round < 300; ++round)
+    {
+      std::vector<std::size_t> cuts;
+      for (std::size_t at = 0;;)
+      {
+        at += 1 + rng() % 90;
+        if (at >= body.size())
+        {
+          break;
+        }
+        cuts.push_back(at);
+      }
+      same(parse_in_chunks(body, boundary, cuts), parts);
+    }
+
+    // Every cut position right around each delimiter.
+    for (std::size_t at = 1; at < body.size(); ++at)
+    {
+      if (body.compare(at, 2, "\r\n") == 0 || body[at - 1] == '-')
+      {
+        same(parse_in_chunks(body, boundary, {at}), parts);
+      }
+    }
+
+    // Preamble, transport padding and epilogue.
+    std::string framed = "ignored preamble\r\n" + body;
+    framed.insert(framed.find("\r\n", framed.find(boundary)), " \t");
+    framed += "epilogue --" + boundary + "\r\n";
+    same(parse_in_chunks(framed, boundary, {5, 40}), parts);
+  }
+
+  // -------------------------
+  // text values are views of the chunk when not cut
+  // -------------------------
+  {
+    const std::string body = build({{"a", "", "", "first"}, {"b", "", "", "second"}}, boundary);
+    MultipartParser parser(boundary);
+    std::vector<std::string_view> values;
+    [[maybe_unused]] const auto sink = [&](const MultipartPart &, std::string_view v)
+    {
+      values.push_back(v);
+      return true;
+    };
+    assert(parser.feed(body, sink) && parser.finish());
+    assert(values.size() == 2);
+    for ([[maybe_unused]] std::string_view v : values)
+    {
+      assert(v.data() >= body.data() && v.data() + v.size() <= body.data() + body.size());
+    }
+
+    assert(multipart_boundary("multipart/form-data; boundary=abc") == "abc");
+    assert(multipart_boundary("multipart/form-data; charset=x; Boundary=\"a b;c\"") == "a b;c");
+    assert(multipart_boundary("multipart/form-data").empty());
+  }
+
+  // -------------------------
+  // limits fail mid-stream, with the offset of the first bad byte
+  // -------------------------
+  {
+    const std::string big(100'000, 'x');
+    const std::string body = build({{"title", "", "", "ok"}, {"avatar", "a.bin", "", big}}, boundary);
+
+    MultipartLimits limits;
+    limits.file.max_size = 1000;
+    const Fail f = parse_failure(body, boundary, limits, 256);
+    assert(std::string_view(f.reason) == "too_large" && f.part == "avatar");
+    assert(f.offset == body.find(big) + 1000);
+    assert(f.failed_chunk == (body.find(big) + 1000) / 256);
+
+    MultipartLimits per_part;
+    per_part.part("title", {.max_size = 1});
+    assert(std::string_view(parse_failure(body, boundary, per_part, 64).reason) == "too_large");
+
+    const std::string png = build({{"avatar", "a.png", "image/png", "..."}}, boundary);
+    const std::string gif = build({{"avatar", "a.gif", "IMAGE/GIF; x=y", "..."}}, boundary);
+    const std::string exe = build({{"avatar", "a.exe", "application/octet-stream", "MZ"}}, boundary);
+    MultipartLimits images = MultipartLimits{}.part("avatar", {.content_types = {"image/png", "image/*"}});
+    same(parse_in_chunks(png, boundary, {}, images), {{"avatar", "a.png", "image/png", "..."}});
+    same(parse_in_chunks(gif, boundary, {}, images), {{"avatar", "a.gif", "IMAGE/GIF; x=y", "..."}});
+    const Fail type = parse_failure(exe, boundary, images, 7);
+    assert(std::string_view(type.reason) == "content_type" && type.part == "avatar");
+    assert(type.offset == exe.find("Content-Disposition"));
+
+    const std::string traversal = build({{"avatar", "../../etc/passwd", "", "x"}}, boundary);
+    const Fail name = parse_failure(traversal, boundary, {}, 1000);
+    assert(std::string_view(name.reason) == "filename");
+    assert(name.offset == traversal.find("../") + 2);
+
+    MultipartLimits few;
+    few.max_parts = 1;
+    assert(std::string_view(parse_failure(body, boundary, few, 4096).reason) == "too_many_parts");
+
+    MultipartLimits small_headers;
+    small_headers.max_header_size = 16;
+    const Fail header = parse_failure(body, boundary, small_headers, 3);
+    assert(std::string_view(header.reason) == "header_too_large" && header.part.empty());
+  }
+
+  // -------------------------
+  // malformed bodies
+  // -------------------------
+  {
+    const std::string body = build({{"a", "", "", "1"}}, boundary);
+    [[maybe_unused]] const auto reason = [&](std::string_view b, std::string_view bnd = "----vixBoundary7MA4YWxk")
+    { return std::string(parse_failure(b, bnd, {}, 5).reason); };
+
+    assert(reason(body.substr(0, body.size() - 6)) == "truncated");
+    assert(reason("no delimiter at all") == "truncated");
+    assert(reason("--" + boundary + "x\r\n") == "malformed");
+    assert(reason("--" + boundary + "\r\nContent-Type: text/plain\r\n\r\nx\r\n--" + boundary + "--") == "missing_name");
+    assert(reason("--" + boundary + "\r\nContent-Disposition form-data\r\n\r\n") == "bad_header");
+    assert(reason("--" + boundary + "\r\nContent-Disposition: attachment; name=\"a\"\r\n\r\n") == "bad_header");
+    assert(reason("--" + boundary + "\r\nContent-Disposition: form-data; name=\"a\r\n\r\n") == "bad_header");
+    assert(reason(body, "") == "boundary");
+    assert(reason(body, std::string(71, 'b')) == "boundary");
+  }
+
+  // -------------------------
+  // Form: text parts bound, files streamed, schema run
+  // -------------------------
+  {
+    const std::string body = build({{"title", "", "", "Trip"}, {"tag", "", "", "summer"},
+                                    {"avatar", "me.png", "image/png", std::string(5000, 'p')}},
+                                   boundary);
+
+    auto r = Form<UploadForm>::validate_multipart(body, boundary);
+    assert(r);
+    assert(r.value().title == "Trip" && r.value().tag == "summer");
+    assert(r.value().tag.data() >= body.data() && r.value().tag.data() < body.data() + body.size());
+    assert(r.value().avatar_name == "me.png" && r.value().avatar == std::string(5000, 'p'));
+
+    Form<UploadForm>::MultipartBinder binder(boundary);
+    for (std::size_t at = 0; at < body.size(); at += 100)
+    {
+      assert(binder.feed(std::string_view(body).substr(at, 100)));
+    }
+    auto chunked = binder.finish();
+    assert(chunked && chunked.value().avatar.size() == 5000 && chunked.value().title == "Trip");
+
+    // Schema errors once the body is complete.
+    const std::string untitled = build({{"tag", "", "", "x"}}, boundary);
+    auto invalid = Form<UploadForm>::validate_multipart(untitled, boundary);
+    assert(!invalid && invalid.errors().all()[0].field == "title");
+
+    // Part limits stop the upload: no schema errors on top.
+    MultipartLimits limits;
+    limits.part("avatar", {.max_size = 1024, .content_types = {"image/*"}});
+    Form<UploadForm>::MultipartBinder limited(boundary, limits);
+    std::size_t fed = 0;
+    while (fed < body.size() && limited.feed(std::string_view(body).substr(fed, 512)))
+    {
+      fed += 512;
+    }
+    assert(fed < body.size());
+    auto rejected = limited.finish();
+    assert(!rejected && rejected.errors().size() == 1);
+    [[maybe_unused]] const ValidationError &e = rejected.errors().all()[0];
+    assert(e.field == "avatar" && e.code == ValidationErrorCode::Format);
+    assert(e.meta.at("reason") == "too_large");
+    assert(e.meta.at("offset").as_uint() == body.find(std::string(5000, 'p')) + 1024);
+
+    // Unknown text field, file part without a receiver, broken body.
+    auto unknown = Form<UploadForm>::validate_multipart(build({{"nope", "", "", "x"}}, boundary), boundary);
+    assert(!unknown && unknown.errors().size() == 1);
+    auto stray = Form<UploadForm>::validate_multipart(build({{"title", "x.txt", "", "x"}}, boundary), boundary);
+    assert(!stray && stray.errors().all()[0].field == "__form__");
+    auto truncated = Form<UploadForm>::validate_multipart(body.substr(0, 200), boundary);
+    assert(!truncated && truncated.errors().all()[0].meta.at("reason") == "truncated");
+  }
+
+  std::cout << "form_multipart_bind: OK\n";
+  return 0;
+}
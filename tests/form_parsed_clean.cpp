@@ -0,0 +1,157 @@
+#include <cassert>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/Form.hpp>
+#include <vix/validation/Pipe.hpp>
+#include <vix/validation/Schema.hpp>
+
+using namespace vix::validation;
+
+struct UserClean
+{
+  std::string email;
+  int age{0};
+  long score{0};
+  std::string display;
+};
+
+struct RegisterForm
+{
+  using cleaned_type = UserClean;
+
+  std::string email;
+  std::string age;
+  std::string score;
+  std::string name;
+
+  static bool set(RegisterForm &out, std::string_view key, std::string_view value)
+  {
+    if (key == "email")
+      out.email.assign(value);
+    else if (key == "age")
+      out.age.assign(value);
+    else if (key == "score")
+      out.score.assign(value);
+    else if (key == "name")
+      out.name.assign(value);
+    else
+      return false;
+    return true;
+  }
+
+  static Schema<RegisterForm> schema()
+  {
+    return vix::validation::schema<RegisterForm>()
+        .field("email", &RegisterForm::email, field<std::string>().required().email(), &UserClean::email)
+        .parsed<int>("age", &RegisterForm::age, parsed<int>().between(18, 120), &UserClean::age)
+        .parsed<long>("score", &RegisterForm::score, parsed<long>().min(0), &UserClean::score)
+        .field("name", &RegisterForm::name, field<std::string>().required());
+  }
+
+  // Completes what the schema did not fill.
+  void clean(UserClean &out) const
+  {
+    out.display = name + " <" + out.email + ">";
+  }
+};
+
+int main()
+{
+  // -------------------------
+  // ParsedValidator hands back the value
+  // -------------------------
+  {
+    ValidationErrors errors;
+    [[maybe_unused]] std::optional<int> v = validate_parsed<int>("age", "42").between(18, 120).value_into(errors);
+    assert(v && *v == 42);
+    assert(errors.empty());
+
+    assert(!validate_parsed<int>("age", "7").between(18, 120).value_into(errors));
+    assert(!validate_parsed<int>("age", "x").value_into(errors));
+    assert(errors.size() == 2);
+  }
+
+  // -------------------------
+  // ParsedSpec hands back the value
+  // -------------------------
+  {
+    const auto spec = parsed<int>().min(1);
+    ValidationErrors errors;
+    assert(spec.value_into("n", "5", errors) == std::optional<int>(5));
+    assert(!spec.value_into("n", "0", errors));
+    assert(errors.size() == 1);
+  }
+
+  // -------------------------
+  // Schema fills a cleaned value while validating
+  // -------------------------
+  {
+    RegisterForm f;
+    f.email = "a@b.co";
+    f.age = "30";
+    f.score = "12";
+    f.name = "Ada";
+
+    UserClean clean;
+    ValidationErrors errors;
+    RegisterForm::schema().validate_into(f, errors, clean);
+    assert(errors.empty());
+    assert(clean.email == "a@b.co");
+    assert(clean.age == 30);
+    assert(clean.score == 12);
+    assert(clean.display.empty());
+
+    // A clean object of another type is an error, not a silent no-op.
+    struct Other
+    {
+      int age{0};
+    };
+    Other other;
+    bool thrown = false;
+    try
+    {
+      RegisterForm::schema().validate_into(f, errors, other);
+    }
+    catch (const std::invalid_argument &)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+    (void)thrown;
+  }
+
+  // -------------------------
+  // Form returns cleaned_type without a clean() that re-parses
+  // -------------------------
+  {
+    auto r = Form<RegisterForm>::validate_kv({{"email", "ada@example.com"},
+                                              {"age", "36"},
+                                              {"score", "99"},
+                                              {"name", "Ada"}});
+    assert(r);
+    assert(r.value().age == 36);
+    assert(r.value().score == 99);
+    assert(r.value().display == "Ada <ada@example.com>");
+  }
+
+  {
+    auto r = Form<RegisterForm>::validate_kv({{"email", "ada@example.com"},
+                                              {"age", "abc"},
+                                              {"score", "-1"},
+                                              {"name", ""}});
+    assert(!r);
+    assert(r.errors().size() == 3);
+    assert(r.errors()[0].field == "age");
+    assert(r.errors()[1].field == "score");
+    assert(r.errors()[2].field == "name");
+  }
+
+  std::cout << "[validation] form parsed clean tests passed\n";
+  return 0;
+}
@@ -0,0 +1,303 @@
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/Form.hpp>
+
+#include "alloc_counter.hpp"
+
+using namespace vix::validation;
+
+namespace
+{
+  struct ProfileForm
+  {
+    std::string email;
+    std::string name;
+    std::string country = "FR";
+    std::optional<std::string> nick;
+    std::string_view lang;
+
+    static FormFields<ProfileForm> fields()
+    {
+      return {{"email", &ProfileForm::email},
+              {"name", &ProfileForm::name},
+              {"country", &ProfileForm::country},
+              {"nick", &ProfileForm::nick},
+              {"lang", &ProfileForm::lang}};
+    }
+
+    static Schema<ProfileForm> schema()
+    {
+      return vix::validation::schema<ProfileForm>()
+          .field("email", &ProfileForm::email, field<std::string>().required().email())
+          .field("name", &ProfileForm::name, field<std::string>().required().length_max(40))
+          .field("country", &ProfileForm::country, field<std::string>().length_min(2).length_max(2));
+    }
+  };
+
+  using Input = std::vector<std::pair<std::string_view, std::string_view>>;
+
+  // Hand-written binder: without a reset() hook the form is reassigned.
+  struct LoginForm
+  {
+    std::string user;
+    std::string token = "none";
+
+    static bool bind(LoginForm &out, const Input &in)
+    {
+      for (const auto &[k, v] : in)
+      {
+        if (k == "user")
+          out.user.assign(v);
+        else if (k == "token")
+          out.token.assign(v);
+      }
+      return true;
+    }
+
+    static Schema<LoginForm> schema()
+    {
+      return vix::validation::schema<LoginForm>()
+          .field("user", &LoginForm::user, field<std::string>().required());
+    }
+  };
+
+  // Same, with a reset() hook that keeps capacity.
+  struct TokenForm
+  {
+    std::string token;
+    std::size_t uploads = 0;
+    static inline std::size_t resets = 0;
+
+    static bool set(TokenForm &out, std::string_view key, std::string_view value)
+    {
+      if (key != "token")
+        return false;
+      out.token.assign(value);
+      ++out.uploads;
+      return true;
+    }
+
+    static void reset(TokenForm &out)
+    {
+      out.token.clear();
+      out.uploads = 0;
+      ++resets;
+    }
+
+    static Schema<TokenForm> schema()
+    {
+      return vix::validation::schema<TokenForm>()
+          .field("token", &TokenForm::token, field<std::string>().required().length_min(8));
+    }
+  };
+} // namespace
+
+int main()
+{
+  using PF = Form<ProfileForm>;
+
+  // -------------------------
+  // same result as validate(); absent keys get their default back
+  // -------------------------
+  {
+    ProfileForm form;
+    ValidationErrors errors;
+
+    const Input full{{"email", "ada@example.com"}, {"name", "Ada Lovelace"},
+                     {"country", "GB"}, {"nick", "ada"}, {"lang", "en"}};
+    assert(PF::validate_into(form, errors, full));
+    assert(errors.ok());
+    assert(form.name == "Ada Lovelace" && form.country == "GB" && form.nick == "ada" && form.lang == "en");
+
+    const Input partial{{"email", "bob@example.com"}, {"name", "Bob"}};
+    assert(PF::validate_into(form, errors, partial));
+    assert(form.email == "bob@example.com" && form.name == "Bob");
+    assert(form.country == "FR");
+    assert(!form.nick);
+    assert(form.lang.empty());
+
+    const Input bad{{"email", "nope"}, {"country", "FRA"}};
+    assert(!PF::validate_into(form, errors, bad));
+    assert(errors.size() == PF::validate(bad).errors().size());
+    assert(errors.size() == 3); // email format, name required, country length
+
+    // Errors from the previous call are dropped.
+    assert(PF::validate_into(form, errors, partial));
+    assert(errors.ok());
+
+    // Binding failure: the schema does not run.
+    const Input unknown{{"email", "a@b.co"}, {"role", "admin"}};
+    assert(!PF::validate_into(form, errors, unknown));
+    assert(errors.size() == 1 && errors.all()[0].field == "__form__");
+
+    // FailFast applies to the schema run.
+    assert(!PF::validate_into(form, errors, bad, ValidationPolicy::FailFast));
+    assert(errors.size() == 1);
+  }
+
+  // -------------------------
+  // steady state: no allocation once capacities are reached
+  // -------------------------
+  {
+    const Input requests[] = {
+        {{"email", "ada.lovelace@analytical-engines.example.com"}, {"name", "Augusta Ada King, Countess"}, {"country", "GB"}},
+        {{"email", "bob@example.com"}, {"name", "Bob"}},
+        {{"email", "zoe@example.org"}, {"name", "Zoe"}, {"country", "DE"}, {"nick", "z"}},
+    };
+
+    PF::Workspace ws;
+    bool warm = true;
+    for (const Input &in : requests)
+    {
+      warm = PF::validate_into(ws, in) && warm; // warm up: strings grow here
+    }
+    assert(warm);
+    [[maybe_unused]] const std::size_t n = allocations_during([&]
+                                                              {
+      for (int round = 0; round < 100; ++round)
+      {
+        for (const Input &in : requests)
+        {
+          const bool ok = PF::validate_into(ws, in);
+          assert(ok);
+          (void)ok;
+        }
+      } });
+    assert(n == 0);
+    assert(ws.form.email == "zoe@example.org" && ws.form.country == "DE");
+
+    // The fresh-form path allocates for every request.
+    assert(allocations_during([&]
+                              { assert(PF::validate(requests[0])); }) > 0);
+  }
+
+  // -------------------------
+  // urlencoded bodies through the workspace arena
+  // -------------------------
+  {
+    const std::string bodies[] = {
+        "email=ada%40example.com&name=Ada+Lovelace&country=GB&lang=en",
+        "email=bob@example.com&name=Bob",
+        "name=Zo%C3%AB&email=zoe%40example.org&nick=z%20z",
+    };
+
+    PF::Workspace &ws = PF::workspace();
+    assert(&ws == &PF::workspace());
+    bool warm = true;
+    for (const std::string &b : bodies)
+    {
+      warm = PF::validate_urlencoded_into(ws, b) && warm;
+    }
+    assert(warm);
+    assert(ws.form.name == "Zo\xC3\xAB" && ws.form.nick == "z z" && ws.form.country == "FR");
+
+    [[maybe_unused]] const std::size_t n = allocations_during([&]
+                                                              {
+      for (int round = 0; round < 100; ++round)
+      {
+        for (const std::string &b : bodies)
+        {
+          const bool ok = PF::validate_urlencoded_into(ws, b);
+          assert(ok);
+          (void)ok;
+        }
+      } });
+    assert(n == 0);
+
+    assert(!PF::validate_urlencoded_into(ws, "email=a%4&name=x"));
+    assert(ws.errors.size() == 1);
+    assert(ws.errors.all()[0].meta.at("reason") == "invalid_escape");
+    assert(ws.errors.all()[0].meta.at("offset").as_uint() == 7);
+
+    assert(!PF::validate_urlencoded_into(ws, "email=a%40b.co&name=x&role=admin"));
+    assert(ws.errors.size() == 1 && ws.errors.all()[0].field == "__form__");
+
+    assert(PF::validate_urlencoded_into(ws, "email=a%40b.co&name=x&lang=de"));
+    assert(ws.errors.ok() && ws.form.lang == "de");
+  }
+
+  // -------------------------
+  // decoded text larger than one arena block
+  // -------------------------
+  {
+    std::string large = "email=ada%40example.com&name=Ada&lang=";
+    for (int i = 0; i < 2500; ++i)
+      large += "%C3%A9"; // 5000 decoded bytes: needs a dedicated block
+    std::string medium = "email=bob%40example.com&name=Bob&lang=";
+    for (int i = 0; i < 1500; ++i)
+      medium += "%41%42"; // 3000 decoded bytes
+    const std::string bodies[] = {large, medium, medium, large};
+
+    PF::Workspace ws;
+    bool warm = true;
+    for (const std::string &b : bodies)
+    {
+      warm = PF::validate_urlencoded_into(ws, b) && warm;
+    }
+    assert(warm);
+    assert(ws.form.lang.size() == 5000);
+
+    [[maybe_unused]] const std::size_t n = allocations_during([&]
+                                                              {
+      for (int round = 0; round < 100; ++round)
+      {
+        for (const std::string &b : bodies)
+        {
+          const bool ok = PF::validate_urlencoded_into(ws, b);
+          assert(ok);
+          (void)ok;
+        }
+      } });
+    assert(n == 0);
+    assert(ws.form.lang.size() == 5000 && ws.form.lang.substr(0, 2) == "\xC3\xA9");
+  }
+
+  // -------------------------
+  // each thread has its own workspace
+  // -------------------------
+  {
+    [[maybe_unused]] PF::Workspace *main_ws = &PF::workspace();
+    PF::Workspace *other_ws = nullptr;
+    std::thread t([&]
+                  {
+      other_ws = &PF::workspace();
+      const bool ok = PF::validate_urlencoded_into(*other_ws, "email=t%40example.com&name=T");
+      assert(ok && other_ws->form.name == "T");
+      (void)ok; });
+    t.join();
+    assert(other_ws != main_ws);
+    assert(main_ws->form.lang == "de");
+  }
+
+  // -------------------------
+  // forms bound by hand: reassigned, or reset() hook
+  // -------------------------
+  {
+    LoginForm form;
+    ValidationErrors errors;
+    assert(Form<LoginForm>::validate_into(form, errors, Input{{"user", "ada"}, {"token", "t0k"}}));
+    assert(Form<LoginForm>::validate_into(form, errors, Input{{"user", "bob"}}));
+    assert(form.user == "bob" && form.token == "none");
+    assert(!Form<LoginForm>::validate_into(form, errors, Input{}));
+    assert(errors.size() == 1 && errors.all()[0].field == "user");
+
+    Form<TokenForm>::Workspace ws;
+    assert(Form<TokenForm>::validate_into(ws, Input{{"token", "0123456789abcdef"}}));
+    assert(!Form<TokenForm>::validate_into(ws, Input{{"token", "short"}}));
+    assert(ws.form.uploads == 1 && TokenForm::resets == 2);
+    assert(ws.form.token.capacity() >= 16);
+    assert(!Form<TokenForm>::validate_urlencoded_into(ws, "user=x"));
+    assert(ws.errors.size() == 1 && TokenForm::resets == 3);
+  }
+
+  std::cout << "form_reuse_alloc: OK\n";
+  return 0;
+}
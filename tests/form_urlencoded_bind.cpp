@@ -0,0 +1,248 @@
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/Form.hpp>
+#include <vix/validation/UrlEncoded.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+using Pairs = std::vector<std::pair<std::string, std::string>>;
+
+namespace
+{
+  // Straightforward split-then-decode, kept independent of the parser.
+  std::string decode(std::string_view s)
+  {
+    std::string out;
+    for (std::size_t i = 0; i < s.size(); ++i)
+    {
+      if (s[i] == '+')
+        out += ' ';
+      else if (s[i] == '%')
+      {
+        out += static_cast<char>(std::stoi(std::string(s.substr(i + 1, 2)), nullptr, 16));
+        i += 2;
+      }
+      else
+        out += s[i];
+    }
+    return out;
+  }
+
+  Pairs reference(std::string_view body)
+  {
+    Pairs out;
+    while (true)
+    {
+      const std::size_t amp = body.find('&');
+      const std::string_view pair = body.substr(0, amp);
+      if (!pair.empty())
+      {
+        const std::size_t eq = pair.find('=');
+        out.emplace_back(decode(pair.substr(0, eq)),
+                         eq == std::string_view::npos ? std::string() : decode(pair.substr(eq + 1)));
+      }
+      if (amp == std::string_view::npos)
+        return out;
+      body.remove_prefix(amp + 1);
+    }
+  }
+
+  auto collect(Pairs &out)
+  {
+    return [&out](std::string_view k, std::string_view v)
+    {
+      out.emplace_back(k, v);
+      return true;
+    };
+  }
+
+  struct SignupForm
+  {
+    std::string email;
+    std::string name;
+    std::string_view plan;
+
+    static FormFields<SignupForm> fields()
+    {
+      return {{"email", &SignupForm::email}, {"name", &SignupForm::name}, {"plan", &SignupForm::plan}};
+    }
+
+    static Schema<SignupForm> schema()
+    {
+      return vix::validation::schema<SignupForm>()
+          .field("email", &SignupForm::email, field<std::string>().required().email())
+          .field("name", &SignupForm::name, field<std::string>().required());
+    }
+  };
+
+  struct SetForm
+  {
+    std::string q;
+
+    static bool set(SetForm &out, std::string_view key, std::string_view value)
+    {
+      if (key != "q")
+        return false;
+      out.q.assign(value);
+      return true;
+    }
+
+    static Schema<SetForm> schema()
+    {
+      return vix::validation::schema<SetForm>();
+    }
+  };
+} // namespace
+
+int main()
+{
+  // -------------------------
+  // one-shot and chunked parsing agree with the reference
+  // -------------------------
+  {
+    std::mt19937 rng(5);
+    const std::string_view pieces[] = {"a", "key", "=", "&", "%20", "%C3%A9", "+", "x=y", "&&", "value", "%2B"};
+    for (std::size_t round = 0; round < 400; ++round)
+    {
+      std::string body;
+      const std::size_t n = rng() % 60;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        body += pieces[rng() % std::size(pieces)];
+      }
+      const Pairs want = reference(body);
+
+      for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2})
+      {
+        Pairs whole;
+        UrlEncodedParser parser(level);
+        const bool parsed = parser.parse(body, collect(whole));
+        assert(parsed && whole == want);
+        (void)parsed;
+
+        for (std::size_t cut1 = 0; cut1 <= body.size(); cut1 += 1 + round % 3)
+        {
+          const std::size_t cut2 = cut1 + (body.size() - cut1) / 2;
+          Pairs chunked;
+          parser.reset();
+          // Copies, so views into a chunk cannot outlive it unnoticed.
+          std::string c1(body.substr(0, cut1)), c2(body.substr(cut1, cut2 - cut1)), c3(body.substr(cut2));
+          bool fed = parser.feed(c1, collect(chunked));
+          fed = parser.feed(c2, collect(chunked)) && fed;
+          fed = parser.feed(c3, collect(chunked)) && fed;
+          fed = parser.finish(collect(chunked)) && fed;
+          assert(fed && chunked == want);
+        }
+      }
+    }
+  }
+
+  // -------------------------
+  // zero copy, decoding on demand, malformed escapes
+  // -------------------------
+  {
+    const std::string body = "plain=value&esc=a%20b+c";
+    std::vector<std::pair<std::string_view, std::string_view>> seen;
+    UrlEncodedParser parser;
+    const bool parsed = parser.parse(body, [&](std::string_view k, std::string_view v)
+                                     {
+                                       seen.emplace_back(k, v);
+                                       return true;
+                                     });
+    assert(parsed && seen.size() == 2);
+    (void)parsed;
+    assert(seen[0].second.data() == body.data() + 6); // view of the body
+    assert(seen[1].first.data() == body.data() + 12);
+    assert(seen[1].second == "a b c");                // decoded into the arena
+
+    for (const auto &[bad, offset] : {std::pair<std::string_view, std::size_t>{"a=%G1", 2},
+                                      {"ok=1&b=%2", 7},
+                                      {"x=1&%zz=2", 4}})
+    {
+      parser.reset();
+      const bool ok = parser.parse(bad, [](std::string_view, std::string_view)
+                                   { return true; });
+      assert(!ok && parser.error_offset() == offset);
+      (void)ok;
+      (void)offset;
+    }
+
+    // Offsets count from the start of the body across chunks.
+    parser.reset();
+    auto ignore = [](std::string_view, std::string_view)
+    { return true; };
+    const bool first = parser.feed("first=1&sec", ignore);
+    const bool second = parser.feed("ond=%4", ignore);
+    const bool third = parser.feed("x&third=3", ignore);
+    assert(first && second && !third);
+    assert(parser.error_offset() == 15);
+    (void)first;
+    (void)second;
+    (void)third;
+
+    // A false sink return stops parsing.
+    parser.reset();
+    int calls = 0;
+    const bool stopped = !parser.parse("a=1&b=2&c=3", [&](std::string_view, std::string_view)
+                                       { return ++calls < 2; });
+    assert(stopped && calls == 2 && parser.failed());
+    (void)stopped;
+  }
+
+  // -------------------------
+  // Form::validate_urlencoded and the chunked binder
+  // -------------------------
+  {
+    const std::string body = "name=Ada+Lovelace&email=ada%40example.com&plan=pro";
+    auto r = Form<SignupForm>::validate_urlencoded(body);
+    assert(r);
+    assert(r.value().name == "Ada Lovelace");
+    assert(r.value().email == "ada@example.com");
+    assert(r.value().plan == "pro");
+
+    auto invalid = Form<SignupForm>::validate_urlencoded("name=Ada&email=nope");
+    assert(!invalid && invalid.errors().all()[0].field == "email");
+
+    auto unknown = Form<SignupForm>::validate_urlencoded("name=Ada&admin=1&email=ada%40example.com");
+    assert(!unknown && unknown.errors().size() == 1);
+    assert(unknown.errors().all()[0].field == "__form__");
+
+    auto escape = Form<SignupForm>::validate_urlencoded("name=Ada%2");
+    assert(!escape && escape.errors().size() == 1);
+    assert(escape.errors().all()[0].code == ValidationErrorCode::Format);
+    assert(escape.errors().all()[0].meta.at("reason") == "invalid_escape");
+    assert(escape.errors().all()[0].meta.at("offset").as_uint() == 8);
+
+    Form<SignupForm>::UrlEncodedBinder binder;
+    bool fed = true;
+    for (std::string_view chunk : {"na", "me=Gr", "ace+Hopper&em", "ail=grace%40", "navy.mil"})
+    {
+      fed = binder.feed(chunk) && fed;
+    }
+    assert(fed);
+    auto chunked = binder.finish();
+    assert(chunked);
+    assert(chunked.value().name == "Grace Hopper");
+    assert(chunked.value().email == "grace@navy.mil");
+
+    Form<SignupForm>::UrlEncodedBinder stops;
+    const bool evil = stops.feed("evil=1&name=x");
+    auto rejected = stops.finish();
+    assert(!evil && !rejected);
+    (void)evil;
+
+    auto q = Form<SetForm>::validate_urlencoded("q=hello+world");
+    assert(q && q.value().q == "hello world");
+    assert(!Form<SetForm>::validate_urlencoded("q=1&p=2"));
+  }
+
+  std::cout << "form_urlencoded_bind: OK\n";
+  return 0;
+}
@@ -0,0 +1,158 @@
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <vix/validation/Rules.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/StaticStringSet.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  // 154 ISO 4217 codes: large enough for the perfect-hash layout.
+  using Currencies = StaticStringSet<
+    "AED", "AFN", "ALL", "AMD", "ANG", "AOA", "ARS", "AUD", "AWG", "AZN", "BAM", "BBD",
+    "BDT", "BGN", "BHD", "BIF", "BMD", "BND", "BOB", "BRL", "BSD", "BTN", "BWP", "BYN",
+    "BZD", "CAD", "CDF", "CHF", "CLP", "CNY", "COP", "CRC", "CUP", "CVE", "CZK", "DJF",
+    "DKK", "DOP", "DZD", "EGP", "ERN", "ETB", "EUR", "FJD", "FKP", "GBP", "GEL", "GHS",
+    "GIP", "GMD", "GNF", "GTQ", "GYD", "HKD", "HNL", "HTG", "HUF", "IDR", "ILS", "INR",
+    "IQD", "IRR", "ISK", "JMD", "JOD", "JPY", "KES", "KGS", "KHR", "KMF", "KPW", "KRW",
+    "KWD", "KYD", "KZT", "LAK", "LBP", "LKR", "LRD", "LSL", "LYD", "MAD", "MDL", "MGA",
+    "MKD", "MMK", "MNT", "MOP", "MRU", "MUR", "MVR", "MWK", "MXN", "MYR", "MZN", "NAD",
+    "NGN", "NIO", "NOK", "NPR", "NZD", "OMR", "PAB", "PEN", "PGK", "PHP", "PKR", "PLN",
+    "PYG", "QAR", "RON", "RSD", "RUB", "RWF", "SAR", "SBD", "SCR", "SDG", "SEK", "SGD",
+    "SHP", "SLE", "SOS", "SRD", "SSP", "STN", "SYP", "SZL", "THB", "TJS", "TMT", "TND",
+    "TOP", "TRY", "TTD", "TWD", "TZS", "UAH", "UGX", "USD", "UYU", "UZS", "VES", "VND",
+    "VUV", "WST", "XAF", "XCD", "XOF", "XPF", "YER", "ZAR", "ZMW", "ZWL">;
+
+  static_assert(Currencies::size() == 154);
+  static_assert(Currencies::contains("EUR"));
+  static_assert(Currencies::contains("UGX"));
+  static_assert(!Currencies::contains("XXX"));
+  static_assert(!Currencies::contains(""));
+  static_assert(!Currencies::contains("EURO"));
+
+  // Same length and same first/last 8 bytes: only the middle tells them
+  // apart, so the set falls back to hashing every byte.
+  using Events = StaticStringSet<"order.created.v1.event", "order.updated.v1.event",
+                                 "order.deleted.v1.event", "order.shipped.v1.event",
+                                 "order.paid.v1.event", "user", "account.v2">;
+  static_assert(Events::contains("order.updated.v1.event"));
+  static_assert(Events::contains("order.paid.v1.event"));
+  static_assert(Events::contains("user"));
+  static_assert(!Events::contains("order.removed.v1.event"));
+  static_assert(!Events::contains("account.v3"));
+  static_assert(!Events::contains("usr"));
+
+  using Roles = StaticStringSet<"admin", "user", "guest">;
+  static_assert(Roles::contains("user"));
+  static_assert(!Roles::contains("use"));
+  static_assert(!Roles::contains("users"));
+
+  struct Payment
+  {
+    std::string currency;
+    std::string_view role;
+  };
+} // namespace
+
+int main()
+{
+  // -------------------------
+  // every key, and every one-letter variation of it
+  // -------------------------
+  {
+    const char *const all[] = {
+        "AED", "AFN", "ALL", "AMD", "ANG", "AOA", "ARS", "AUD", "AWG", "AZN", "BAM", "BBD",
+        "BDT", "BGN", "BHD", "BIF", "BMD", "BND", "BOB", "BRL", "BSD", "BTN", "BWP", "BYN",
+        "BZD", "CAD", "CDF", "CHF", "CLP", "CNY", "COP", "CRC", "CUP", "CVE", "CZK", "DJF",
+        "DKK", "DOP", "DZD", "EGP", "ERN", "ETB", "EUR", "FJD", "FKP", "GBP", "GEL", "GHS",
+        "GIP", "GMD", "GNF", "GTQ", "GYD", "HKD", "HNL", "HTG", "HUF", "IDR", "ILS", "INR",
+        "IQD", "IRR", "ISK", "JMD", "JOD", "JPY", "KES", "KGS", "KHR", "KMF", "KPW", "KRW",
+        "KWD", "KYD", "KZT", "LAK", "LBP", "LKR", "LRD", "LSL", "LYD", "MAD", "MDL", "MGA",
+        "MKD", "MMK", "MNT", "MOP", "MRU", "MUR", "MVR", "MWK", "MXN", "MYR", "MZN", "NAD",
+        "NGN", "NIO", "NOK", "NPR", "NZD", "OMR", "PAB", "PEN", "PGK", "PHP", "PKR", "PLN",
+        "PYG", "QAR", "RON", "RSD", "RUB", "RWF", "SAR", "SBD", "SCR", "SDG", "SEK", "SGD",
+        "SHP", "SLE", "SOS", "SRD", "SSP", "STN", "SYP", "SZL", "THB", "TJS", "TMT", "TND",
+        "TOP", "TRY", "TTD", "TWD", "TZS", "UAH", "UGX", "USD", "UYU", "UZS", "VES", "VND",
+        "VUV", "WST", "XAF", "XCD", "XOF", "XPF", "YER", "ZAR", "ZMW", "ZWL"};
+
+    [[maybe_unused]] const auto is_code = [&](std::string_view v)
+    {
+      for (std::string_view code : all)
+      {
+        if (code == v)
+        {
+          return true;
+        }
+      }
+      return false;
+    };
+
+    for (std::string_view code : all)
+    {
+      assert(Currencies::contains(code));
+      std::string probe(code);
+      for (std::size_t i = 0; i < probe.size(); ++i)
+      {
+        const char saved = probe[i];
+        for (char c = 'A'; c <= 'Z'; ++c)
+        {
+          probe[i] = c;
+          assert(Currencies::contains(probe) == is_code(probe));
+        }
+        probe[i] = saved;
+      }
+    }
+  }
+
+  // -------------------------
+  // runtime lookups agree with the constant-evaluated ones
+  // -------------------------
+  {
+    const std::string events[] = {"order.created.v1.event", "order.updated.v1.event", "order.deleted.v1.event",
+                                  "order.shipped.v1.event", "order.paid.v1.event", "user", "account.v2"};
+    for (const std::string &e : events)
+    {
+      assert(Events::contains(e));
+      std::string probe = e;
+      probe[probe.size() / 2] = '#';
+      assert(!Events::contains(probe));
+      assert(!Events::contains(std::string_view(e).substr(1)));
+    }
+  }
+
+  // -------------------------
+  // builders and schema fields, std::string and std::string_view
+  // -------------------------
+  {
+    const std::string ok = "admin";
+    const std::string_view bad = "root";
+
+    const auto good = validate("role", ok).in_set_ct<"admin", "user", "guest">().result();
+    assert(good.ok());
+
+    auto res = validate("role", bad).in_set_ct<"admin", "user", "guest">("unknown role").result();
+    assert(!res.ok());
+    [[maybe_unused]] const auto &e = res.errors.all()[0];
+    assert(e.code == ValidationErrorCode::InSet);
+    assert(e.message == "unknown role");
+    assert(e.meta.at("got") == "root");
+    assert(e.meta.at("allowed_count").as_uint() == 3);
+
+    const auto s = schema<Payment>()
+                       .field("currency", &Payment::currency, field<std::string>().in_set_ct<"USD", "EUR", "UGX">())
+                       .field("role", &Payment::role, field<std::string_view>().in_set_ct<"admin", "user">());
+
+    assert(s.validate(Payment{"EUR", "user"}).ok());
+    const auto r = s.validate(Payment{"GBP", "root"});
+    assert(r.errors.size() == 2);
+  }
+
+  std::cout << "in_set_ct_smoke: OK\n";
+  return 0;
+}
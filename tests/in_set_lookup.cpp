@@ -0,0 +1,138 @@
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include <vix/validation/Rules.hpp>
+#include <vix/validation/StringSet.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  std::string random_key(std::mt19937 &rng, std::size_t max_len)
+  {
+    // Small alphabet and shared prefixes so keys collide on length and head.
+    static constexpr std::string_view alphabet = "ab_.";
+    std::uniform_int_distribution<std::size_t> len(0, max_len);
+    std::uniform_int_distribution<std::size_t> pick(0, alphabet.size() - 1);
+
+    std::string s = "prefix_";
+    const std::size_t n = len(rng);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      s += alphabet[pick(rng)];
+    }
+    return s;
+  }
+
+  void check_against_reference(std::size_t count, [[maybe_unused]] StringSet::Layout expected)
+  {
+    std::mt19937 rng(static_cast<unsigned>(count) * 7919u + 1u);
+
+    std::vector<std::string> keys;
+    std::unordered_set<std::string> reference;
+    while (reference.size() < count)
+    {
+      std::string k = random_key(rng, 12);
+      if (reference.insert(k).second)
+      {
+        keys.push_back(k);
+      }
+    }
+    keys.push_back(keys.front()); // duplicates are dropped
+
+    const StringSet set(keys);
+    assert(set.size() == count);
+    assert(set.layout() == expected);
+
+    for ([[maybe_unused]] const auto &k : reference)
+    {
+      assert(set.contains(k));
+    }
+
+    for (int i = 0; i < 20000; ++i)
+    {
+      const std::string probe = random_key(rng, 13);
+      assert(set.contains(probe) == (reference.count(probe) != 0));
+    }
+  }
+} // namespace
+
+int main()
+{
+  // -------------------------
+  // every layout agrees with std::unordered_set
+  // -------------------------
+  {
+    check_against_reference(1, StringSet::Layout::Linear);
+    check_against_reference(StringSet::linear_max, StringSet::Layout::Linear);
+    check_against_reference(StringSet::linear_max + 1, StringSet::Layout::Sorted);
+    check_against_reference(StringSet::sorted_max, StringSet::Layout::Sorted);
+    check_against_reference(StringSet::sorted_max + 1, StringSet::Layout::PerfectHash);
+    check_against_reference(5000, StringSet::Layout::PerfectHash);
+  }
+
+  // -------------------------
+  // empty sets and the empty key
+  // -------------------------
+  {
+    const StringSet none;
+    assert(none.empty());
+    assert(!none.contains(""));
+    assert(!none.contains("x"));
+
+    const StringSet with_empty{"", "a"};
+    assert(with_empty.contains(""));
+    assert(with_empty.contains("a"));
+    assert(!with_empty.contains("b"));
+  }
+
+  // -------------------------
+  // string and string_view values share one rule
+  // -------------------------
+  {
+    const std::string role = "admin";
+    [[maybe_unused]] const std::string_view view = "guest";
+    const std::string_view bad = "root";
+
+    assert(validate("role", role).in_set({"admin", "user", "guest"}).result().ok());
+    assert(validate("role", view).in_set({"admin", "user", "guest"}).result().ok());
+
+    auto res = validate("role", bad).in_set({"admin", "user", "guest"}).result();
+    assert(!res.ok());
+    [[maybe_unused]] const auto &e = res.errors.all()[0];
+    assert(e.code == ValidationErrorCode::InSet);
+    assert(e.meta.at("got") == "root");
+    assert(e.meta.at("allowed_count").as_uint() == 3);
+  }
+
+  // -------------------------
+  // huge rejected values are not copied into meta
+  // -------------------------
+  {
+    // 63 ASCII bytes, then multi-byte characters straddling the 64-byte cut.
+    std::string huge(63, 'x');
+    for (int i = 0; i < 100000; ++i)
+    {
+      huge += "\xC3\xA9";
+    }
+
+    ValidationErrors out;
+    rules::in_set({"a", "b"})("field", huge, out);
+    assert(out.size() == 1);
+
+    [[maybe_unused]] const auto &meta = out.all()[0].meta;
+    assert(meta.at("got") == std::string(63, 'x'));
+    assert(meta.at("got_size").as_uint() == huge.size());
+    assert(meta.at("allowed_count").as_uint() == 2);
+  }
+
+  std::cout << "in_set_lookup: OK\n";
+  return 0;
+}
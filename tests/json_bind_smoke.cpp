@@ -0,0 +1,239 @@
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <vix/validation/Json.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/SchemaJson.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  struct Signup
+  {
+    std::string name;
+    std::string email;
+    int age = 18;
+    bool admin = false;
+    double score = 0;
+    std::optional<std::string> nick;
+    std::string_view country;
+    std::string zip = "10000"; // parsed as an int
+  };
+
+  Schema<Signup> signup_schema()
+  {
+    return schema<Signup>()
+        .field("name", &Signup::name, field<std::string>().required().length_max(16))
+        .field("email", &Signup::email, field<std::string>().required().email())
+        .field("age", &Signup::age, field<int>().between(18, 120))
+        .field("admin", &Signup::admin, [](std::string_view, const bool &) { return ValidationResult{}; })
+        .field("score", &Signup::score, field<double>().min(0.0))
+        .field("country", &Signup::country, field<std::string_view>().ascii())
+        .parsed<int>("zip", &Signup::zip, parsed<int>().between(1000, 99999))
+        .check([](const Signup &s, ValidationErrors &out)
+               {
+          if (s.admin && s.age < 21)
+          {
+            out.add("admin", ValidationErrorCode::Custom, "too young for admin");
+          } });
+  }
+
+  // Reason and offset of the only error of `body`, read as a bare object.
+  std::pair<std::string, std::size_t> reader_error(std::string_view body)
+  {
+    JsonReader in(body);
+    std::string_view key;
+    JsonValue value;
+    if (in.begin_object())
+    {
+      while (in.next_key(key) && in.read_value(value))
+      {
+      }
+      (void)in.finish();
+    }
+    return in.failed() ? std::pair<std::string, std::size_t>{in.error(), in.error_offset()}
+                       : std::pair<std::string, std::size_t>{"", 0};
+  }
+
+  ValidationError only(const ValidationResult &r)
+  {
+    assert(r.errors.size() == 1);
+    return r.errors.all()[0];
+  }
+} // namespace
+
+int main()
+{
+  const Schema<Signup> s = signup_schema();
+
+  // -------------------------
+  // binding: every member type, escapes, skipped members
+  // -------------------------
+  {
+    const std::string body = R"( {
+      "name": "Zo\u00eb \ud83d\ude00",
+      "extra": {"a": [1, 2.5e-3, {"b": null}], "c": "\"q\""},
+      "email": "zoe@example.com",
+      "age": 30, "admin": true, "score": -0.0, "nick": "z\/z",
+      "country": "FR", "zip": 75001, "tags": []
+    } )";
+    Signup out;
+    const auto r = validate_json(s, body, out);
+    assert(r.ok());
+    assert(out.name == "Zo\xC3\xAB \xF0\x9F\x98\x80");
+    assert(out.email == "zoe@example.com");
+    assert(out.age == 30 && out.admin && out.score == 0.0);
+    assert(!out.nick); // no field registered for it
+    assert(out.country == "FR");
+    assert(out.country.data() >= body.data() && out.country.data() < body.data() + body.size());
+    assert(out.zip == "75001");
+
+    Signup nulls;
+    nulls.country = "US";
+    assert(validate_json(s, R"({"name":"a","email":"a@b.co","country":null,"zip":"1234"})", nulls).ok());
+    assert(nulls.country == "US");
+  }
+
+  // -------------------------
+  // field errors, in body order; absent fields and check() run at the end
+  // -------------------------
+  {
+    Signup out;
+    const auto r = validate_json(s, R"({"zip":"12","age":16,"admin":true,"name":"Bob"})", out);
+    [[maybe_unused]] const auto &e = r.errors.all();
+    assert(e.size() == 5);
+    assert(e[0].field == "zip" && e[0].code == ValidationErrorCode::Between);
+    assert(e[1].field == "age" && e[1].code == ValidationErrorCode::Between);
+    assert(e[2].field == "email" && e[2].code == ValidationErrorCode::Required);
+    assert(e[3].field == "email" && e[3].code == ValidationErrorCode::Format);
+    assert(e[4].field == "admin" && e[4].code == ValidationErrorCode::Custom);
+
+    // Same errors as the two-step path, modulo order.
+    assert(s.validate(out).errors.size() == 5);
+  }
+
+  // -------------------------
+  // type mismatches skip the field's rules
+  // -------------------------
+  {
+    Signup out;
+    const std::string body = R"({"name":"Al","email":"a@b.co","age":"30"})";
+    const ValidationError e = only(validate_json(s, body, out));
+    assert(e.field == "age" && e.code == ValidationErrorCode::Format);
+    assert(e.meta.at("reason") == "type");
+    assert(e.meta.at("offset").as_uint() == body.find("\"30\""));
+
+    assert(only(validate_json(s, R"({"name":"Al","email":"a@b.co","age":1.5})", out)).meta.at("reason") == "type");
+    assert(only(validate_json(s, R"({"name":"Al","email":"a@b.co","age":99999999999})", out)).meta.at("reason") == "out_of_range");
+    assert(only(validate_json(s, R"({"name":"Al","email":"a@b.co","admin":1})", out)).meta.at("reason") == "type");
+    assert(only(validate_json(s, R"({"name":["Al"],"email":"a@b.co"})", out)).field == "name");
+    assert(only(validate_json(s, R"({"name":"Al","email":"a@b.co","country":"\u0046R"})", out)).meta.at("reason") ==
+           "escaped_view");
+  }
+
+  // -------------------------
+  // malformed bodies: reason and offset on "__json__"
+  // -------------------------
+  {
+    const struct
+    {
+      std::string_view body;
+      std::string_view reason;
+      std::size_t offset;
+    } cases[] = {
+        {"", "unexpected_end", 0},
+        {"[]", "expected_object", 0},
+        {"{", "unexpected_end", 1},
+        {"{\"a\" 1}", "expected_colon", 5},
+        {"{\"a\":1 \"b\":2}", "expected_comma", 7},
+        {"{\"a\":1,}", "expected_key", 7},
+        {"{\"a\":01}", "invalid_number", 6},
+        {"{\"a\":-}", "invalid_number", 6},
+        {"{\"a\":1.}", "invalid_number", 7},
+        {"{\"a\":1e}", "invalid_number", 7},
+        {"{\"a\":tru}", "unexpected_char", 5},
+        {"{\"a\":nul", "unexpected_end", 5},
+        {"{\"a\":\"x\ty\"}", "control_char", 7},
+        {"{\"a\":\"\\x\"}", "invalid_escape", 7},
+        {"{\"a\":\"\\u12g4\"}", "invalid_escape", 6},
+        {"{\"a\":\"\\ud800x\"}", "invalid_escape", 6},
+        {"{\"a\":\"\\udc00\"}", "invalid_escape", 6},
+        {"{\"a\":\"abc", "unexpected_end", 9},
+        {"{\"a\":[1,]}", "unexpected_char", 8},
+        {"{\"a\":{\"b\"}}", "expected_colon", 9},
+        {"{\"a\":1} x", "trailing_data", 8},
+        {"{\"a\":1}}", "trailing_data", 7},
+    };
+    for (const auto &c : cases)
+    {
+      const auto [reason, offset] = reader_error(c.body);
+      assert(reason == c.reason);
+      assert(offset == c.offset);
+    }
+
+    for ([[maybe_unused]] std::string_view good : {"{}", " { } ", "{\"a\":{}}", "{\"a\":[[],{}],\"b\":-0.5E+3}", "{\"\":\"\\\"\\\\\\/\\b\\f\\n\\r\\t\"}"})
+    {
+      assert(reader_error(good).first.empty());
+    }
+
+    const std::string deep = "{\"a\":" + std::string(JsonReader::max_depth, '[') + std::string(JsonReader::max_depth, ']') + "}";
+    assert(reader_error(deep).first.empty());
+    const std::string too_deep = "{\"a\":" + std::string(JsonReader::max_depth + 1, '[') + std::string(JsonReader::max_depth + 1, ']') + "}";
+    assert(reader_error(too_deep).first == "too_deep");
+
+    Signup out;
+    const ValidationError e = only(validate_json(s, R"({"name":"Al","name":"Bo"})", out));
+    assert(e.field == "__json__" && e.meta.at("reason") == "duplicate_key");
+    assert(e.meta.at("offset").as_uint() == 13);
+
+    // A syntax error ends the run: no checks for fields not read yet.
+    const ValidationError bad = only(validate_json(s, R"({"name":"Al",)", out));
+    assert(bad.field == "__json__" && bad.meta.at("reason") == "unexpected_end");
+  }
+
+  // -------------------------
+  // policies: FailFast stops reading at the first invalid member
+  // -------------------------
+  {
+    std::string body = R"({"email":"nope","name":"Al","blob":")";
+    body.append(10u << 20, 'x'); // unterminated 10 MB string
+
+    Signup out;
+    const auto fast = validate_json(s, body, out, ValidationPolicy::FailFast);
+    assert(only(fast).field == "email");
+    assert(out.name.empty()); // never read
+
+    const auto all = validate_json(s, body, out);
+    assert(all.errors.size() == 2);
+    assert(all.errors.all()[1].field == "__json__");
+    assert(all.errors.all()[1].meta.at("offset").as_uint() == body.size());
+
+    const auto first = validate_json(s, R"({"name":"","email":""})", out, ValidationPolicy::FirstErrorPerField);
+    assert(first.errors.size() == 2);
+
+    ValidationErrors errors;
+    validate_json_into(s, R"({"name":"a-very-long-name-indeed","age":5})", out, errors, ValidationPolicy::FailFast);
+    assert(errors.size() == 1 && errors.all()[0].field == "name");
+  }
+
+  // -------------------------
+  // empty schema, copies share the index
+  // -------------------------
+  {
+    Signup out;
+    assert(validate_json(schema<Signup>(), R"({"name":"x"})", out).ok());
+    assert(out.name.empty());
+
+    const Schema<Signup> copy = s;
+    assert(validate_json(copy, R"({"name":"Al","email":"a@b.co"})", out).ok());
+    assert(validate_json(s, R"({"name":"Al","email":"a@b.co"})", out).ok());
+  }
+
+  std::cout << "json_bind_smoke: OK\n";
+  return 0;
+}
@@ -0,0 +1,85 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/StaticField.hpp>
+
+#include "alloc_counter.hpp"
+
+using namespace vix::validation;
+
+struct Reading
+{
+  int level{0};
+  unsigned count{0};
+  double ratio{0.0};
+  std::string tag;
+};
+
+int main()
+{
+  // -------------------------
+  // MetaValue kinds and formatting
+  // -------------------------
+  {
+    const MetaValue i = -42;
+    const MetaValue u = std::uint64_t{18446744073709551615ull};
+    const MetaValue d = 0.25;
+    const MetaValue b = true;
+    const MetaValue s = ErrorText::literal("abc");
+
+    assert(i.is_int() && i.as_int() == -42 && i == "-42");
+    assert(u.is_uint() && u == "18446744073709551615");
+    assert(d.is_double() && d.as_double() == 0.25 && d == "0.25");
+    assert(b.is_bool() && b == "true");
+    assert(s.is_string() && s.as_string() == "abc");
+
+    std::ostringstream os;
+    os << i << ' ' << d << ' ' << b;
+    assert(os.str() == "-42 0.25 true");
+    assert(d.str() == "0.25");
+  }
+
+  const auto s = schema<Reading>()
+                     .field("level", &Reading::level, field<int>().min(1).max(10))
+                     .field("count", &Reading::count, static_field<unsigned>(rules::between(1u, 5u)))
+                     .field("ratio", &Reading::ratio, field<double>().between(0.0, 1.0))
+                     .field("tag", &Reading::tag, field<std::string>().length_min(2).length_max(8));
+
+  const Reading bad{0, 9, 1.5, std::string(16, 'x')};
+
+  // Warm up, then fail every numeric rule into reserved storage.
+  ValidationErrors out;
+  out.reserve(16);
+  s.validate_into(bad, out);
+  assert(out.size() == 4);
+  out.clear();
+
+  const std::size_t before = g_allocations;
+  s.validate_into(bad, out);
+  [[maybe_unused]] const std::size_t n = g_allocations - before;
+
+  assert(n == 0);
+  assert(out.size() == 4);
+
+  // Values keep their types until rendered.
+  assert(out[0].meta.at("got").is_int());
+  assert(out[0].meta.at("got").as_int() == 0);
+  assert(out[1].meta.at("max").is_uint());
+  assert(out[1].meta.at("got") == "9");
+  assert(out[2].meta.at("got").is_double());
+  assert(out[2].meta.at("got") == "1.5");
+  assert(out[3].code == ValidationErrorCode::LengthMax);
+  assert(out[3].meta.at("got").as_uint() == 16);
+
+  const auto legacy = out[2].meta.to_map();
+  assert(legacy.at("min") == "0");
+  assert(legacy.at("max") == "1");
+
+  std::cout << "[validation] meta value allocation tests passed\n";
+  return 0;
+}
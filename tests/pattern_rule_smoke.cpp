@@ -0,0 +1,178 @@
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <vix/validation/Pattern.hpp>
+#include <vix/validation/Rules.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  [[maybe_unused]] bool throws(std::string_view source)
+  {
+    try
+    {
+      (void)Pattern(source);
+    }
+    catch (const std::invalid_argument &)
+    {
+      return true;
+    }
+    return false;
+  }
+} // namespace
+
+int main()
+{
+  // -------------------------
+  // same answers as std::regex_search on random inputs
+  // -------------------------
+  {
+    const char *patterns[] = {
+        "",
+        "a",
+        "^a",
+        "a$",
+        "^$",
+        "^abc$",
+        "ab*c",
+        "^a+b?$",
+        "^(ab|cd)*$",
+        "^(a|b)*abb$",
+        "^[a-c]{2,3}$",
+        "^[^ab]+$",
+        "^a{3}$",
+        "^a{2,}$",
+        "^(?:a|bc){1,4}d?$",
+        "^\\d{3}-\\d{4}$",
+        "^\\w+$",
+        "\\s",
+        "^\\S*$",
+        "^.b.$",
+        "^[a\\-c]+$",
+        "^[]a]+$",
+        "^[^]\\]]+$",
+        "b|^c|d$",
+        "^(a*)*b$",
+        "^(a|ab)(c|bcd)(d*)$",
+        "^[a-d]*?c+?$",
+        "^a\\.b$",
+        "(ab)+",
+    };
+
+    std::mt19937 rng(3);
+    const std::string_view alphabet = "abcd-. 1\n";
+    for (const char *source : patterns)
+    {
+      const Pattern p(source);
+      const std::regex re(source);
+      for (int round = 0; round < 600; ++round)
+      {
+        std::string s;
+        const std::size_t n = rng() % 9;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          s += alphabet[rng() % alphabet.size()];
+        }
+        [[maybe_unused]] const bool want = std::regex_search(s, re);
+        assert(p.matches(s) == want);
+        assert((p.mismatch(s) == std::string_view::npos) == want);
+      }
+    }
+  }
+
+  // -------------------------
+  // minimization and adversarial input
+  // -------------------------
+  {
+    // (a|b)*abb has a 4-state minimal DFA, plus the dead state.
+    assert(Pattern("^(a|b)*abb$").state_count() == 5);
+    assert(Pattern("^(a|b)*abb$").state_count() == Pattern("^[ab]*abb$").state_count());
+
+    // Catastrophic for backtracking engines; linear here.
+    const Pattern evil("^(a+)+$");
+    std::string s(1 << 20, 'a');
+    s += '!';
+    const auto t0 = std::chrono::steady_clock::now();
+    assert(!evil.matches(s));
+    assert(evil.mismatch(s) == s.size() - 1);
+    const auto elapsed = std::chrono::steady_clock::now() - t0;
+    assert(elapsed < std::chrono::seconds(1));
+
+    // Dead state stops the scan at the offending byte.
+    assert(Pattern("^[a-z]+$").mismatch("abc1def") == 3);
+    assert(Pattern("^[a-z]{4}$").mismatch("abc") == 3);
+    assert(Pattern("x").mismatch("") == 0);
+  }
+
+  // -------------------------
+  // bytes, escapes and errors
+  // -------------------------
+  {
+    assert(Pattern("^caf\xC3\xA9$").matches("caf\xC3\xA9"));
+    assert(Pattern("^\\x41\\t$").matches("A\t"));
+    assert(!Pattern("^.$").matches("\n"));
+
+    const Pattern copy = Pattern("^[0-9a-f]{8}$");
+    const Pattern shared = copy;
+    assert(shared.matches("deadbeef") && shared.source() == "^[0-9a-f]{8}$");
+
+    for ([[maybe_unused]] const char *bad : {"(", "a)", "[a", "*a", "a{2", "a{3,1}", "\\", "\\b", "\\q", "a^b", "a$b", "[z-a]",
+                                             "a{1001}", "\\xZZ"})
+    {
+      assert(throws(bad));
+    }
+    assert(throws("^(a|b)*a(a|b){20}$")); // 2^21 DFA states
+  }
+
+  // -------------------------
+  // rules
+  // -------------------------
+  {
+    assert(validate("zip", std::string("75001")).pattern("^\\d{5}$").result().ok());
+
+    auto bad = validate("zip", std::string("750A1")).pattern("^\\d{5}$", "bad zip").result();
+    assert(bad.errors.size() == 1);
+    assert(bad.errors.all()[0].code == ValidationErrorCode::Format);
+    assert(bad.errors.all()[0].meta.at("reason") == "pattern");
+    assert(bad.errors.all()[0].meta.at("offset").as_uint() == 3);
+
+    const Pattern sku("^[A-Z]{3}-\\d{4}$");
+    assert(rules::pattern(sku).test("ABC-1234"));
+    assert(!rules::pattern(sku).test("abc-1234"));
+
+    struct Product
+    {
+      std::string sku;
+      std::string_view color;
+    };
+    const auto s = schema<Product>()
+                       .field("sku", &Product::sku, field<std::string>().pattern(sku))
+                       .field("color", &Product::color, field<std::string_view>().pattern("^#[0-9a-fA-F]{6}$"));
+    assert(s.validate(Product{"ABC-1234", "#00ff7F"}).ok());
+    assert(s.validate(Product{"ABC-12345", "#00ff7"}).errors.size() == 2);
+
+    // Chained builders share a Pattern compiled once, outside the lambda.
+    const auto chained = schema<Product>()
+                             .field("sku", &Product::sku,
+                                    [sku](std::string_view f, const std::string &v)
+                                    {
+                                      return validate(f, v).required().pattern(sku, "bad sku");
+                                    });
+    assert(chained.validate(Product{"ABC-1234", {}}).ok());
+    const auto r = chained.validate(Product{"AB-1234", {}});
+    assert(r.errors.size() == 1 && r.errors.all()[0].message == "bad sku");
+  }
+
+  std::cout << "pattern_rule_smoke: OK\n";
+  return 0;
+}
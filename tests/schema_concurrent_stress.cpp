@@ -0,0 +1,147 @@
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <vix/validation/BaseModel.hpp>
+#include <vix/validation/Form.hpp>
+#include <vix/validation/Pipe.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/SchemaBatch.hpp>
+#include <vix/validation/Validate.hpp>
+
+// 64 threads share one cached schema per type (BaseModel / Form schema_ref).
+// Every thread starts at the same time, so the first use of each cached
+// schema also races. Build this test with -fsanitize=thread to check that
+// concurrent validation is free of data races (see tests/CMakeLists.txt).
+
+using namespace vix::validation;
+
+namespace
+{
+  std::atomic<std::size_t> check_calls{0};
+}
+
+struct Account : BaseModel<Account>
+{
+  std::string email;
+  std::string password;
+  std::string age;
+
+  static Schema<Account> schema()
+  {
+    return vix::validation::schema<Account>()
+        .field("email", &Account::email, field<std::string>().required().email())
+        .field("password", &Account::password,
+               [](std::string_view f, const std::string &v)
+               {
+                 return vix::validation::validate(f, v).required().length_min(8);
+               })
+        .parsed<int>("age", &Account::age, parsed<int>().between(18, 120))
+        .check([](const Account &a, ValidationErrors &errors)
+               {
+                 check_calls.fetch_add(1, std::memory_order_relaxed);
+                 if (!a.password.empty() && a.password == a.email)
+                 {
+                   errors.add("password", ValidationErrorCode::Custom, "password equals email");
+                 } });
+  }
+};
+
+struct SignupForm
+{
+  std::string email;
+  std::string age;
+
+  static bool set(SignupForm &out, std::string_view key, std::string_view value)
+  {
+    if (key == "email")
+      out.email.assign(value);
+    else if (key == "age")
+      out.age.assign(value);
+    return true;
+  }
+
+  static Schema<SignupForm> schema()
+  {
+    return vix::validation::schema<SignupForm>()
+        .field("email", &SignupForm::email, field<std::string>().required().email())
+        .parsed<int>("age", &SignupForm::age, parsed<int>().between(18, 120));
+  }
+};
+
+int main()
+{
+  constexpr std::size_t threads = 64;
+  constexpr std::size_t rounds = 200;
+
+  std::atomic<std::size_t> ready{0};
+  std::atomic<bool> go{false};
+  std::atomic<std::size_t> mismatches{0};
+
+  auto work = [&](std::size_t id)
+  {
+    ready.fetch_add(1);
+    while (!go.load())
+    {
+      std::this_thread::yield();
+    }
+
+    for (std::size_t i = 0; i < rounds; ++i)
+    {
+      const bool good = ((id + i) % 3) != 0;
+
+      Account a;
+      a.email = good ? "user" + std::to_string(id) + "@example.com" : "nope";
+      a.password = good ? "long-enough" : "short";
+      a.age = good ? "30" : "x";
+
+      const auto r = a.validate();
+      if (r.ok() != good || a.is_valid() != good || (!good && r.errors.size() != 3))
+        mismatches.fetch_add(1);
+
+      using Input = std::vector<std::pair<std::string_view, std::string_view>>;
+      const Input in = {{"email", good ? "a@b.co" : "bad"}, {"age", good ? "42" : "7"}};
+      const auto f = Form<SignupForm>::validate(in);
+      if (static_cast<bool>(f) != good)
+        mismatches.fetch_add(1);
+    }
+  };
+
+  std::vector<std::thread> pool;
+  pool.reserve(threads);
+  for (std::size_t t = 0; t < threads; ++t)
+  {
+    pool.emplace_back(work, t);
+  }
+  while (ready.load() != threads)
+  {
+    std::this_thread::yield();
+  }
+  go.store(true);
+  for (auto &t : pool)
+  {
+    t.join();
+  }
+
+  assert(mismatches.load() == 0);
+  assert(check_calls.load() >= threads * rounds);
+
+  // Same schema through the batch API.
+  std::vector<Account> rows(4096);
+  for (std::size_t i = 0; i < rows.size(); ++i)
+  {
+    rows[i].email = i % 5 ? "x@y.io" : "bad";
+    rows[i].password = "password-ok";
+    rows[i].age = "20";
+  }
+  const auto batch = validate_batch(Account::schema(), rows, {.threads = threads, .grain = 16});
+  assert(batch.failed_count() == (rows.size() + 4) / 5);
+
+  std::cout << "schema_concurrent_stress: OK\n";
+  return 0;
+}
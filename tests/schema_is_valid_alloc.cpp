@@ -0,0 +1,81 @@
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include <vix/validation/BaseModel.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/StaticField.hpp>
+
+#include "alloc_counter.hpp"
+
+using namespace vix::validation;
+
+struct Account : BaseModel<Account>
+{
+  std::string email;
+  std::string role;
+  std::string age;
+  int score{0};
+  double ratio{0.0};
+
+  static Schema<Account> schema()
+  {
+    return vix::validation::schema<Account>()
+        .field("email", &Account::email,
+               field<std::string>().required().email().length_min(6).length_max(120))
+        .field("role", &Account::role,
+               field<std::string>().required().in_set({"admin", "user", "guest"}))
+        .parsed<int>("age", &Account::age, parsed<int>().between(18, 120))
+        .field("score", &Account::score, field<int>().min(0).max(100))
+        .field("ratio", &Account::ratio, static_field<double>(rules::between(0.0, 1.0)));
+  }
+};
+
+int main()
+{
+  // Build the cached schema and the fixtures before counting.
+  const Schema<Account> &s = BaseModel<Account>::schema();
+
+  Account good;
+  good.email = "someone.long@example.com";
+  good.role = "admin";
+  good.age = "42";
+  good.score = 50;
+  good.ratio = 0.5;
+
+  Account bad_email = good;
+  bad_email.email = "this is definitely not an email address";
+
+  Account bad_role = good;
+  bad_role.role = "superuser-with-a-very-long-role-name";
+
+  Account bad_age = good;
+  bad_age.age = "not-a-number";
+
+  Account bad_numbers = good;
+  bad_numbers.score = 1000;
+  bad_numbers.ratio = 3.0;
+
+  bool results[6] = {};
+  [[maybe_unused]] const std::size_t n = allocations_during([&]
+                                                            {
+                                                              results[0] = s.is_valid(good);
+                                                              results[1] = good.is_valid();
+                                                              results[2] = bad_email.is_valid();
+                                                              results[3] = bad_role.is_valid();
+                                                              results[4] = bad_age.is_valid();
+                                                              results[5] = bad_numbers.is_valid(); });
+
+  assert(n == 0);
+  assert(results[0] && results[1]);
+  assert(!results[2] && !results[3] && !results[4] && !results[5]);
+
+  // is_valid agrees with validate()
+  assert(good.validate().ok());
+  assert(!bad_email.validate().ok());
+  assert(!bad_numbers.validate().ok());
+
+  std::cout << "[validation] is_valid allocation tests passed\n";
+  return 0;
+}
@@ -0,0 +1,77 @@
+#include <cassert>
+#include <iostream>
+#include <string>
+
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/StaticField.hpp>
+
+using namespace vix::validation;
+
+struct User
+{
+  std::string email;
+  int age{0};
+};
+
+int main()
+{
+  auto s = schema<User>()
+               .field("email", &User::email,
+                      static_field<std::string>(rules::required(), rules::email(), rules::length_max(120)))
+               .field("age", &User::age,
+                      static_field<int>(rules::min(18), rules::max(120)));
+
+  // -------------------------
+  // valid object
+  // -------------------------
+  {
+    User u{"john@doe.com", 30};
+    assert(s.validate(u).ok());
+  }
+
+  // -------------------------
+  // errors keep rule order and match FieldSpec
+  // -------------------------
+  {
+    User u{"", 10};
+    auto r = s.validate(u);
+
+    auto dyn = schema<User>()
+                   .field("email", &User::email,
+                          field<std::string>().required().email().length_max(120))
+                   .field("age", &User::age, field<int>().min(18).max(120))
+                   .validate(u);
+
+    assert(r.errors.size() == 3);
+    assert(r.errors.size() == dyn.errors.size());
+    for (std::size_t i = 0; i < r.errors.size(); ++i)
+    {
+      assert(r.errors[i].field == dyn.errors[i].field);
+      assert(r.errors[i].code == dyn.errors[i].code);
+      assert(r.errors[i].message == dyn.errors[i].message);
+    }
+    assert(r.errors[0].code == ValidationErrorCode::Required);
+    assert(r.errors[2].field == "age");
+    assert(r.errors[2].code == ValidationErrorCode::Min);
+  }
+
+  // -------------------------
+  // custom callables are accepted as rules
+  // -------------------------
+  {
+    auto even = [](std::string_view f, const int &v, ValidationErrors &out)
+    {
+      if (v % 2 != 0)
+        out.add(std::string(f), ValidationErrorCode::Custom, "must be even");
+    };
+
+    auto s2 = schema<User>().field("age", &User::age, static_field<int>(rules::between(0, 200), even));
+    User u{"a@b.co", 31};
+    auto r = s2.validate(u);
+    assert(r.errors.size() == 1);
+    assert(r.errors[0].code == ValidationErrorCode::Custom);
+  }
+
+  std::cout << "[validation] static_field smoke tests passed\n";
+  return 0;
+}
@@ -0,0 +1,195 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <vix/validation/Rules.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/TextKernels.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+
+namespace
+{
+  // Straightforward decoder, kept independent of the kernels.
+  kernels::Utf8Scan reference(std::string_view s)
+  {
+    kernels::Utf8Scan r;
+    std::size_t i = 0;
+    while (i < s.size())
+    {
+      const auto c = static_cast<unsigned char>(s[i]);
+      std::size_t len = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xE ? 3 : (c >> 3) == 0x1E ? 4 : 0;
+      if (len == 0 || i + len > s.size())
+      {
+        r.error = i;
+        return r;
+      }
+
+      std::uint32_t cp = len == 1 ? c : len == 2 ? (c & 0x1F) : len == 3 ? (c & 0x0F) : (c & 0x07);
+      for (std::size_t k = 1; k < len; ++k)
+      {
+        const auto b = static_cast<unsigned char>(s[i + k]);
+        if ((b & 0xC0) != 0x80)
+        {
+          r.error = i;
+          return r;
+        }
+        cp = (cp << 6) | (b & 0x3F);
+      }
+
+      const std::uint32_t min_cp[] = {0, 0, 0x80, 0x800, 0x10000};
+      if (cp < min_cp[len] || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+      {
+        r.error = i;
+        return r;
+      }
+      i += len;
+      ++r.length;
+    }
+    return r;
+  }
+
+  void check(std::string_view s)
+  {
+    [[maybe_unused]] const kernels::Utf8Scan want = reference(s);
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2})
+    {
+      [[maybe_unused]] const kernels::Utf8Scan got = kernels::utf8_scan(s, level);
+      assert(got.error == want.error);
+      assert(got.length == want.length);
+    }
+  }
+} // namespace
+
+int main()
+{
+  // -------------------------
+  // every 1-2 byte sequence, and 3-4 byte leads with edge continuations,
+  // at every offset across a 32-byte boundary
+  // -------------------------
+  {
+    const unsigned char edges[] = {0x00, 0x41, 0x7F, 0x80, 0x8F, 0x90, 0x9F, 0xA0, 0xBF, 0xC0, 0xFF};
+    for (std::size_t offset : {0u, 13u, 29u, 30u, 31u, 32u, 61u, 62u, 63u})
+    {
+      for (unsigned a = 0; a < 256; ++a)
+      {
+        for (unsigned b = 0; b < 256; ++b)
+        {
+          std::string s(offset, 'x');
+          s += static_cast<char>(a);
+          s += static_cast<char>(b);
+          s += std::string(40, 'y');
+          check(s);
+          s.resize(offset + 2);
+          check(s);
+        }
+
+        if (a < 0xE0)
+        {
+          continue;
+        }
+        for (unsigned b : edges)
+        {
+          for (unsigned c : edges)
+          {
+            for (unsigned d : edges)
+            {
+              std::string s(offset, 'x');
+              s += static_cast<char>(a);
+              s += static_cast<char>(b);
+              s += static_cast<char>(c);
+              s += static_cast<char>(d);
+              check(s);
+              s += std::string(35, 'z');
+              check(s);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // -------------------------
+  // random text: valid code points of every width, with corruptions
+  // -------------------------
+  {
+    std::mt19937 rng(42);
+    const std::string_view pieces[] = {"a", "Z", " ", "\xC3\xA9", "\xDF\xBF", "\xE2\x82\xAC", "\xED\x9F\xBF",
+                                       "\xEF\xBF\xBD", "\xF0\x9F\x98\x80", "\xF4\x8F\xBF\xBF"};
+    std::uniform_int_distribution<std::size_t> piece(0, std::size(pieces) - 1);
+    std::uniform_int_distribution<int> byte(0, 255);
+
+    for (int round = 0; round < 4000; ++round)
+    {
+      std::string s;
+      const std::size_t target = static_cast<std::size_t>(round % 300);
+      while (s.size() < target)
+      {
+        s += pieces[piece(rng)];
+      }
+      check(s);
+
+      if (!s.empty())
+      {
+        s[static_cast<std::size_t>(rng()) % s.size()] = static_cast<char>(byte(rng));
+        check(s);
+        s.pop_back();
+        check(s);
+      }
+    }
+  }
+
+  // -------------------------
+  // rules
+  // -------------------------
+  {
+    const std::string name = "Zo\xC3\xAB \xF0\x9F\x98\x80"; // 5 code points, 9 bytes
+    assert(validate("name", name).utf8_valid().utf8_length_between(5, 5).result().ok());
+
+    auto too_short = validate("name", name).utf8_length_min(6).result();
+    assert(too_short.errors.size() == 1);
+    assert(too_short.errors.all()[0].code == ValidationErrorCode::LengthMin);
+    assert(too_short.errors.all()[0].meta.at("got").as_uint() == 5);
+
+    const std::string_view view = name;
+    auto too_long = validate("name", view).utf8_length_max(4).result();
+    assert(too_long.errors.size() == 1);
+    assert(too_long.errors.all()[0].code == ValidationErrorCode::LengthMax);
+
+    auto between = validate("name", name).utf8_length_between(6, 10).result();
+    assert(between.errors.all()[0].code == ValidationErrorCode::LengthMin);
+    assert(between.errors.all()[0].meta.at("max").as_uint() == 10);
+
+    const std::string bad = "abc\xE2\x82";
+    auto invalid = validate("name", bad).utf8_valid().utf8_length_max(10).result();
+    assert(invalid.errors.size() == 2);
+    for ([[maybe_unused]] const auto &e : invalid.errors.all())
+    {
+      assert(e.code == ValidationErrorCode::Format);
+      assert(e.meta.at("reason") == "invalid_utf8");
+      assert(e.meta.at("offset").as_uint() == 3);
+    }
+
+    // The caller's message is kept for invalid input too.
+    auto custom = validate("name", bad).utf8_length_max(10, "name too long").result();
+    assert(custom.errors.size() == 1);
+    assert(custom.errors.all()[0].meta.at("reason") == "invalid_utf8");
+    assert(custom.errors.all()[0].message == "name too long");
+
+    struct Profile
+    {
+      std::string bio;
+    };
+    const auto s = schema<Profile>().field("bio", &Profile::bio, field<std::string>().utf8_valid().utf8_length_max(3));
+    assert(s.validate(Profile{"\xC3\xA9\xC3\xA9\xC3\xA9"}).ok());
+    assert(!s.validate(Profile{"\xC3\xA9\xC3\xA9\xC3\xA9!"}).ok());
+  }
+
+  std::cout << "utf8_rules_smoke: OK\n";
+  return 0;
+}
@@ -0,0 +1,135 @@
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/SchemaBatch.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+
+struct Reading
+{
+  std::int32_t sensor{0};
+  std::int64_t timestamp{0};
+  double temperature{0};
+  float humidity{0};
+  std::uint16_t battery{0};
+  std::string unit;
+};
+
+static Schema<Reading> make_schema()
+{
+  return schema<Reading>()
+      .field("sensor", &Reading::sensor, field<std::int32_t>().min(1).max(5000))
+      .field("timestamp", &Reading::timestamp, field<std::int64_t>().min(1'600'000'000))
+      .field("temperature", &Reading::temperature,
+             static_field<double>(rules::between(-60.0, 60.0)))
+      .field("humidity", &Reading::humidity, field<float>().between(0.0f, 100.0f))
+      .field("battery", &Reading::battery,
+             [](std::string_view f, const std::uint16_t &v)
+             {
+               return validate(f, v).max(100);
+             })
+      .field("unit", &Reading::unit, field<std::string>().required().length_max(2))
+      .check([](const Reading &r, ValidationErrors &errors)
+             {
+               if (r.temperature > 40.0 && r.humidity > 90.0f)
+               {
+                 errors.add("humidity", ValidationErrorCode::Custom, "implausible reading");
+               } });
+}
+
+static std::vector<Reading> make_rows(std::size_t n)
+{
+  std::vector<Reading> rows(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    Reading &r = rows[i];
+    r.sensor = static_cast<std::int32_t>(1 + i % 4000);
+    r.timestamp = 1'700'000'000 + static_cast<std::int64_t>(i);
+    r.temperature = -20.0 + static_cast<double>(i % 70);
+    r.humidity = static_cast<float>(i % 95);
+    r.battery = static_cast<std::uint16_t>(i % 100);
+    r.unit = "C";
+
+    if (i % 101 == 0)
+      r.sensor = 0;
+    if (i % 103 == 0)
+      r.timestamp = 5;
+    if (i % 107 == 0)
+      r.temperature = std::numeric_limits<double>::quiet_NaN(); // passes range rules
+    if (i % 109 == 0)
+      r.temperature = 99.0;
+    if (i % 113 == 0)
+      r.humidity = -1.0f;
+    if (i % 127 == 0)
+      r.battery = 250;
+    if (i % 131 == 0)
+      r.unit = "";
+  }
+  return rows;
+}
+
+static void expect_same(const BatchResult &a, [[maybe_unused]] const BatchResult &b)
+{
+  assert(a.size() == b.size());
+  assert(a.failure_bitmap() == b.failure_bitmap());
+  assert(a.failed_indices() == b.failed_indices());
+  assert(a.error_count() == b.error_count());
+  for (std::size_t i = 0; i < a.error_count(); ++i)
+  {
+    assert(a.errors()[i].field == b.errors()[i].field.view());
+    assert(a.errors()[i].code == b.errors()[i].code);
+    assert(a.errors()[i].message == b.errors()[i].message.view());
+  }
+}
+
+int main()
+{
+  const auto s = make_schema();
+  const auto rows = make_rows(3000);
+
+  for (ValidationPolicy policy : {ValidationPolicy::AllErrors,
+                                  ValidationPolicy::FirstErrorPerField,
+                                  ValidationPolicy::FailFast})
+  {
+    const auto rowwise = validate_batch(s, rows, {.threads = 1, .policy = policy, .columnar = false});
+    assert(!rowwise.ok());
+
+    for (std::size_t threads : {1u, 3u})
+    {
+      for (std::size_t grain : {1u, 63u, 256u, 1000u, 5000u})
+      {
+        const auto columnar = validate_batch(s, rows, {.threads = threads, .grain = grain, .policy = policy});
+        expect_same(rowwise, columnar);
+      }
+    }
+  }
+
+  // Cross-field errors come after the field errors of the same record.
+  {
+    std::vector<Reading> one = make_rows(1);
+    one[0].sensor = 1;
+    one[0].timestamp = 1'700'000'000;
+    one[0].temperature = 45.0;
+    one[0].humidity = 95.0f;
+    one[0].battery = 500;
+    one[0].unit = "C";
+
+    const auto r = validate_batch(s, one, {.threads = 1});
+    const auto errs = r.errors_of(0);
+    assert(errs.size() == 2);
+    assert(errs[0].field == "battery");
+    assert(errs[1].code == ValidationErrorCode::Custom);
+  }
+
+  std::cout << "validate_batch_columnar: OK\n";
+  return 0;
+}
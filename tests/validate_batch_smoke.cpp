@@ -0,0 +1,193 @@
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <vix/validation/Pipe.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/SchemaBatch.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+
+struct Row
+{
+  std::string email;
+  std::string age;
+  int score{0};
+};
+
+static Schema<Row> make_schema()
+{
+  return schema<Row>()
+      .field("email", &Row::email, field<std::string>().required().email())
+      .parsed<int>("age", &Row::age, parsed<int>().between(18, 120))
+      .field("score", &Row::score,
+             [](std::string_view f, const int &v)
+             {
+               return validate(f, v).between(0, 100);
+             });
+}
+
+static std::vector<Row> make_rows(std::size_t n)
+{
+  std::vector<Row> rows;
+  rows.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    Row r{"user" + std::to_string(i) + "@example.com", std::to_string(18 + i % 50), static_cast<int>(i % 100)};
+    if (i % 7 == 0)
+      r.email = "broken";
+    if (i % 11 == 0)
+      r.age = "x";
+    if (i % 13 == 0)
+      r.score = 500;
+    rows.push_back(std::move(r));
+  }
+  return rows;
+}
+
+static void expect_same(const BatchResult &a, [[maybe_unused]] const BatchResult &b)
+{
+  assert(a.size() == b.size());
+  assert(a.failure_bitmap() == b.failure_bitmap());
+  assert(a.failed_indices() == b.failed_indices());
+  assert(a.error_count() == b.error_count());
+  for (std::size_t i = 0; i < a.error_count(); ++i)
+  {
+    assert(a.errors()[i].field == b.errors()[i].field.view());
+    assert(a.errors()[i].code == b.errors()[i].code);
+  }
+}
+
+int main()
+{
+  const auto s = make_schema();
+  const auto rows = make_rows(5000);
+
+  // Reference: per-record validate().
+  const auto ref = validate_batch(s, rows, {.threads = 1});
+  assert(ref.size() == rows.size());
+  for (std::size_t i = 0; i < rows.size(); ++i)
+  {
+    const auto r = s.validate(rows[i]);
+    assert(ref.failed(i) == !r.ok());
+
+    const auto errs = ref.errors_of(i);
+    assert(errs.size() == r.errors.size());
+    for (std::size_t k = 0; k < errs.size(); ++k)
+    {
+      assert(errs[k].field == r.errors[k].field.view());
+      assert(errs[k].code == r.errors[k].code);
+    }
+  }
+
+  // Same result for any thread count and grain.
+  for (std::size_t threads : {2u, 4u, 8u, 0u})
+  {
+    for (std::size_t grain : {1u, 7u, 64u, 1024u, 100000u})
+    {
+      expect_same(ref, validate_batch(s, rows, {.threads = threads, .grain = grain}));
+    }
+  }
+
+  // Policy is applied per record.
+  {
+    const auto fast = validate_batch(s, rows, {.threads = 4, .grain = 16, .policy = ValidationPolicy::FailFast});
+    assert(fast.failed_indices() == ref.failed_indices());
+    assert(fast.error_count() == fast.failed_count());
+  }
+
+  // FirstErrorPerField only trims against the record's own errors: a
+  // field that failed in an earlier record of the chunk still reports.
+  {
+    struct Pair
+    {
+      int a{0};
+      int b{0};
+    };
+
+    const auto pairs = schema<Pair>().check([](const Pair &p, ValidationErrors &errors)
+                                            {
+                                              if (p.a > p.b)
+                                              {
+                                                errors.add("a", ValidationErrorCode::Custom, "a > b");
+                                                errors.add("a", ValidationErrorCode::Custom, "a still > b");
+                                              } });
+    const std::vector<Pair> items{{5, 1}, {0, 1}, {7, 2}};
+
+    for (bool columnar : {true, false})
+    {
+      const auto r = validate_batch(pairs, items, {.threads = 1,
+                                                   .grain = 8,
+                                                   .policy = ValidationPolicy::FirstErrorPerField,
+                                                   .columnar = columnar});
+      assert(r.failed_indices() == (std::vector<std::size_t>{0, 2}));
+      assert(r.errors_of(0).size() == 1);
+      assert(r.errors_of(2).size() == 1);
+      assert(r.errors_of(2)[0].field == "a");
+    }
+  }
+
+  // FirstErrorPerField also skips later entries on a field that failed,
+  // in the block path.
+  {
+    struct One
+    {
+      int a{0};
+    };
+
+    const auto repeated = schema<One>()
+                              .field("a", &One::a, field<int>().min(5))
+                              .field("a", &One::a, field<int>().min(7))
+                              .field("a", &One::a,
+                                     [](std::string_view f, const int &v)
+                                     {
+                                       return validate(f, v).min(9);
+                                     });
+    const std::vector<One> items{{0}, {10}, {6}};
+
+    for (bool columnar : {true, false})
+    {
+      const auto r = validate_batch(repeated, items, {.threads = 1,
+                                                      .grain = 8,
+                                                      .policy = ValidationPolicy::FirstErrorPerField,
+                                                      .columnar = columnar});
+      assert(r.failed_indices() == (std::vector<std::size_t>{0, 2}));
+      assert(r.errors_of(0).size() == 1);
+      assert(r.errors_of(2).size() == 1);
+      assert(r.errors_of(2)[0].meta.at("min").as_int() == 7);
+    }
+  }
+
+  // Empty input.
+  {
+    const auto empty = validate_batch(s, std::span<const Row>{}, {.threads = 4});
+    assert(empty.size() == 0 && empty.ok() && empty.errors_of(0).empty());
+  }
+
+  // Exceptions thrown by a check propagate to the caller.
+  {
+    auto throwing = schema<Row>().check([](const Row &row, ValidationErrors &)
+                                        {
+                                          if (row.score == 42)
+                                            throw std::runtime_error("boom");
+                                        });
+    [[maybe_unused]] bool thrown = false;
+    try
+    {
+      (void)validate_batch(throwing, rows, {.threads = 4, .grain = 10});
+    }
+    catch (const std::runtime_error &)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+  }
+
+  std::cout << "validate_batch_smoke: OK\n";
+  return 0;
+}
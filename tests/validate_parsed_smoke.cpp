@@ -49,7 +49,7 @@ int main()
     assert(!res.ok());
     assert(res.errors.size() == 1);
 
-    const auto &err = res.errors.all()[0];
+    [[maybe_unused]] const auto &err = res.errors.all()[0];
     assert(err.field == "age");
     assert(err.code == ValidationErrorCode::Format);
     assert(err.meta.count("conversion_code") == 1);
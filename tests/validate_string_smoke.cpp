@@ -72,7 +72,7 @@ int main()
     assert(!res.ok());
     // required + email + length_min
     assert(res.errors.size() == 3);
-    for (const auto &e : res.errors.all())
+    for ([[maybe_unused]] const auto &e : res.errors.all())
     {
       assert(e.field == "email");
     }
@@ -0,0 +1,200 @@
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <vix/validation/Form.hpp>
+#include <vix/validation/Pipe.hpp>
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/SchemaJson.hpp>
+#include <vix/validation/StaticField.hpp>
+#include <vix/validation/Validate.hpp>
+
+using namespace vix::validation;
+
+struct Signup
+{
+  std::string email;
+  std::string password;
+  std::string age;
+
+  static bool set(Signup &out, std::string_view key, std::string_view value)
+  {
+    if (key == "email")
+      out.email.assign(value);
+    else if (key == "password")
+      out.password.assign(value);
+    else if (key == "age")
+      out.age.assign(value);
+    else
+      return false;
+    return true;
+  }
+
+  static Schema<Signup> schema()
+  {
+    return vix::validation::schema<Signup>()
+        .field("email", &Signup::email,
+               field<std::string>().required().email().length_min(5))
+        .field("password", &Signup::password,
+               [](std::string_view f, const std::string &v)
+               {
+                 return validate(f, v).required().length_min(8);
+               })
+        .parsed<int>("age", &Signup::age, parsed<int>().between(18, 120))
+        .check([](const Signup &s, ValidationErrors &errors)
+               {
+                 if (s.password == s.email)
+                 {
+                   errors.add("password", ValidationErrorCode::Custom, "password equals email");
+                   errors.add("email", ValidationErrorCode::Custom, "email equals password");
+                 } });
+  }
+};
+
+// Several entries of every check kind on the same field names.
+struct Repeat
+{
+  int a{0};
+  std::string n{"x"};
+};
+
+struct RepeatClean
+{
+  int a{0};
+  int n{0};
+};
+
+static Schema<Repeat> repeat_schema()
+{
+  return vix::validation::schema<Repeat>()
+      .field("a", &Repeat::a, field<int>().min(5))
+      .field("a", &Repeat::a, field<int>().min(7))
+      .field("a", &Repeat::a,
+             [](std::string_view f, const int &v)
+             {
+               return validate(f, v).min(9);
+             })
+      .field("a", &Repeat::a,
+             [](std::string_view f, const int &v)
+             {
+               return validate(f, v).min(11).result();
+             })
+      .field("a", &Repeat::a, static_field<int>(rules::min(13)))
+      .field("a", &Repeat::a, field<int>().min(15), &RepeatClean::a)
+      .parsed<int>("n", &Repeat::n, parsed<int>().min(1))
+      .parsed<int>("n", &Repeat::n,
+                   [](std::string_view f, std::string_view in)
+                   {
+                     return validate_parsed<int>(f, in).min(1);
+                   })
+      .parsed<int>("n", &Repeat::n, parsed<int>().min(1), &RepeatClean::n);
+}
+
+int main()
+{
+  const auto s = Signup::schema();
+  const Signup bad{"", "", "10"};
+
+  // -------------------------
+  // AllErrors collects everything
+  // -------------------------
+  {
+    auto r = s.validate(bad);
+    // email: required + email + length_min, password: required + length_min,
+    // age: between, check: 2
+    assert(r.errors.size() == 8);
+  }
+
+  // -------------------------
+  // FirstErrorPerField keeps one error per field
+  // -------------------------
+  {
+    auto r = s.validate(bad, ValidationPolicy::FirstErrorPerField);
+    assert(r.errors.size() == 3);
+    assert(r.errors[0].field == "email");
+    assert(r.errors[0].code == ValidationErrorCode::Required);
+    assert(r.errors[1].field == "password");
+    assert(r.errors[1].code == ValidationErrorCode::Required);
+    assert(r.errors[2].field == "age");
+  }
+
+  // -------------------------
+  // FailFast stops at the first error
+  // -------------------------
+  {
+    auto r = s.validate(bad, ValidationPolicy::FailFast);
+    assert(r.errors.size() == 1);
+    assert(r.errors[0].field == "email");
+    assert(r.errors[0].code == ValidationErrorCode::Required);
+  }
+
+  // -------------------------
+  // FirstErrorPerField holds across entries sharing a field name
+  // -------------------------
+  {
+    const auto rs = repeat_schema();
+    Repeat obj;
+
+    assert(rs.validate(obj).errors.size() == 9);
+
+    const auto check_first = [](const ValidationErrors &errors)
+    {
+      assert(errors.size() == 2);
+      assert(errors[0].field == "a");
+      assert(errors[0].code == ValidationErrorCode::Min);
+      assert(errors[0].meta.at("min").as_int() == 5);
+      assert(errors[1].field == "n");
+      assert(errors[1].code == ValidationErrorCode::Format);
+      (void)errors;
+    };
+
+    check_first(rs.validate(obj, ValidationPolicy::FirstErrorPerField).errors);
+
+    ValidationErrors into;
+    RepeatClean clean;
+    rs.validate_into(obj, into, clean, ValidationPolicy::FirstErrorPerField);
+    check_first(into);
+
+    check_first(validate_json(rs, R"({"a":0,"n":"x"})", obj, ValidationPolicy::FirstErrorPerField).errors);
+
+    // Entries for the failed field are skipped; other fields still run.
+    obj.n = "0";
+    const auto mixed = rs.validate(obj, ValidationPolicy::FirstErrorPerField);
+    assert(mixed.errors.size() == 2);
+    assert(mixed.errors[1].field == "n");
+    assert(mixed.errors[1].code == ValidationErrorCode::Min);
+  }
+
+  // -------------------------
+  // Validator / ParsedValidator honor the policy
+  // -------------------------
+  {
+    std::string empty;
+    assert(validate("email", empty).required().email().length_min(5).result().size() == 3);
+    assert(validate("email", empty).required().email().length_min(5).result(ValidationPolicy::FailFast).size() == 1);
+
+    auto p = validate_parsed<int>("n", "5").min(10).max(1).rule(rules::between(100, 200));
+    assert(p.result().size() == 3);
+    assert(p.result(ValidationPolicy::FirstErrorPerField).size() == 1);
+  }
+
+  // -------------------------
+  // Form::validate forwards the policy
+  // -------------------------
+  {
+    auto all = Form<Signup>::validate_kv({{"email", ""}, {"password", ""}, {"age", "10"}});
+    assert(!all);
+    assert(all.errors().size() == 8);
+
+    auto fast = Form<Signup>::validate_kv({{"email", ""}, {"password", ""}, {"age", "10"}},
+                                          ValidationPolicy::FailFast);
+    assert(!fast);
+    assert(fast.errors().size() == 1);
+  }
+
+  std::cout << "[validation] validation policy smoke tests passed\n";
+  return 0;
+}
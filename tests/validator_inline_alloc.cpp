@@ -0,0 +1,166 @@
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <vix/validation/Schema.hpp>
+#include <vix/validation/Validate.hpp>
+
+#include "alloc_counter.hpp"
+
+using namespace vix::validation;
+
+struct User
+{
+  std::string email;
+  int age{0};
+
+  static Schema<User> schema()
+  {
+    return vix::validation::schema<User>()
+        .field("email", &User::email,
+               [](std::string_view f, const std::string &v)
+               {
+                 return validate(f, v).required().email().length_max(120);
+               })
+        .field("age", &User::age,
+               [](std::string_view f, const int &v)
+               {
+                 return validate(f, v).min(18).max(120);
+               });
+  }
+};
+
+int main()
+{
+  const std::string good = "someone.long@example.com";
+  const std::string bad = "not an email";
+  const int age = 10;
+
+  // -------------------------
+  // Chained builders are plain stack objects
+  // -------------------------
+  {
+    using Chain = decltype(validate("email", good).required().email());
+    static_assert(std::is_same_v<Chain, Validator<std::string, rules::Required<std::string>, rules::Email>>);
+
+    ValidationErrors out;
+    out.reserve(8);
+
+    // Passing values: no allocation at all.
+    [[maybe_unused]] const std::size_t ok_allocs = allocations_during([&]
+                                                                      {
+                                                                        validate("email", good).required().email().length_min(8).result_into(out);
+                                                                        validate("age", 42).between(18, 120).result_into(out);
+                                                                        (void)validate("age", age).min(18).is_valid(); });
+    assert(ok_allocs == 0);
+    assert(out.empty());
+
+    // Failing values: only the field name of each error is copied
+    // (messages are borrowed, meta is inline).
+    [[maybe_unused]] const std::size_t bad_allocs = allocations_during([&]
+                                                                       {
+                                                                         validate("email", bad).required().email().length_min(8).result_into(out);
+                                                                         validate("age", age).between(18, 120).result_into(out); });
+    assert(bad_allocs == 2);
+    assert(out.size() == 2);
+    assert(out[0].code == ValidationErrorCode::Format);
+    assert(out[1].code == ValidationErrorCode::Between);
+  }
+
+  // -------------------------
+  // Schema lambdas returning a chained builder
+  // -------------------------
+  {
+    const auto s = User::schema();
+    const User u{bad, 10};
+
+    ValidationErrors out;
+    out.reserve(8);
+    s.validate_into(u, out);
+    assert(out.size() == 2);
+    out.clear();
+
+    [[maybe_unused]] const std::size_t n = allocations_during([&]
+                                                              {
+                                                                s.validate_into(u, out);
+                                                                (void)s.is_valid(u); });
+    assert(n == 0);
+    assert(out.size() == 2);
+  }
+
+  // -------------------------
+  // Same results and policies as before
+  // -------------------------
+  {
+    const std::string empty;
+    assert(validate("email", empty).required().email().length_min(5).result().size() == 3);
+    assert(validate("email", empty).required().email().length_min(5).result(ValidationPolicy::FailFast).size() == 1);
+    assert(validate("n", 5).rule_if(false, rules::min(10)).rule_if(true, rules::max(3)).result().size() == 1);
+  }
+
+  // -------------------------
+  // Named (lvalue) builders and the type-erased Validator<T> still work
+  // -------------------------
+  {
+    auto v = validate("age", age);
+    v.min(18);
+    v.max(9);
+    v.rule_if(true, rules::between(0, 5));
+    assert(v.result().size() == 3);
+
+    Validator<int> erased = validate("age", age).min(18).max(9);
+    erased.between(0, 5);
+    const auto r = erased.result();
+    assert(r.size() == 3);
+    assert(r.errors[0].code == ValidationErrorCode::Min);
+    assert(r.errors[2].code == ValidationErrorCode::Between);
+    assert(!erased.is_valid());
+  }
+
+  // -------------------------
+  // Mixing chained and named calls keeps registration order
+  // -------------------------
+  {
+    auto v = validate("age", age).min(18);  // chained
+    v.max(9);                                // named
+    auto mixed = std::move(v).between(0, 5); // chained again
+    mixed.min(11);                           // named again
+
+    [[maybe_unused]] const auto r = mixed.result();
+    assert(r.size() == 4);
+    assert(r.errors[0].code == ValidationErrorCode::Min);
+    assert(r.errors[1].code == ValidationErrorCode::Max);
+    assert(r.errors[2].code == ValidationErrorCode::Between);
+    assert(r.errors[3].code == ValidationErrorCode::Min);
+
+    // FailFast / FirstErrorPerField stop at the first rule that was added.
+    auto first = validate("age", age).between(0, 5);
+    first.min(18);
+    [[maybe_unused]] const auto fast = std::move(first).max(9).result(ValidationPolicy::FailFast);
+    assert(fast.size() == 1);
+    assert(fast.errors[0].code == ValidationErrorCode::Between);
+
+    // Named calls before the first chained one stay first.
+    auto named = validate("age", age);
+    named.max(9);
+    [[maybe_unused]] const auto r2 = std::move(named).min(18).result(ValidationPolicy::FirstErrorPerField);
+    assert(r2.size() == 1);
+    assert(r2.errors[0].code == ValidationErrorCode::Max);
+
+    // Converting to Validator<int> keeps the same order.
+    auto chain = validate("age", age).min(18);
+    chain.max(9);
+    Validator<int> erased = std::move(chain).between(0, 5);
+    [[maybe_unused]] const auto r3 = erased.result();
+    assert(r3.size() == 3);
+    assert(r3.errors[0].code == ValidationErrorCode::Min);
+    assert(r3.errors[1].code == ValidationErrorCode::Max);
+    assert(r3.errors[2].code == ValidationErrorCode::Between);
+  }
+
+  std::cout << "[validation] inline validator tests passed\n";
+  return 0;
+}